@@ -0,0 +1,417 @@
+#ifndef PIO_UNIT_TESTING   // `pio test` links src/ with each test's own main()
+
+#include <Arduino.h>
+#include <FastLED.h>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+#include "config.h"
+#include "types.h"
+#include "frame.h"
+#include "timebase.h"
+#include "prng.h"
+#include "noise_table.h"
+#include "candle.h"
+#include "sparks.h"
+#include "color_strip.h"
+#include "log.h"
+
+// ─── Host benchmarks ─────────────────────────────────────────────────────────
+//
+// The animation engines timed on the build machine (PlatformIO env:native,
+// Arduino and FastLED from bench/shim). Unlike the on-device `bench` command
+// these are for catching regressions between commits: every case is warmed
+// up, then timed over repeated batches, and the median ns/op goes to a table
+// on stdout and optionally to JSON for tools/bench_compare.py.
+//
+// Engines run exactly as the render task runs them — boot precompute from
+// setup(), one timebaseTick() and one updateFunction() per frame — on a
+// virtual clock advanced 1 ms per frame, the render task's tick rate.
+
+void setup();
+void magicHoldPhase(Frame& out, bool spark);
+extern const ModeConfig MODES[];
+
+using BenchClock = std::chrono::steady_clock;
+
+// Written by every kernel so the compiler cannot drop the work being timed.
+static volatile uint32_t benchSink;
+
+// ─── Engine driver ────────────────────────────────────────────────────────────
+
+static uint64_t benchClockUs = 0;
+static uint64_t benchClock() { return benchClockUs; }
+
+static Frame      benchFrame;
+static CandleMode benchMode = CANDLE_MODE;
+
+static void modeBegin(CandleMode mode) {
+    prngSetRoot(0xC0FFEE);   // same engine state on every run
+    benchMode    = mode;
+    benchClockUs = 0;
+    timebaseSetClock(benchClock);
+    timebaseTick();
+    frameClear(benchFrame);
+    if (MODES[mode].enterFunction) MODES[mode].enterFunction(benchFrame);
+}
+
+static void modeEnd() {
+    if (MODES[benchMode].exitFunction) MODES[benchMode].exitFunction(benchFrame);
+    timebaseSetClock(nullptr);
+}
+
+static void modeFrame() {
+    benchClockUs += 1000;
+    timebaseTick();
+    MODES[benchMode].updateFunction(benchFrame);
+}
+
+// ─── Cases ────────────────────────────────────────────────────────────────────
+
+// noise: one candle noise sample, phase → 0–255 level in Q8.8
+static constexpr int NOISE_SAMPLES = 256;
+static uint32_t      noisePhase;
+
+static void noiseSetup() { noisePhase = noisePhaseFromUnits(1234.0f); }
+
+static void noiseOp() {
+    static constexpr uint32_t STEP = noisePhaseFromUnits(CANDLE_FLICKER_SPEED);
+    uint32_t acc = 0;
+    for (int i = 0; i < NOISE_SAMPLES; i++) { acc += noiseSample(noisePhase); noisePhase += STEP; }
+    benchSink = acc;
+}
+
+// pick: one weighted sub-mode pick
+static constexpr int PICKS = 256;
+static Prng          pickRng;
+
+static void pickSetup() { pickRng.seed(1); }
+
+static void pickOp() {
+    FlameSubMode m = FlameSubMode::FLICKER;
+    for (int i = 0; i < PICKS; i++) m = pickNextSubMode(pickRng, m);
+    benchSink = (uint32_t)m;
+}
+
+// step: one fixed-point flame step, steady FLICKER
+static CandleState   stepState;
+static CandleControl stepControl;
+
+static void stepSetup() {
+    candleBegin(stepState);
+    stepControl = {FlameSubMode::FLICKER, FlameSubMode::FLICKER, false, 0, false, false};
+}
+
+static void stepOp() {
+    CandleDuty d = candleStep(stepState, stepControl, 1 << 16);   // 1 ms
+    benchSink = d.w1 + d.w2 + d.red;
+}
+
+// modes: one full render frame
+static void candleSetup() { modeBegin(CANDLE_MODE); }
+static void colorSetup()  { modeBegin(COLOR_MODE); }
+
+static void driftSetup() {
+    modeBegin(MAGIC_MODE);
+    magicHoldPhase(benchFrame, false);
+}
+
+static void sparkSetup() {
+    modeBegin(MAGIC_MODE);
+    for (int i = 0; i < 100; i++) modeFrame();   // SPARK fades down from a drawn drift frame
+    magicHoldPhase(benchFrame, true);
+}
+
+// xfade: Auto's crossfade — the blend kernel alone, and two engines side by
+// side plus the blend, as Auto runs them for AUTO_XFADE_MS. Compare the pairs
+// with the mode/ cases to see what a crossfade adds to a frame.
+static Frame      xfadeA, xfadeB, xfadeOut;
+static uint16_t   xfadeAmount;
+static CandleMode xfadeFrom, xfadeTo;
+
+static void blendSetup() {
+    for (int i = 0; i < NUM_LEDS; i++) {
+        xfadeA.leds[i] = CRGB(i * 7, 255 - i, 40);
+        xfadeB.leds[i] = CRGB(3, i * 11, 200 - i);
+    }
+    for (int ch = 0; ch < 4; ch++) { xfadeA.duty[ch] = 100 * ch; xfadeB.duty[ch] = MAX_DUTY - 50 * ch; }
+    xfadeAmount = 0;
+}
+
+static void blendOp() {
+    frameBlend(xfadeA, xfadeB, xfadeAmount, xfadeOut);
+    xfadeAmount = (xfadeAmount + 1) & 0xFF;
+    benchSink = xfadeOut.leds[NUM_LEDS / 2].g;
+}
+
+static void pairBegin(CandleMode from, CandleMode to) {
+    modeBegin(from);   // clock, seed, and the outgoing engine in benchFrame
+    xfadeFrom = from;
+    xfadeTo   = to;
+    frameClear(xfadeB);
+    MODES[to].enterFunction(xfadeB);
+    xfadeAmount = 0;
+}
+
+static void pairOp() {
+    benchClockUs += 1000;
+    timebaseTick();
+    MODES[xfadeFrom].updateFunction(benchFrame);
+    MODES[xfadeTo].updateFunction(xfadeB);
+    frameBlend(benchFrame, xfadeB, xfadeAmount, xfadeOut);
+    xfadeAmount = (xfadeAmount + 1) & 0xFF;
+    benchSink = xfadeOut.leds[0].r + xfadeOut.duty[0];
+}
+
+static void pairEnd() {
+    MODES[xfadeTo].exitFunction(xfadeB);
+    modeEnd();
+}
+
+static void candleColorSetup() { pairBegin(CANDLE_MODE, COLOR_MODE); }
+static void colorMagicSetup()  { pairBegin(COLOR_MODE, MAGIC_MODE); }
+static void magicCandleSetup() { pairBegin(MAGIC_MODE, CANDLE_MODE); }
+
+// spark: a full particle pool on a 1000-pixel strip, as `bench spark` runs
+// it — step and render one 1 ms frame, respawning the particles that died so
+// the population stays at N. ns/op is per particle.
+static constexpr int SPARK_STRIP = 1000;
+static CRGB          sparkBenchPalette[256];
+static CRGB          sparkBenchLeds[SPARK_STRIP];
+static Prng          sparkBenchRng;
+
+template <int N>
+static SparkPool<N>& sparkBenchPool() {
+    static SparkPool<N> pool;
+    return pool;
+}
+
+template <int N>
+static void sparkRefill() {
+    SparkPool<N>& pool = sparkBenchPool<N>();
+    SparkPoolView v    = pool.view();
+    while (pool.state.live < N) {
+        int32_t vel = sparkBenchRng.range(-(30 << 16), 30 << 16) / 1000;
+        sparkSpawn(v, (int32_t)sparkBenchRng.below(SPARK_STRIP << 16), vel, (uint8_t)sparkBenchRng.next(),
+                   (uint16_t)sparkBenchRng.range(0x8000, 0xFFFF), (uint32_t)sparkBenchRng.range(100, 1000));
+    }
+}
+
+template <int N>
+static void sparkPoolSetup() {
+    hsvPaletteBuild(sparkBenchPalette, MAGIC_SPARK_SATURATION, 255);
+    sparkBenchRng.seed(1);
+    sparkClear(sparkBenchPool<N>().view());
+    sparkRefill<N>();
+}
+
+template <int N>
+static void sparkPoolOp() {
+    SparkPoolView v = sparkBenchPool<N>().view();
+    sparkStep(v, 1 << 16, SPARK_STRIP);
+    fill_solid(sparkBenchLeds, SPARK_STRIP, CRGB::Black);
+    sparkRender(v, sparkBenchPalette, sparkBenchLeds, SPARK_STRIP);
+    sparkRefill<N>();
+    benchSink = sparkBenchLeds[SPARK_STRIP / 2].r;
+}
+
+// log: the render task's [CANDLE] diagnostic captured and pushed into a
+// private ring, as `bench log` times it. Each call fills the ring and then
+// pops it empty unformatted, so ns/op is one capture + push plus one pop.
+static LogQueue logBenchRing;
+static uint32_t logBenchN;
+
+static void logCaptureOp() {
+    static const char* FMT = "mode=%-7s  dt=%6.3f  level=%.3f  W1=%u  W2=%u  red=%u%s";
+    LogRecord r;
+    for (size_t i = 0; i < LOG_RING; i++) {
+        uint32_t n = logBenchN++;
+        logCapture(r, LOG_CANDLE, LOG_INFO, FMT, "FLICKER", 1.0f + n * 1e-4f, 0.5f,
+                   (unsigned)n, (unsigned)(n + 1), (unsigned)(n & 0xFF), "");
+        logBenchRing.push(r);
+    }
+    while (logBenchRing.pop(r)) benchSink = r.tUs + r.argc;
+}
+
+// hsv: hsv2rgb_rainbow over a strip of N pixels, as fill_rainbow does
+static constexpr int HSV_MAX_LEDS = 1000;
+static CRGB          hsvLeds[HSV_MAX_LEDS];
+static uint8_t       hsvHue;
+
+template <int N>
+static void hsvFillOp() {
+    static_assert(N <= HSV_MAX_LEDS, "raise HSV_MAX_LEDS");
+    uint8_t hue = hsvHue++;
+    for (int i = 0; i < N; i++) {
+        hsv2rgb_rainbow(CHSV(hue, 240, 200), hsvLeds[i]);
+        hue += 7;
+    }
+    benchSink = hsvLeds[N - 1].r;
+}
+
+// ─── Registry ─────────────────────────────────────────────────────────────────
+
+struct BenchCase {
+    const char* name;
+    const char* description;
+    uint32_t    opsPerCall;   // op() does this many units of work; ns/op is per unit
+    void (*setup)();
+    void (*op)();
+    void (*teardown)();
+};
+
+static const BenchCase CASES[] = {
+    {"noise/sample",      "candle noise wavetable sample, phase to level",  NOISE_SAMPLES, noiseSetup, noiseOp, nullptr},
+    {"candle/pick",       "pickNextSubMode(), weighted sub-mode choice",    PICKS, pickSetup, pickOp, nullptr},
+    {"candle/step",       "candleStep(), one fixed-point flame",            1, stepSetup, stepOp, nullptr},
+    {"mode/candle",       "updateCandleMode(), one frame",                  1, candleSetup, modeFrame, modeEnd},
+    {"mode/color",        "updateColorMode(), one frame",                   1, colorSetup, modeFrame, modeEnd},
+    {"mode/magic_drift",  "updateMagicMode(), one DRIFT frame",             1, driftSetup, modeFrame, modeEnd},
+    {"mode/magic_spark",  "updateMagicMode(), one SPARK frame",             1, sparkSetup, modeFrame, modeEnd},
+    {"xfade/blend",       "frameBlend(), pixels and duties",                1, blendSetup, blendOp, nullptr},
+    {"xfade/to_color",    "Candle -> Color crossfade frame, both engines",  1, candleColorSetup, pairOp, pairEnd},
+    {"xfade/to_magic",    "Color -> Magic crossfade frame, both engines",   1, colorMagicSetup, pairOp, pairEnd},
+    {"xfade/to_candle",   "Magic -> Candle crossfade frame, both engines",  1, magicCandleSetup, pairOp, pairEnd},
+    {"spark/pool_1000",   "spark step + render + respawn, 1000 particles", 1000, sparkPoolSetup<1000>, sparkPoolOp<1000>, nullptr},
+    {"spark/pool_4000",   "spark step + render + respawn, 4000 particles", 4000, sparkPoolSetup<4000>, sparkPoolOp<4000>, nullptr},
+    {"log/capture_push",  "logCapture() + ring push, [CANDLE] record",      LOG_RING, nullptr, logCaptureOp, nullptr},
+    {"hsv/fill_20",       "hsv2rgb_rainbow fill, 20 pixels",                1, nullptr, hsvFillOp<20>, nullptr},
+    {"hsv/fill_60",       "hsv2rgb_rainbow fill, 60 pixels",                1, nullptr, hsvFillOp<60>, nullptr},
+    {"hsv/fill_144",      "hsv2rgb_rainbow fill, 144 pixels",               1, nullptr, hsvFillOp<144>, nullptr},
+    {"hsv/fill_300",      "hsv2rgb_rainbow fill, 300 pixels",               1, nullptr, hsvFillOp<300>, nullptr},
+    {"hsv/fill_1000",     "hsv2rgb_rainbow fill, 1000 pixels",              1, nullptr, hsvFillOp<1000>, nullptr},
+};
+
+// ─── Harness ──────────────────────────────────────────────────────────────────
+
+struct Options {
+    const char* filter   = nullptr;   // substring of the case name
+    const char* jsonPath = nullptr;
+    int         reps     = 15;
+    int         warmupMs = 200;
+    int         repMs    = 50;
+};
+
+struct Result {
+    const BenchCase* c;
+    uint64_t         callsPerRep;
+    double           medianNs, minNs, meanNs, stddevNs;   // per op
+};
+
+static uint64_t elapsedNs(BenchClock::time_point since) {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(BenchClock::now() - since).count();
+}
+
+// Warm up for warmupMs, which also sizes one repetition to about repMs,
+// then time `reps` repetitions of that many calls.
+static Result runCase(const BenchCase& c, const Options& opt) {
+    if (c.setup) c.setup();
+
+    const uint64_t warmNs = (uint64_t)opt.warmupMs * 1000000;
+    uint64_t       calls  = 0;
+    uint64_t       spent  = 0;
+    auto           t0     = BenchClock::now();
+    while (spent < warmNs) {
+        c.op();
+        calls++;
+        if ((calls & 15) == 0 || calls < 16) spent = elapsedNs(t0);
+    }
+    spent = elapsedNs(t0);
+    uint64_t perRep = (uint64_t)((double)opt.repMs * 1e6 * calls / (double)spent);
+    if (perRep == 0) perRep = 1;
+
+    std::vector<double> ns;
+    for (int r = 0; r < opt.reps; r++) {
+        auto start = BenchClock::now();
+        for (uint64_t i = 0; i < perRep; i++) c.op();
+        ns.push_back((double)elapsedNs(start) / (double)(perRep * c.opsPerCall));
+    }
+    if (c.teardown) c.teardown();
+
+    std::sort(ns.begin(), ns.end());
+    double sum = 0.0, sumSq = 0.0;
+    for (double v : ns) { sum += v; sumSq += v * v; }
+    double mean = sum / ns.size();
+    double var  = sumSq / ns.size() - mean * mean;
+    size_t mid  = ns.size() / 2;
+    double med  = ns.size() % 2 ? ns[mid] : (ns[mid - 1] + ns[mid]) / 2.0;
+    return {&c, perRep, med, ns.front(), mean, sqrt(var > 0.0 ? var : 0.0)};
+}
+
+static bool writeJson(const char* path, const Options& opt, const std::vector<Result>& results) {
+    FILE* f = fopen(path, "w");
+    if (!f) return false;
+    fprintf(f, "{\n  \"schema\": 1,\n");
+    fprintf(f, "  \"harness\": {\"reps\": %d, \"warmup_ms\": %d, \"rep_ms\": %d, \"compiler\": \"%s\"},\n",
+            opt.reps, opt.warmupMs, opt.repMs, __VERSION__);
+    fprintf(f, "  \"benchmarks\": [\n");
+    for (size_t i = 0; i < results.size(); i++) {
+        const Result& r = results[i];
+        fprintf(f, "    {\"name\": \"%s\", \"description\": \"%s\", \"ops_per_call\": %lu, "
+                   "\"calls_per_rep\": %llu, \"reps\": %d, \"median_ns\": %.3f, \"min_ns\": %.3f, "
+                   "\"mean_ns\": %.3f, \"stddev_ns\": %.3f}%s\n",
+                r.c->name, r.c->description, (unsigned long)r.c->opsPerCall,
+                (unsigned long long)r.callsPerRep, opt.reps, r.medianNs, r.minNs, r.meanNs, r.stddevNs,
+                i + 1 < results.size() ? "," : "");
+    }
+    fprintf(f, "  ]\n}\n");
+    return fclose(f) == 0;
+}
+
+static void usage(const char* argv0) {
+    fprintf(stderr,
+            "usage: %s [--list] [--filter TEXT] [--reps N] [--warmup-ms N] [--rep-ms N] [--json PATH]\n",
+            argv0);
+}
+
+int main(int argc, char** argv) {
+    Options opt;
+    bool    list = false;
+    for (int i = 1; i < argc; i++) {
+        const char* a    = argv[i];
+        bool        more = i + 1 < argc;
+        if      (strcmp(a, "--list") == 0)              list         = true;
+        else if (strcmp(a, "--filter") == 0 && more)    opt.filter   = argv[++i];
+        else if (strcmp(a, "--json") == 0 && more)      opt.jsonPath = argv[++i];
+        else if (strcmp(a, "--reps") == 0 && more)      opt.reps     = atoi(argv[++i]);
+        else if (strcmp(a, "--warmup-ms") == 0 && more) opt.warmupMs = atoi(argv[++i]);
+        else if (strcmp(a, "--rep-ms") == 0 && more)    opt.repMs    = atoi(argv[++i]);
+        else { usage(argv[0]); return 2; }
+    }
+    if (opt.reps < 1 || opt.warmupMs < 1 || opt.repMs < 1) { usage(argv[0]); return 2; }
+
+    if (list) {
+        for (const auto& c : CASES) printf("%-18s %s\n", c.name, c.description);
+        return 0;
+    }
+
+    // Boot precompute (noise table, palettes) exactly as on the device; its
+    // banner goes to stderr with the rest of the shimmed Serial output.
+    setup();
+
+    printf("%-18s %12s %12s %9s %12s\n", "benchmark", "median ns/op", "min ns/op", "stddev", "calls/rep");
+    std::vector<Result> results;
+    for (const auto& c : CASES) {
+        if (opt.filter && !strstr(c.name, opt.filter)) continue;
+        Result r = runCase(c, opt);
+        printf("%-18s %12.2f %12.2f %8.1f%% %12llu\n", c.name, r.medianNs, r.minNs,
+               r.medianNs > 0.0 ? 100.0 * r.stddevNs / r.medianNs : 0.0, (unsigned long long)r.callsPerRep);
+        fflush(stdout);
+        results.push_back(r);
+    }
+    if (results.empty()) {
+        fprintf(stderr, "no benchmark matches \"%s\"\n", opt.filter);
+        return 2;
+    }
+
+    if (opt.jsonPath) {
+        if (!writeJson(opt.jsonPath, opt, results)) {
+            fprintf(stderr, "cannot write %s\n", opt.jsonPath);
+            return 1;
+        }
+        printf("wrote %s\n", opt.jsonPath);
+    }
+    return 0;
+}
+
+#endif   // PIO_UNIT_TESTING
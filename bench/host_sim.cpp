@@ -0,0 +1,83 @@
+#ifndef PIO_UNIT_TESTING   // `pio test` links src/ with each test's own main()
+
+#include <Arduino.h>
+#include <string>
+#include "config.h"
+#include "frame.h"
+#include "sim.h"
+
+// ─── Host simulation driver ──────────────────────────────────────────────────
+//
+// The virtual-clock simulation (src/sim.cpp) on the build machine: PlatformIO
+// env:native_sim, Arduino and FastLED from bench/shim. Takes the same
+// arguments as the device `sim` command and writes the CSV trace to a file
+// (or stdout with `-o -`), where tools/trace_encode.py reads it directly:
+//
+//   .pio/build/native_sim/program 0 24h csv=20 seed=7 -o candle.csv
+//   .pio/build/native_sim/program 0 60d start=1193h
+//
+// The summary goes to stderr with the rest of the shimmed Serial output.
+// `csv=` without `-o` writes the trace to stdout; `-o` without `csv=` traces
+// every frame.
+
+void setup();
+
+struct FileTrace {
+    FILE*    out;
+    uint32_t everyMs;
+    uint64_t nextMs = 0;
+};
+
+static bool fileTraceFrame(uint64_t tUs, const Frame& frame, void* ctx) {
+    FileTrace& t = *static_cast<FileTrace*>(ctx);
+    uint64_t tMs = tUs / 1000;
+    if (tMs >= t.nextMs) {
+        char row[32 + NUM_LEDS * 6];
+        size_t len = simFormatCsvRow(row, sizeof(row), tMs, frame);
+        row[len++] = '\n';
+        if (fwrite(row, 1, len, t.out) != len) return false;
+        t.nextMs = tMs + t.everyMs;
+    }
+    return true;
+}
+
+static void usage(const char* argv0) {
+    fprintf(stderr,
+            "usage: %s <0-%d> <n>[s|m|h|d] [fps=10-10000] [csv=<ms>] [seed=<n>] [start=<n>[s|m|h|d]]\n"
+            "          [-o <trace.csv>|-]\n",
+            argv0, NUM_MODES - 1);
+}
+
+int main(int argc, char** argv) {
+    // Everything but -o is the device command's argument string
+    std::string args;
+    const char* outPath = nullptr;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) { outPath = argv[++i]; continue; }
+        if (!args.empty()) args += ' ';
+        args += argv[i];
+    }
+    SimOptions opt;
+    if (!simParseArgs(args.c_str(), opt)) { usage(argv[0]); return 2; }
+    if (outPath && !opt.csvEveryMs) opt.csvEveryMs = 1000 / opt.fps ? 1000 / opt.fps : 1;
+
+    // Boot precompute (noise table, palettes) exactly as on the device
+    setup();
+
+    FileTrace trace{nullptr, opt.csvEveryMs};
+    if (opt.csvEveryMs) {
+        trace.out = (!outPath || strcmp(outPath, "-") == 0) ? stdout : fopen(outPath, "w");
+        if (!trace.out) { fprintf(stderr, "cannot write %s\n", outPath); return 1; }
+        fprintf(trace.out, "%s\n", SIM_CSV_HEADER);
+    }
+
+    simPrintHeader(opt);
+    SimResult r = simExecute(opt, trace.out ? fileTraceFrame : nullptr, &trace);
+    simPrintSummary(opt, r);
+
+    if (trace.out && trace.out != stdout && fclose(trace.out) != 0) r.aborted = true;
+    if (r.aborted) { fprintf(stderr, "trace write failed\n"); return 1; }
+    return 0;
+}
+
+#endif   // PIO_UNIT_TESTING
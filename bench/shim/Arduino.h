@@ -0,0 +1,143 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+#include <math.h>
+#include <stdarg.h>
+#include <chrono>
+#include <thread>
+
+// ─── Host Arduino shim ───────────────────────────────────────────────────────
+//
+// Just enough of the Arduino-ESP32 core for src/ to build and run on a
+// desktop for the native benchmark target (bench/host_bench.cpp). Time is the
+// host's steady clock, GPIO and LEDC calls do nothing, FreeRTOS tasks are
+// never started, and Serial writes to stderr so stdout stays the benchmark
+// report. ESP32 is not defined, so src/ takes its host paths (timebase,
+// LED sink, trace storage).
+
+#define HIGH         1
+#define LOW          0
+#define INPUT        0
+#define OUTPUT       1
+#define INPUT_PULLUP 2
+
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define PROGMEM
+
+// ── Time ──────────────────────────────────────────────────────────────────────
+
+inline uint64_t hostMicros64() {
+    using namespace std::chrono;
+    static const steady_clock::time_point t0 = steady_clock::now();
+    return (uint64_t)duration_cast<microseconds>(steady_clock::now() - t0).count();
+}
+
+inline unsigned long micros() { return (unsigned long)(uint32_t)hostMicros64(); }
+inline unsigned long millis() { return (unsigned long)(uint32_t)(hostMicros64() / 1000); }
+inline void delay(uint32_t ms) { std::this_thread::sleep_for(std::chrono::milliseconds(ms)); }
+inline void delayMicroseconds(uint32_t us) { std::this_thread::sleep_for(std::chrono::microseconds(us)); }
+inline void yield() {}
+
+// ── Arduino helpers ───────────────────────────────────────────────────────────
+
+inline long random(long howsmall, long howbig) { return howbig > howsmall ? howsmall + rand() % (howbig - howsmall) : howsmall; }
+inline long random(long howbig) { return howbig > 0 ? rand() % howbig : 0; }
+inline void randomSeed(unsigned long seed) { srand((unsigned)seed); }
+
+template <typename T, typename L, typename H>
+inline auto constrain(T x, L lo, H hi) -> decltype(x + lo + hi) {
+    return x < lo ? lo : x > hi ? hi : x;
+}
+
+// ── Pins and PWM ──────────────────────────────────────────────────────────────
+
+inline void pinMode(uint8_t, uint8_t) {}
+inline void digitalWrite(uint8_t, uint8_t) {}
+inline int  digitalRead(uint8_t) { return HIGH; }   // button released
+inline bool ledcAttach(uint8_t, uint32_t, uint8_t) { return true; }
+inline bool ledcWrite(uint8_t, uint32_t) { return true; }
+inline bool ledcFade(uint8_t, uint32_t, uint32_t, int) { return true; }
+
+// ── Chip ──────────────────────────────────────────────────────────────────────
+
+inline uint32_t getCpuFrequencyMhz() { return 240; }
+inline float    temperatureRead() { return 40.0f; }
+inline uint32_t esp_random() { return ((uint32_t)rand() << 16) ^ (uint32_t)rand(); }
+
+struct EspClass {
+    const char* getChipModel() { return "host"; }
+    int         getChipRevision() { return 0; }
+    int         getChipCores() { return 1; }
+    uint32_t    getFlashChipSize() { return 4u << 20; }
+    uint32_t    getFreeHeap() { return 256u << 10; }
+    uint32_t    getMinFreeHeap() { return 256u << 10; }
+    uint32_t    getCycleCount() { return (uint32_t)(hostMicros64() * getCpuFrequencyMhz()); }
+};
+inline EspClass ESP;
+
+// ── Serial ────────────────────────────────────────────────────────────────────
+
+struct HostSerial {
+    void   begin(unsigned long) {}
+    int    available() { return 0; }
+    int    read() { return -1; }
+    size_t read(uint8_t*, size_t) { return 0; }
+    int    availableForWrite() { return 256; }
+    void   flush() { fflush(stderr); }
+
+    size_t printf(const char* fmt, ...) __attribute__((format(printf, 2, 3))) {
+        va_list ap;
+        va_start(ap, fmt);
+        int n = vfprintf(stderr, fmt, ap);
+        va_end(ap);
+        return n < 0 ? 0 : (size_t)n;
+    }
+    size_t print(const char* s) { return fputs(s, stderr) < 0 ? 0 : strlen(s); }
+    size_t print(char c) { return fputc(c, stderr) < 0 ? 0 : 1; }
+    size_t print(int v) { return printf("%d", v); }
+    size_t print(unsigned v) { return printf("%u", v); }
+    size_t print(long v) { return printf("%ld", v); }
+    size_t print(unsigned long v) { return printf("%lu", v); }
+    size_t print(double v, int digits = 2) { return printf("%.*f", digits, v); }
+    size_t println() { return print('\n'); }
+    template <typename T> size_t println(T v) { size_t n = print(v); return n + println(); }
+    size_t write(uint8_t c) { return print((char)c); }
+    size_t write(const uint8_t* b, size_t n) { return fwrite(b, 1, n, stderr); }
+};
+inline HostSerial Serial;
+
+// ── FreeRTOS ──────────────────────────────────────────────────────────────────
+//
+// Nothing here runs concurrently: tasks are accepted and never started, so
+// the benchmarks drive the engines from one thread.
+
+typedef void*    TaskHandle_t;
+typedef int      BaseType_t;
+typedef unsigned UBaseType_t;
+typedef uint32_t TickType_t;
+typedef int      portMUX_TYPE;
+
+#define pdTRUE                     1
+#define pdFALSE                    0
+#define pdPASS                     1
+#define pdMS_TO_TICKS(ms)          ((TickType_t)(ms))
+#define portMAX_DELAY              0xFFFFFFFFu
+#define portMUX_INITIALIZER_UNLOCKED 0
+#define tskIDLE_PRIORITY           0
+#define ARDUINO_RUNNING_CORE       1
+
+inline BaseType_t xTaskCreatePinnedToCore(void (*)(void*), const char*, uint32_t, void*,
+                                          UBaseType_t, TaskHandle_t*, BaseType_t) { return pdPASS; }
+inline void        vTaskDelay(TickType_t) {}
+inline TickType_t  xTaskGetTickCount() { return (TickType_t)millis(); }
+inline BaseType_t  xPortGetCoreID() { return 0; }
+inline BaseType_t  xTaskNotifyGive(TaskHandle_t) { return pdPASS; }
+inline uint32_t    ulTaskNotifyTake(BaseType_t, TickType_t) { return 1; }
+inline void        portENTER_CRITICAL(portMUX_TYPE*) {}
+inline void        portEXIT_CRITICAL(portMUX_TYPE*) {}
@@ -0,0 +1,221 @@
+#pragma once
+#include <Arduino.h>
+
+// ─── Host FastLED shim ───────────────────────────────────────────────────────
+//
+// The part of FastLED that src/ uses on its host paths. The pixel maths the
+// engines spend their time in — scale8, sin8/sin16, hsv2rgb_rainbow,
+// HeatColor — are ports of FastLED's portable C versions (FASTLED_SCALE8_FIXED),
+// so host timings and colours track the device. inoise8 is NOT FastLED's
+// Perlin noise: it only fills the noise wavetable at boot, so any smooth
+// periodic 0–255 signal will do. There is no strip output.
+
+typedef uint8_t fract8;
+
+// ── 8-bit maths ───────────────────────────────────────────────────────────────
+
+inline uint8_t scale8(uint8_t i, fract8 scale) {
+    return (uint8_t)(((uint16_t)i * (1 + (uint16_t)scale)) >> 8);
+}
+
+inline uint8_t scale8_video(uint8_t i, fract8 scale) {
+    return (uint8_t)((((int)i * (int)scale) >> 8) + ((i && scale) ? 1 : 0));
+}
+
+inline uint8_t qadd8(uint8_t i, uint8_t j) {
+    unsigned t = (unsigned)i + j;
+    return t > 255 ? 255 : (uint8_t)t;
+}
+
+inline uint8_t qsub8(uint8_t i, uint8_t j) {
+    int t = (int)i - j;
+    return t < 0 ? 0 : (uint8_t)t;
+}
+
+inline uint8_t sin8(uint8_t theta) {
+    static const uint8_t b_m16_interleave[] = {0, 49, 49, 41, 90, 27, 117, 10};
+    uint8_t offset = theta;
+    if (theta & 0x40) offset = (uint8_t)255 - offset;
+    offset &= 0x3F;
+    uint8_t secoffset = offset & 0x0F;
+    if (theta & 0x40) ++secoffset;
+    const uint8_t* p   = b_m16_interleave + (offset >> 4) * 2;
+    uint8_t        b   = p[0];
+    uint8_t        m16 = p[1];
+    uint8_t        mx  = (uint8_t)((m16 * secoffset) >> 4);
+    int8_t         y   = (int8_t)(mx + b);
+    if (theta & 0x80) y = (int8_t)-y;
+    return (uint8_t)(y + 128);
+}
+
+inline uint8_t cos8(uint8_t theta) { return sin8((uint8_t)(theta + 64)); }
+
+inline int16_t sin16(uint16_t theta) {
+    static const uint16_t base[]  = {0, 6393, 12539, 18204, 23170, 27245, 30273, 32137};
+    static const uint8_t  slope[] = {49, 48, 44, 38, 31, 23, 14, 4};
+    uint16_t offset = (theta & 0x3FFF) >> 3;
+    if (theta & 0x4000) offset = 2047 - offset;
+    uint8_t  section = (uint8_t)(offset / 256);
+    uint8_t  secoff8 = (uint8_t)offset / 2;
+    int16_t  y       = (int16_t)(slope[section] * secoff8 + base[section]);
+    if (theta & 0x8000) y = (int16_t)-y;
+    return y;
+}
+
+inline int16_t cos16(uint16_t theta) { return sin16((uint16_t)(theta + 16384)); }
+
+inline uint8_t inoise8(uint16_t x) {
+    // 65536-unit period, like the real one; range roughly 64–192 like Perlin
+    float t = x * (6.2831853f / 65536.0f);
+    return (uint8_t)(128.0f + 40.0f * sinf(t * 61.0f) + 20.0f * sinf(t * 227.0f + 1.3f) + 4.0f * sinf(t * 1031.0f));
+}
+
+// ── Colours ───────────────────────────────────────────────────────────────────
+
+struct CHSV {
+    union {
+        struct { uint8_t h, s, v; };
+        struct { uint8_t hue, sat, val; };
+        uint8_t raw[3];
+    };
+    CHSV() : h(0), s(0), v(0) {}
+    CHSV(uint8_t ih, uint8_t is, uint8_t iv) : h(ih), s(is), v(iv) {}
+};
+
+struct CRGB;
+void hsv2rgb_rainbow(const CHSV& hsv, CRGB& rgb);
+
+struct CRGB {
+    union {
+        struct { uint8_t r, g, b; };
+        uint8_t raw[3];
+    };
+
+    enum HTMLColorCode : uint32_t {
+        Black = 0x000000, White = 0xFFFFFF, Red = 0xFF0000, Green = 0x008000, Blue = 0x0000FF,
+        Yellow = 0xFFFF00, Cyan = 0x00FFFF, Magenta = 0xFF00FF, Orange = 0xFFA500,
+        Purple = 0x800080, DeepPink = 0xFF1493, Amber = 0xFFBF00,
+    };
+
+    CRGB() : r(0), g(0), b(0) {}
+    CRGB(uint8_t ir, uint8_t ig, uint8_t ib) : r(ir), g(ig), b(ib) {}
+    CRGB(uint32_t code) : r((uint8_t)(code >> 16)), g((uint8_t)(code >> 8)), b((uint8_t)code) {}
+    CRGB(HTMLColorCode code) : CRGB((uint32_t)code) {}
+    CRGB(const CHSV& hsv) { hsv2rgb_rainbow(hsv, *this); }
+
+    CRGB& operator=(const CHSV& hsv) { hsv2rgb_rainbow(hsv, *this); return *this; }
+
+    uint8_t&       operator[](int i) { return raw[i]; }
+    const uint8_t& operator[](int i) const { return raw[i]; }
+
+    CRGB& nscale8(uint8_t scale) {
+        r = scale8(r, scale); g = scale8(g, scale); b = scale8(b, scale);
+        return *this;
+    }
+    CRGB& nscale8_video(uint8_t scale) {
+        r = scale8_video(r, scale); g = scale8_video(g, scale); b = scale8_video(b, scale);
+        return *this;
+    }
+    CRGB& fadeToBlackBy(uint8_t amount) { return nscale8((uint8_t)(255 - amount)); }
+
+    CRGB& operator+=(const CRGB& o) {
+        r = qadd8(r, o.r); g = qadd8(g, o.g); b = qadd8(b, o.b);
+        return *this;
+    }
+    CRGB& operator-=(const CRGB& o) {
+        r = qsub8(r, o.r); g = qsub8(g, o.g); b = qsub8(b, o.b);
+        return *this;
+    }
+
+    bool operator==(const CRGB& o) const { return r == o.r && g == o.g && b == o.b; }
+    bool operator!=(const CRGB& o) const { return !(*this == o); }
+};
+
+inline CRGB operator+(const CRGB& a, const CRGB& b) { CRGB t = a; t += b; return t; }
+inline CRGB operator-(const CRGB& a, const CRGB& b) { CRGB t = a; t -= b; return t; }
+
+// FastLED's "rainbow" hue map (hsv2rgb.cpp): yellow gets a wider band than
+// in a plain spectrum, then saturation and value are applied with the
+// video-safe scaling.
+inline void hsv2rgb_rainbow(const CHSV& hsv, CRGB& rgb) {
+    uint8_t hue = hsv.hue, sat = hsv.sat, val = hsv.val;
+    uint8_t offset8 = (uint8_t)((hue & 0x1F) << 3);
+    uint8_t third   = scale8(offset8, 256 / 3);
+    uint8_t r, g, b;
+
+    if (!(hue & 0x80)) {
+        if (!(hue & 0x40)) {
+            if (!(hue & 0x20)) { r = 255 - third; g = third; b = 0; }                  // R → O
+            else               { r = 171; g = 85 + third; b = 0; }                     // O → Y
+        } else {
+            if (!(hue & 0x20)) {                                                       // Y → G
+                uint8_t twothirds = scale8(offset8, (256 * 2) / 3);
+                r = 171 - twothirds; g = 170 + third; b = 0;
+            } else             { r = 0; g = 255 - third; b = third; }                  // G → A
+        }
+    } else {
+        if (!(hue & 0x40)) {
+            if (!(hue & 0x20)) {                                                       // A → B
+                uint8_t twothirds = scale8(offset8, (256 * 2) / 3);
+                r = 0; g = 171 - twothirds; b = 85 + twothirds;
+            } else             { r = third; g = 0; b = 255 - third; }                  // B → P
+        } else {
+            if (!(hue & 0x20)) { r = 85 + third; g = 0; b = 171 - third; }             // P → K
+            else               { r = 170 + third; g = 0; b = 85 - third; }             // K → R
+        }
+    }
+
+    if (sat != 255) {
+        if (sat == 0) {
+            r = g = b = 255;
+        } else {
+            uint8_t desat    = scale8_video(255 - sat, 255 - sat);
+            uint8_t satscale = 255 - desat;
+            r = scale8(r, satscale) + desat;
+            g = scale8(g, satscale) + desat;
+            b = scale8(b, satscale) + desat;
+        }
+    }
+
+    if (val != 255) {
+        val = scale8_video(val, val);
+        if (val == 0) {
+            r = g = b = 0;
+        } else {
+            r = scale8(r, val); g = scale8(g, val); b = scale8(b, val);
+        }
+    }
+
+    rgb.r = r; rgb.g = g; rgb.b = b;
+}
+
+inline void fill_solid(CRGB* leds, int n, const CRGB& color) {
+    for (int i = 0; i < n; i++) leds[i] = color;
+}
+
+inline void fill_rainbow(CRGB* leds, int n, uint8_t initialHue, uint8_t deltaHue = 5) {
+    CHSV hsv(initialHue, 240, 255);
+    for (int i = 0; i < n; i++) {
+        hsv2rgb_rainbow(hsv, leds[i]);
+        hsv.hue += deltaHue;
+    }
+}
+
+inline CRGB HeatColor(uint8_t temperature) {
+    uint8_t t192     = scale8_video(temperature, 191);
+    uint8_t heatramp = (uint8_t)((t192 & 0x3F) << 2);
+    if (t192 & 0x80) return CRGB(255, 255, heatramp);   // hottest third
+    if (t192 & 0x40) return CRGB(255, heatramp, 0);     // middle
+    return CRGB(heatramp, 0, 0);                        // coolest
+}
+
+// ── Controller ────────────────────────────────────────────────────────────────
+
+struct CFastLED {
+    uint8_t brightness = 255;
+    void    setBrightness(uint8_t scale) { brightness = scale; }
+    uint8_t getBrightness() const { return brightness; }
+    void    show() {}
+    void    show(uint8_t) {}
+};
+inline CFastLED FastLED;
@@ -0,0 +1,824 @@
+#include <new>
+#include <FastLED.h>
+#include "bench.h"
+#include "config.h"
+#include "noise_table.h"
+#include "candle.h"
+#include "candle_bank.h"
+#include "color_strip.h"
+#include "magic_drift.h"
+#include "sparks.h"
+#include "frame.h"
+#include "timebase.h"
+#include "types.h"
+#include "fixed_point.h"
+#include "prng.h"
+#include "led_sink.h"
+#include "strip_segments.h"
+#include "pwm_keyframe.h"
+#include "trace.h"
+#include "stream.h"
+#include "log.h"
+
+// ─── Helpers ──────────────────────────────────────────────────────────────────
+
+static inline uint32_t cycles() { return ESP.getCycleCount(); }
+
+// Written by every kernel so the compiler cannot drop the work being timed.
+static volatile uint32_t benchSink;
+
+// ─── noise: inoise8 path vs interpolated wavetable ───────────────────────────
+
+// The candle sampler as it was before the wavetable: truncate the float axis,
+// call inoise8, rescale with multiply/divide/clamp.
+static uint8_t legacyNoise(float t) {
+    int raw = (int)inoise8((uint32_t)t & 0xFFFF);
+    raw = (raw - 64) * 255 / 128;
+    return (uint8_t)constrain(raw, 0, 255);
+}
+
+static void benchNoise() {
+    static constexpr int N = 4096;
+
+    // Cycles per sample at FLICKER speed with 1 ms steps
+    float    t   = 1234.0f;
+    uint32_t acc = 0;
+    uint32_t c0  = cycles();
+    for (int i = 0; i < N; i++) { acc += legacyNoise(t); t += CANDLE_FLICKER_SPEED; }
+    uint32_t legacyCyc = cycles() - c0;
+    benchSink = acc;
+
+    t = 1234.0f; acc = 0;
+    c0 = cycles();
+    for (int i = 0; i < N; i++) { acc += noiseSample(noisePhaseFromUnits(t)); t += CANDLE_FLICKER_SPEED; }
+    uint32_t tableCyc = cycles() - c0;
+    benchSink = acc;
+
+    // Engines that keep a uint32_t phase skip the float conversion entirely
+    uint32_t phase = noisePhaseFromUnits(1234.0f);
+    uint32_t step  = noisePhaseFromUnits(CANDLE_FLICKER_SPEED);
+    acc = 0;
+    c0 = cycles();
+    for (int i = 0; i < N; i++) { acc += noiseSample(phase); phase += step; }
+    uint32_t phaseCyc = cycles() - c0;
+    benchSink = acc;
+
+    Serial.printf("[BENCH] noise  cyc/sample  inoise8=%lu  table=%lu  table+phase=%lu  (x%.1f)\n",
+        (unsigned long)(legacyCyc / N), (unsigned long)(tableCyc / N),
+        (unsigned long)(phaseCyc / N), (float)legacyCyc / (float)(phaseCyc ? phaseCyc : 1));
+
+    // Smoothness: 10 s of 1 ms frames at CALM speed. "held" counts frames whose
+    // output did not move at all (stair-steps the smoother has to hide).
+    static constexpr int FRAMES = 10000;
+    float legacyPrev = legacyNoise(0.0f), tablePrev = noiseSample(0) / 256.0f;
+    float legacyMax = 0, tableMax = 0;
+    int   legacyHeld = 0, tableHeld = 0;
+    t = 0.0f;
+    for (int i = 1; i <= FRAMES; i++) {
+        t += CANDLE_CALM_SPEED;
+        float l = legacyNoise(t);
+        float v = noiseSample(noisePhaseFromUnits(t)) / 256.0f;
+        if (l == legacyPrev) legacyHeld++;
+        if (v == tablePrev)  tableHeld++;
+        legacyMax = fmaxf(legacyMax, fabsf(l - legacyPrev));
+        tableMax  = fmaxf(tableMax,  fabsf(v - tablePrev));
+        legacyPrev = l; tablePrev = v;
+    }
+    Serial.printf("[BENCH] noise  calm @1ms  inoise8: held=%.1f%% maxstep=%.2f   "
+                  "table: held=%.1f%% maxstep=%.2f  (0-255 scale)\n",
+        100.0f * legacyHeld / FRAMES, legacyMax, 100.0f * tableHeld / FRAMES, tableMax);
+}
+
+// ─── candle: fixed-point engine vs float reference ───────────────────────────
+
+// Two minutes of simulated frames with jittered dt, both engines driven by the
+// same scheduler decisions. The fixed engine's noise phases are re-synced from
+// the reference's float axes every frame, so float accumulation drift in the
+// reference is not counted as error — only the per-step arithmetic is.
+static void benchCandle() {
+    static constexpr int FRAMES = 60000;
+    static constexpr uint32_t DT_US[] = {300, 1000, 1000, 1000, 2500, 5000};
+    static constexpr int DT_COUNT = sizeof(DT_US) / sizeof(DT_US[0]);
+
+    CandleSchedule sched;
+    CandleRefState ref;
+    CandleState    fix;
+    uint64_t       nowUs = 0;
+    candleScheduleBegin(sched, 0);
+    candleRefBegin(ref);
+    candleSyncFromRef(fix, ref);
+
+    uint32_t refCyc = 0, fixCyc = 0;
+    int      maxErr[3] = {0, 0, 0};
+    uint32_t sumErr[3] = {0, 0, 0};
+    int      xfadeFrames = 0, snuffFrames = 0;
+
+    for (int i = 0; i < FRAMES; i++) {
+        uint32_t dtUs = DT_US[random(0, DT_COUNT)];
+        nowUs += dtUs;
+        CandleControl ctl = candleScheduleStep(sched, nowUs);
+        if (ctl.xfading) xfadeFrames++;
+
+        for (int k = 0; k < FLAME_OCTAVES; k++) fix.phOctave[k] = noisePhaseFromUnits(ref.tOctave[k]);
+        fix.phGust  = noisePhaseFromUnits(ref.tGust);
+        fix.phW1    = noisePhaseFromUnits(ref.tW1);
+        fix.phW2    = noisePhaseFromUnits(ref.tW2);
+
+        uint32_t c0 = cycles();
+        CandleDuty r = candleRefStep(ref, ctl, dtUs / 1000.0f);
+        uint32_t c1 = cycles();
+        CandleDuty f = candleStep(fix, ctl, (uint32_t)(((uint64_t)dtUs << 16) / 1000));
+        uint32_t c2 = cycles();
+        refCyc += c1 - c0;
+        fixCyc += c2 - c1;
+        if (ref.snuffW1 < 1.0f || ref.snuffW2 < 1.0f) snuffFrames++;
+
+        int err[3] = {abs((int)r.w1 - (int)f.w1), abs((int)r.w2 - (int)f.w2),
+                      abs((int)r.red - (int)f.red)};
+        for (int ch = 0; ch < 3; ch++) {
+            if (err[ch] > maxErr[ch]) maxErr[ch] = err[ch];
+            sumErr[ch] += err[ch];
+        }
+    }
+    benchSink = fix.outW1;
+
+    Serial.printf("[BENCH] candle cyc/frame  float=%lu  fixed=%lu  (x%.1f)\n",
+        (unsigned long)(refCyc / FRAMES), (unsigned long)(fixCyc / FRAMES),
+        (float)refCyc / (float)(fixCyc ? fixCyc : 1));
+    Serial.printf("[BENCH] candle duty error (counts of %d)  max W1=%d W2=%d red=%d   "
+                  "mean W1=%.2f W2=%.2f red=%.2f\n", MAX_DUTY,
+        maxErr[0], maxErr[1], maxErr[2],
+        (float)sumErr[0] / FRAMES, (float)sumErr[1] / FRAMES, (float)sumErr[2] / FRAMES);
+    Serial.printf("[BENCH] candle coverage  %d frames  %lu ms  xfade=%d  snuffed=%d\n",
+        FRAMES, (unsigned long)(nowUs / 1000), xfadeFrames, snuffFrames);
+}
+
+// ─── bank: CandleBank scaling ────────────────────────────────────────────────
+
+// Cycles per flame should stay flat from a strip-sized bank to one far larger
+// than the data cache; a jump at 3000 would mean the SoA arrays are thrashing.
+template <int N>
+static void benchBankSize() {
+    static constexpr int FRAMES = 100;
+    auto* bank = new (std::nothrow) CandleBank<N>;
+    if (!bank) {
+        Serial.printf("[BENCH] bank   n=%-5d  skipped: %u bytes not available\n",
+                      N, (unsigned)sizeof(CandleBank<N>));
+        return;
+    }
+    CandleBankView v = bank->view();
+    uint64_t nowUs = 0;
+    candleBankBegin(v, nowUs);
+
+    uint32_t c0 = cycles();
+    for (int f = 0; f < FRAMES; f++) {
+        nowUs += 1000;
+        candleBankStep(v, nowUs, Q16_ONE);
+    }
+    uint32_t cyc = cycles() - c0;
+    benchSink = bank->level[N / 2];
+
+    Serial.printf("[BENCH] bank   n=%-5d  cyc/frame=%-8lu cyc/flame=%-5lu  %u B (%u B/flame)\n",
+                  N, (unsigned long)(cyc / FRAMES), (unsigned long)(cyc / FRAMES / N),
+                  (unsigned)sizeof(CandleBank<N>), (unsigned)(sizeof(CandleBank<N>) / N));
+    delete bank;
+}
+
+static void benchBank() {
+    benchBankSize<20>();
+    benchBankSize<300>();
+    benchBankSize<3000>();
+}
+
+// ─── color: colour-mode pixel pipeline ───────────────────────────────────────
+
+// The pixel stage as it was before the pipeline: modulo ring index, HSV
+// conversion per pixel, then the blur run in place with modulo neighbours.
+static void legacyColorRender(const uint8_t* history, int size, int index, const uint8_t* jitter,
+                              CRGB* leds, int n) {
+    for (int i = 0; i < n; i++) {
+        int pos = (index - i + size) % size;
+        leds[i] = CHSV(history[pos] + jitter[i], COLOR_SATURATION, COLOR_BRIGHTNESS);
+    }
+    for (int i = 0; i < n; i++) {
+        int prev = (i - 1 + n) % n;
+        int next = (i + 1) % n;
+        CRGB c = leds[i];    c.nscale8(179);
+        CRGB p = leds[prev]; p.nscale8(38);
+        CRGB q = leds[next]; q.nscale8(38);
+        leds[i] = c + p + q;
+    }
+}
+
+template <int N>
+static void benchColorSize() {
+    static constexpr int FRAMES = 200;
+    struct Buffers {
+        ColorStrip<N> strip;
+        uint8_t       history[N + 5];
+        uint8_t       jitter[N];
+        CRGB          leds[N];
+    };
+    auto* b = new (std::nothrow) Buffers;
+    if (!b) {
+        Serial.printf("[BENCH] color  n=%-5d  skipped: %u bytes not available\n",
+                      N, (unsigned)sizeof(Buffers));
+        return;
+    }
+    Prng rng;
+    rng.seed(1);
+    rng.fill(b->jitter, N, 4);
+    ColorStripView v = b->strip.view();
+    colorStripFill(v, 0);
+    for (int i = 0; i < N + 5; i++) {
+        b->history[i] = (uint8_t)(i * 3);
+        colorStripPush(v, (uint8_t)(i * 3));
+    }
+
+    uint32_t c0 = cycles();
+    for (int f = 0; f < FRAMES; f++) legacyColorRender(b->history, N + 5, f % (N + 5), b->jitter, b->leds, N);
+    uint32_t legacyCyc = cycles() - c0;
+    benchSink = b->leds[N / 2].r;
+
+    c0 = cycles();
+    for (int f = 0; f < FRAMES; f++) colorStripRender(v, b->jitter, b->leds);
+    uint32_t pipeCyc = cycles() - c0;
+    benchSink = b->leds[N / 2].r;
+
+    Serial.printf("[BENCH] color  n=%-5d  cyc/frame  legacy=%-8lu pipeline=%-8lu (x%.1f)  "
+                  "cyc/px %lu -> %lu\n", N,
+                  (unsigned long)(legacyCyc / FRAMES), (unsigned long)(pipeCyc / FRAMES),
+                  (float)legacyCyc / (float)(pipeCyc ? pipeCyc : 1),
+                  (unsigned long)(legacyCyc / FRAMES / N), (unsigned long)(pipeCyc / FRAMES / N));
+    delete b;
+}
+
+static void benchColor() {
+    benchColorSize<20>();
+    benchColorSize<1000>();
+}
+
+// ─── magic: drift ripple ─────────────────────────────────────────────────────
+
+// The drift loop as it was: two sinf() calls, float casts and an HSV
+// conversion per pixel.
+static void legacyMagicDrift(CRGB* leds, int n, float driftHue) {
+    for (int i = 0; i < n; i++) {
+        float ripple = sinf((float)i * 0.45f + driftHue * 0.025f) * 6.0f;
+        uint8_t h = (uint8_t)(int)(driftHue + ripple);
+        uint8_t v = MAGIC_DRIFT_BRIGHTNESS +
+                    (uint8_t)(int)(sinf((float)i * 0.3f + driftHue * 0.018f) * MAGIC_DRIFT_RIPPLE);
+        leds[i] = CHSV(h, 230, v);
+    }
+}
+
+template <int N>
+static void benchMagicSize() {
+    static constexpr int FRAMES = 100;
+    auto* leds = new (std::nothrow) CRGB[2 * N];
+    if (!leds) {
+        Serial.printf("[BENCH] magic  n=%-5d  skipped: %u bytes not available\n",
+                      N, (unsigned)(2 * N * sizeof(CRGB)));
+        return;
+    }
+    CRGB* legacy = leds;
+    CRGB* table  = leds + N;
+
+    float    hue = 170.0f;
+    uint32_t c0  = cycles();
+    for (int f = 0; f < FRAMES; f++) { legacyMagicDrift(legacy, N, hue); hue += 0.37f; }
+    uint32_t legacyCyc = cycles() - c0;
+    benchSink = legacy[N / 2].b;
+
+    hue = 170.0f;
+    c0  = cycles();
+    for (int f = 0; f < FRAMES; f++) { magicDriftRender(table, N, hue); hue += 0.37f; }
+    uint32_t tableCyc = cycles() - c0;
+    benchSink = table[N / 2].b;
+
+    // Both buffers now hold the same final frame: how far apart are they?
+    int maxDiff = 0;
+    for (int i = 0; i < N; i++) {
+        for (int c = 0; c < 3; c++) {
+            int d = abs((int)legacy[i][c] - (int)table[i][c]);
+            if (d > maxDiff) maxDiff = d;
+        }
+    }
+    Serial.printf("[BENCH] magic  n=%-5d  cyc/frame  sinf+hsv=%-8lu table=%-8lu (x%.1f)  "
+                  "max channel diff=%d\n", N,
+                  (unsigned long)(legacyCyc / FRAMES), (unsigned long)(tableCyc / FRAMES),
+                  (float)legacyCyc / (float)(tableCyc ? tableCyc : 1), maxDiff);
+    delete[] leds;
+}
+
+static void benchMagic() {
+    benchMagicSize<20>();
+    benchMagicSize<1000>();
+}
+
+// ─── spark: particle pool ────────────────────────────────────────────────────
+
+// A full pool on a 1000-pixel strip: step + render 500 frames of 1 ms, each
+// particle that dies respawned so the population stays at N. Free heap is
+// read around the timed loop to show the frames allocate nothing.
+template <int N>
+static void benchSparkSize() {
+    static constexpr int FRAMES = 500;
+    static constexpr int STRIP  = 1000;
+    struct Buffers {
+        SparkPool<N> pool;
+        CRGB         palette[256];
+        CRGB         leds[STRIP];
+    };
+    auto* b = new (std::nothrow) Buffers;
+    if (!b) {
+        Serial.printf("[BENCH] spark  n=%-5d  skipped: %u bytes not available\n",
+                      N, (unsigned)sizeof(Buffers));
+        return;
+    }
+    SparkPoolView v = b->pool.view();
+    hsvPaletteBuild(b->palette, MAGIC_SPARK_SATURATION, 255);
+    Prng rng;
+    rng.seed(1);
+    auto refill = [&]() {
+        while (b->pool.state.live < N) {
+            int32_t vel = rng.range(-(30 << 16), 30 << 16) / 1000;
+            sparkSpawn(v, (int32_t)rng.below(STRIP << 16), vel, (uint8_t)rng.next(),
+                       (uint16_t)rng.range(0x8000, 0xFFFF), (uint32_t)rng.range(100, 1000));
+        }
+    };
+    refill();
+
+    uint32_t heap0 = ESP.getFreeHeap();
+    uint32_t stepCyc = 0, renderCyc = 0;
+    for (int f = 0; f < FRAMES; f++) {
+        uint32_t c0 = cycles();
+        sparkStep(v, Q16_ONE, STRIP);
+        uint32_t c1 = cycles();
+        fill_solid(b->leds, STRIP, CRGB::Black);
+        sparkRender(v, b->palette, b->leds, STRIP);
+        renderCyc += cycles() - c1;
+        stepCyc   += c1 - c0;
+        refill();
+    }
+    int32_t heapDelta = (int32_t)(ESP.getFreeHeap() - heap0);
+    benchSink = b->leds[STRIP / 2].r;
+
+    Serial.printf("[BENCH] spark  n=%-5d  cyc/particle step=%-3lu render=%-3lu  %u B/particle  "
+                  "heap delta=%ld  (%lu spawned)\n",
+                  N, (unsigned long)(stepCyc / FRAMES / N), (unsigned long)(renderCyc / FRAMES / N),
+                  (unsigned)((sizeof(SparkPool<N>) - sizeof(SparkPoolState)) / N), (long)heapDelta,
+                  (unsigned long)b->pool.state.spawned);
+    delete b;
+}
+
+static void benchSpark() {
+    benchSparkSize<MAGIC_SPARK_POOL>();
+    benchSparkSize<1000>();
+    benchSparkSize<4000>();
+}
+
+// ─── xfade: frame blend and two-engine crossfade ────────────────────────────
+
+extern const ModeConfig MODES[];
+
+static uint64_t benchClockUs = 0;
+static uint64_t benchClock() { return benchClockUs; }
+
+// Cycles per 1 ms frame for engine a alone, or — when b is a mode — for a
+// and b side by side plus the blend, as Auto runs them while crossfading.
+// Virtual clock, like `sim`, so engines see a steady 1 kHz and stay quiet.
+static uint32_t benchEngines(CandleMode a, CandleMode b, int frames) {
+    static Frame fa, fb, out;
+    bool pair = b != NUM_MODES;
+    benchClockUs = 0;
+    timebaseTick();
+    MODES[a].enterFunction(fa);
+    if (pair) MODES[b].enterFunction(fb);
+
+    uint32_t cyc = 0;
+    for (int f = 0; f < frames; f++) {
+        benchClockUs += 1000;
+        timebaseTick();
+        uint32_t c0 = cycles();
+        MODES[a].updateFunction(fa);
+        if (pair) {
+            MODES[b].updateFunction(fb);
+            frameBlend(fa, fb, (uint16_t)(f * 256 / frames), out);
+        }
+        cyc += cycles() - c0;
+    }
+    MODES[a].exitFunction(fa);
+    if (pair) MODES[b].exitFunction(fb);
+    benchSink = out.leds[0].r + fa.duty[0];
+    return cyc / frames;
+}
+
+static void benchXfade() {
+    static constexpr int FRAMES = 2000;
+    static Frame a, b, out;
+    for (int i = 0; i < NUM_LEDS; i++) {
+        a.leds[i] = CRGB(i * 7, 255 - i, 40);
+        b.leds[i] = CRGB(3, i * 11, 200 - i);
+    }
+    for (int ch = 0; ch < 4; ch++) { a.duty[ch] = 100 * ch; b.duty[ch] = MAX_DUTY - 50 * ch; }
+
+    uint32_t c0 = cycles();
+    for (int f = 0; f < FRAMES; f++) frameBlend(a, b, (uint16_t)(f & 0xFF), out);
+    uint32_t blendCyc = (cycles() - c0) / FRAMES;
+    benchSink = out.leds[NUM_LEDS / 2].g;
+
+    static constexpr CandleMode ENGINES[3] = {CANDLE_MODE, COLOR_MODE, MAGIC_MODE};
+    timebaseSetClock(benchClock);
+    uint32_t single[3];
+    for (int e = 0; e < 3; e++) single[e] = benchEngines(ENGINES[e], NUM_MODES, FRAMES);
+    uint32_t pair[3];
+    for (int e = 0; e < 3; e++) pair[e] = benchEngines(ENGINES[e], ENGINES[(e + 1) % 3], FRAMES);
+    timebaseSetClock(nullptr);
+
+    Serial.printf("[BENCH] xfade  blend %d px + 4 duties: %lu cyc/frame\n",
+        NUM_LEDS, (unsigned long)blendCyc);
+    for (int e = 0; e < 3; e++) {
+        const char* from = MODES[ENGINES[e]].name;
+        const char* to   = MODES[ENGINES[(e + 1) % 3]].name;
+        Serial.printf("[BENCH] xfade  %-6s %6lu cyc/frame   %s+%s crossfade %6lu cyc/frame  (%.1f%% of a 1 ms frame)\n",
+            from, (unsigned long)single[e], from, to, (unsigned long)pair[e],
+            100.0f * pair[e] / (getCpuFrequencyMhz() * 1000.0f));
+    }
+}
+
+// ─── prng: Arduino random() vs engine xorshift ───────────────────────────────
+
+static void benchPrng() {
+    static constexpr int N = 4096;
+    Prng     rng;
+    uint32_t acc = 0;
+    rng.seed(1);
+
+    // A bounded draw, as in the old per-frame snuff and spark rolls
+    uint32_t c0 = cycles();
+    for (int i = 0; i < N; i++) acc += random(0, 1000);
+    uint32_t arduinoCyc = cycles() - c0;
+    benchSink = acc;
+
+    acc = 0;
+    c0 = cycles();
+    for (int i = 0; i < N; i++) acc += rng.below(1000);
+    uint32_t prngCyc = cycles() - c0;
+    benchSink = acc;
+
+    Serial.printf("[BENCH] prng   cyc/draw  random()=%lu  xorshift=%lu  (x%.1f)\n",
+        (unsigned long)(arduinoCyc / N), (unsigned long)(prngCyc / N),
+        (float)arduinoCyc / (float)(prngCyc ? prngCyc : 1));
+
+    // Per-pixel colour jitter for one strip frame
+    static constexpr int FRAMES = 256;
+    uint8_t jitter[NUM_LEDS];
+    acc = 0;
+    c0 = cycles();
+    for (int f = 0; f < FRAMES; f++) {
+        for (int i = 0; i < NUM_LEDS; i++) jitter[i] = (uint8_t)random(0, 4);
+        acc += jitter[f % NUM_LEDS];
+    }
+    arduinoCyc = cycles() - c0;
+    benchSink = acc;
+
+    acc = 0;
+    c0 = cycles();
+    for (int f = 0; f < FRAMES; f++) {
+        rng.fill(jitter, NUM_LEDS, 4);
+        acc += jitter[f % NUM_LEDS];
+    }
+    prngCyc = cycles() - c0;
+    benchSink = acc;
+
+    Serial.printf("[BENCH] prng   cyc/strip jitter (%d px)  random()=%lu  fill=%lu  (x%.1f)\n",
+        NUM_LEDS, (unsigned long)(arduinoCyc / FRAMES), (unsigned long)(prngCyc / FRAMES),
+        (float)arduinoCyc / (float)(prngCyc ? prngCyc : 1));
+
+    // Bucket uniformity over 1000 bins: worst deviation from the expected count
+    static constexpr int BINS = 1000, DRAWS = 200000;
+    static uint16_t bins[BINS];
+    memset(bins, 0, sizeof(bins));
+    for (int i = 0; i < DRAWS; i++) bins[rng.below(BINS)]++;
+    int worst = 0;
+    for (int b = 0; b < BINS; b++) {
+        int dev = abs((int)bins[b] - DRAWS / BINS);
+        if (dev > worst) worst = dev;
+    }
+    Serial.printf("[BENCH] prng   uniformity  %d draws / %d bins  worst bin %+d%%\n",
+        DRAWS, BINS, worst * 100 / (DRAWS / BINS));
+}
+
+// ─── pwm: per-frame ledcWrite vs LEDC keyframe fades ─────────────────────────
+
+// A triangle per channel, offset so all four move on every 1 ms frame — the
+// worst case for per-frame writes.
+static uint16_t benchDuty(uint32_t frame, int ch) {
+    uint32_t p = (frame * 7 + ch * 1000) % 4000;
+    return (uint16_t)(p < 2000 ? p : 4000 - p);
+}
+
+// One second of real time per path, new duties every 1 ms as the render task
+// publishes them, output called once per frame as loop() does. Only cycles
+// spent inside the output path are counted, so the result is the CPU share
+// the PWM costs at 1 kHz.
+static void benchPwm() {
+    static constexpr uint32_t RUN_US = 1000000;
+    LedSink& sink = ledSink();
+    uint16_t duty[4];
+
+    uint32_t writeCyc = 0, writes = 0, frame = 0;
+    uint32_t t0 = micros();
+    for (uint32_t now = t0; now - t0 < RUN_US; now = micros()) {
+        if ((now - t0) / 1000 == frame) continue;
+        frame = (now - t0) / 1000;
+        for (int ch = 0; ch < 4; ch++) duty[ch] = benchDuty(frame, ch);
+        uint32_t c0 = cycles();
+        sink.writeDuties(duty);
+        writeCyc += cycles() - c0;
+        writes   += 4;
+    }
+
+    PwmKeyframer keyframes;
+    uint32_t     keyCyc = 0;
+    frame = 0;
+    t0    = micros();
+    for (uint32_t now = t0; now - t0 < RUN_US; now = micros()) {
+        if ((now - t0) / 1000 == frame) continue;
+        frame = (now - t0) / 1000;
+        for (int ch = 0; ch < 4; ch++) duty[ch] = benchDuty(frame, ch);
+        uint32_t c0 = cycles();
+        keyframes.update(sink, duty, now);
+        keyCyc += cycles() - c0;
+    }
+
+    // Real engine output through the coalescing commit: how many of the
+    // channel commits per frame actually reach the peripheral
+    static constexpr CandleMode ENGINES[3] = {CANDLE_MODE, COLOR_MODE, MAGIC_MODE};
+    static constexpr int        ENGINE_FRAMES = 2000;
+    static Frame f;
+    uint32_t engineWrites[3], engineElided[3];
+    delay(PWM_KEYFRAME_MS);
+    timebaseSetClock(benchClock);
+    for (int e = 0; e < 3; e++) {
+        benchClockUs = 0;
+        timebaseTick();
+        MODES[ENGINES[e]].enterFunction(f);
+        uint32_t w0 = sink.dutyWrites, e0 = sink.dutyElided;
+        for (int i = 0; i < ENGINE_FRAMES; i++) {
+            benchClockUs += 1000;
+            timebaseTick();
+            MODES[ENGINES[e]].updateFunction(f);
+            sink.writeDuties(f.duty);
+        }
+        engineWrites[e] = sink.dutyWrites - w0;
+        engineElided[e] = sink.dutyElided - e0;
+        MODES[ENGINES[e]].exitFunction(f);
+    }
+    timebaseSetClock(nullptr);
+
+    // Leave the outputs as test mode expects
+    static const uint16_t OFF[4] = {0, 0, 0, 0};
+    sink.writeDuties(OFF);
+
+    float cpuHz = getCpuFrequencyMhz() * 1e6f;
+    Serial.printf("[BENCH] pwm    per-frame: %lu writes  %lu cyc/s (%.3f%% CPU)\n",
+        (unsigned long)writes, (unsigned long)writeCyc, 100.0f * writeCyc / cpuHz);
+    Serial.printf("[BENCH] pwm    keyframes @%lu ms: %lu keyframes  %lu fades  %lu cyc/s "
+                  "(%.3f%% CPU)  (x%.1f)\n",
+        (unsigned long)PWM_KEYFRAME_MS, (unsigned long)keyframes.keyframes,
+        (unsigned long)(keyframes.fades + keyframes.jumps), (unsigned long)keyCyc,
+        100.0f * keyCyc / cpuHz, (float)writeCyc / (float)(keyCyc ? keyCyc : 1));
+    for (int e = 0; e < 3; e++) {
+        Serial.printf("[BENCH] pwm    %-6s per-frame commits: %lu written  %lu elided  (%.0f%% elided)\n",
+            MODES[ENGINES[e]].name, (unsigned long)engineWrites[e], (unsigned long)engineElided[e],
+            100.0f * engineElided[e] / (float)(ENGINE_FRAMES * 4));
+    }
+}
+
+// ─── trace: flame trace playback cost ────────────────────────────────────────
+
+// Ten seconds of 1 ms render frames from the trace in flash: the per-frame
+// interpolation plus a decode every 1/rateHz.
+static void benchTrace() {
+    static constexpr int FRAMES = 10000;
+    TracePlayer player;
+    if (!tracePlayerBegin(player, traceFlashSource())) {
+        Serial.printf("[BENCH] trace  skipped: no valid trace in '%s' partition\n", TRACE_PARTITION);
+        return;
+    }
+    uint16_t out[TRACE_CHANNELS];
+    uint32_t acc   = 0;
+    uint32_t first = player.reader.frame();
+    uint32_t c0    = cycles();
+    for (int i = 0; i < FRAMES; i++) {
+        tracePlayerStep(player, 1000, out);
+        acc += out[TRACE_W1];
+    }
+    uint32_t cyc = cycles() - c0;
+    benchSink = acc;
+
+    const TraceHeader& h = player.reader.header();
+    Serial.printf("[BENCH] trace  %u Hz trace  cyc/render frame=%lu  (%lu trace frames decoded, "
+                  "%lu-byte window)\n", h.rateHz, (unsigned long)(cyc / FRAMES),
+                  (unsigned long)(player.reader.frame() - first), (unsigned long)TRACE_READ_BUF);
+}
+
+// ─── strip: segmented WS2812 refresh time ───────────────────────────────────
+
+// Wall time from show() to the last segment latching, against the wire time
+// the same pixels would take on a single pin. Every frame differs so none is
+// skipped. Also the cost of scattering a frame into wire order.
+static void benchStrip() {
+    static constexpr int FRAMES = 50;
+    LedSink& sink = ledSink();
+    static CRGB frame[NUM_LEDS];
+
+    uint32_t totalUs = 0, worstUs = 0;
+    for (int f = 0; f < FRAMES; f++) {
+        fill_solid(frame, NUM_LEDS, CRGB(f + 1, 0, 0));
+        while (sink.stripBusy()) {}
+        uint32_t t0 = micros();
+        sink.show(frame, WS2812_BRIGHTNESS);
+        while (sink.stripBusy()) {}
+        uint32_t us = micros() - t0;
+        totalUs += us;
+        if (us > worstUs) worstUs = us;
+    }
+    fill_solid(frame, NUM_LEDS, CRGB::Black);
+    sink.show(frame, 255);
+    while (sink.stripBusy()) {}
+
+    static CRGB wire[NUM_LEDS];
+    uint32_t c0 = cycles();
+    stripScatter(STRIP_LAYOUT, frame, wire);
+    uint32_t scatterCyc = cycles() - c0;
+    benchSink = wire[0].r;
+
+    Serial.printf("[BENCH] strip  %d LEDs on %d segment(s), longest %u\n",
+        NUM_LEDS, STRIP_SEGMENTS, stripLongestSegment(STRIP_LAYOUT));
+    Serial.printf("[BENCH] strip  refresh us  mean=%lu  worst=%lu  model=%lu  single-pin model=%lu  "
+                  "scatter=%lu cyc\n",
+        (unsigned long)(totalUs / FRAMES), (unsigned long)worstUs,
+        (unsigned long)stripWireUs(STRIP_LAYOUT),
+        (unsigned long)(NUM_LEDS * WS2812_US_PER_PIXEL + WS2812_RESET_US), (unsigned long)scatterCyc);
+}
+
+// ─── stream: binary frame packets through the decoder ───────────────────────
+
+// A loopback of the serial frame stream: FRAMES packets are encoded and fed
+// byte by byte through a StreamDecoder, as streamLinkUpdate() feeds it from
+// the port. Every 50th packet is withheld and every 97th has a byte damaged;
+// the dropped and rejected counts must come out exact and every frame that
+// verifies must match what was sent.
+static void benchStream() {
+    static constexpr int  FRAMES = 1000;
+    static Frame          sent;
+    static uint8_t        wire[streamWireBytes(sizeof(Frame))];
+    static StreamDecoder  dec;
+    const StreamStats     before = dec.stats;
+
+    int      withheld = 0, damaged = 0, mismatched = 0;
+    uint32_t wireBytes = 0, encodeCyc = 0, decodeCyc = 0;
+    for (int i = 0; i < FRAMES; i++) {
+        for (int p = 0; p < NUM_LEDS; p++) sent.leds[p] = CRGB(i + p, i * 3, 255 - i);
+        for (int c = 0; c < 4; c++) sent.duty[c] = (uint16_t)((i * 41 + c * 1000) & 0xFFF);
+
+        uint32_t c0 = cycles();
+        size_t   n  = streamEncode(STREAM_FRAME, (uint16_t)i, &sent, sizeof(sent), wire);
+        encodeCyc += cycles() - c0;
+
+        if (i % 50 == 25) { withheld++; continue; }
+        if (i % 97 == 96) {
+            uint8_t& b = wire[n / 2];
+            b = b == 0xFF ? 0xFE : b + 1;   // any value but the delimiter
+            damaged++;
+        }
+
+        c0 = cycles();
+        for (size_t k = 0; k < n; k++) {
+            if (dec.push(wire[k]) == STREAM_FRAME && memcmp(&dec.frame(), &sent, sizeof(sent)) != 0) {
+                mismatched++;
+            }
+        }
+        decodeCyc += cycles() - c0;
+        wireBytes += n;
+    }
+    benchSink = wireBytes;
+
+    const StreamStats& s = dec.stats;
+    int sentOk = FRAMES - withheld;
+    Serial.printf("[BENCH] stream  %d frames  %lu wire bytes/frame  encode cyc/frame=%lu  "
+                  "decode cyc/frame=%lu\n", FRAMES, (unsigned long)(wireBytes / sentOk),
+        (unsigned long)(encodeCyc / FRAMES), (unsigned long)(decodeCyc / sentOk));
+    // A damaged packet is rejected and then shows up as a seq gap like a withheld one
+    Serial.printf("[BENCH] stream  verified=%lu  dropped=%lu (expect %d)  rejected=%lu (expect %d)  "
+                  "mismatched=%d\n",
+        (unsigned long)(s.frames - before.frames), (unsigned long)(s.dropped - before.dropped),
+        withheld + damaged,
+        (unsigned long)(s.crcErrors + s.badPackets - before.crcErrors - before.badPackets), damaged,
+        mismatched);
+}
+
+// ─── log: hot-path cost of a deferred log call ──────────────────────────────
+
+// The [CANDLE] diagnostic as the render task logs it: formatted on the spot
+// with snprintf (what the Serial.printf it replaced cost before the write
+// even started), against capturing it into a ring for the drain. Also a call
+// whose tag filter rejects it, and the drain's cost to format one record.
+// Records go to a private ring so the real log is left alone.
+static void benchLog() {
+    static constexpr int CALLS = 2000;
+    static LogQueue      ring;
+    static char          line[LOG_LINE_MAX];
+    static const char*   FMT = "mode=%-7s  dt=%6.3f  level=%.3f  W1=%u  W2=%u  red=%u%s";
+    LogRecord r;
+
+    uint32_t c0 = cycles();
+    for (int i = 0; i < CALLS; i++) {
+        benchSink = snprintf(line, sizeof(line), FMT, "FLICKER", 1.0f + i * 1e-4f, 0.5f,
+                             (unsigned)i, (unsigned)(i + 1), (unsigned)(i & 0xFF), "");
+    }
+    uint32_t formatCyc = cycles() - c0;
+
+    uint32_t captureCyc = 0, drainCyc = 0, dropped = 0;
+    for (int done = 0; done < CALLS; done += (int)LOG_RING) {
+        c0 = cycles();
+        for (int i = done; i < done + (int)LOG_RING; i++) {
+            logCapture(r, LOG_CANDLE, LOG_INFO, FMT, "FLICKER", 1.0f + i * 1e-4f, 0.5f,
+                       (unsigned)i, (unsigned)(i + 1), (unsigned)(i & 0xFF), "");
+            if (!ring.push(r)) dropped++;
+        }
+        captureCyc += cycles() - c0;
+
+        c0 = cycles();
+        while (ring.pop(r)) benchSink = logFormat(r, line, sizeof(line));
+        drainCyc += cycles() - c0;
+    }
+    int captured = CALLS / (int)LOG_RING * (int)LOG_RING;
+
+    uint32_t filteredCyc = 0;
+    bool     canFilter   = !logEnabled(LOG_CANDLE, LOG_DEBUG);
+    if (canFilter) {
+        c0 = cycles();
+        for (int i = 0; i < CALLS; i++) {
+            logDebug(LOG_CANDLE, FMT, "FLICKER", 1.0f, 0.5f, (unsigned)i, (unsigned)i, (unsigned)i, "");
+        }
+        filteredCyc = cycles() - c0;
+    }
+
+    // The deferred line must read exactly like the immediate one
+    char direct[LOG_LINE_MAX];
+    snprintf(direct, sizeof(direct), FMT, "FLICKER", 1.25f, 0.5f, 1u, 2u, 3u, "  (xfade)");
+    logCapture(r, LOG_CANDLE, LOG_INFO, FMT, "FLICKER", 1.25f, 0.5f, 1u, 2u, 3u, "  (xfade)");
+    logFormat(r, line, sizeof(line));
+
+    Serial.printf("[BENCH] log  cyc/call  snprintf=%lu  capture+push=%lu  filtered=%s%lu  "
+                  "drain format=%lu\n",
+        (unsigned long)(formatCyc / CALLS), (unsigned long)(captureCyc / captured),
+        canFilter ? "" : "(skipped: CANDLE at debug) ", (unsigned long)(filteredCyc / CALLS),
+        (unsigned long)(drainCyc / captured));
+    Serial.printf("[BENCH] log  %u-byte records, %u-slot ring  dropped=%lu  output %s\n",
+        (unsigned)sizeof(LogRecord), (unsigned)LOG_RING, (unsigned long)dropped,
+        strcmp(direct, line) == 0 ? "matches printf" : "DIFFERS from printf");
+}
+
+// ─── Registry ─────────────────────────────────────────────────────────────────
+
+struct BenchEntry {
+    const char* name;
+    const char* description;
+    void (*run)();
+};
+
+static const BenchEntry BENCHES[] = {
+    {"noise",  "inoise8 sampler vs interpolated noise wavetable", benchNoise},
+    {"candle", "fixed-point candle engine vs float reference",    benchCandle},
+    {"bank",   "CandleBank batch kernel at 20 / 300 / 3000 flames", benchBank},
+    {"color",  "colour-mode pixels: HSV + in-place blur vs palette pipeline", benchColor},
+    {"magic",  "Magic drift ripple: sinf + HSV vs sine table + palette", benchMagic},
+    {"spark",  "spark particle pool step + render at 64 / 1000 / 4000", benchSpark},
+    {"xfade",  "frame blend, and one engine vs two engines crossfading", benchXfade},
+    {"prng",   "Arduino random() vs engine xorshift PRNG",        benchPrng},
+    {"pwm",    "per-frame ledcWrite vs LEDC hardware keyframe fades", benchPwm},
+    {"trace",  "flame trace playback from flash, per render frame", benchTrace},
+    {"strip",  "segmented WS2812 refresh time vs single-pin wire time", benchStrip},
+    {"stream", "binary frame packets: encode, decode, loss and CRC counts", benchStream},
+    {"log",    "deferred log call vs formatting on the spot",      benchLog},
+};
+
+void benchList() {
+    Serial.println("[BENCH] available:");
+    for (const auto& b : BENCHES) Serial.printf("  %-10s %s\n", b.name, b.description);
+    Serial.println("  all        run every benchmark");
+}
+
+bool benchRun(const char* name) {
+    bool all = strcmp(name, "all") == 0;
+    bool ran = false;
+    for (const auto& b : BENCHES) {
+        if (all || strcmp(name, b.name) == 0) { b.run(); ran = true; }
+    }
+    return ran;
+}
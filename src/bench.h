@@ -0,0 +1,14 @@
+#pragma once
+#include <Arduino.h>
+
+// ─── On-device benchmarks ────────────────────────────────────────────────────
+//
+// Micro-benchmarks for the animation kernels, timed with the CPU cycle
+// counter. Run from CLI test mode (`bench [name]`), where the render task is
+// paused and nothing else competes for the core.
+
+// Print the available benchmarks.
+void benchList();
+
+// Run one benchmark by name ("all" runs every one). Returns false if unknown.
+bool benchRun(const char* name);
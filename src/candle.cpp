@@ -0,0 +1,350 @@
+#include <Arduino.h>
+#include "candle.h"
+#include "config.h"
+#include "fixed_point.h"
+#include "flame_fixed.h"
+#include "noise_table.h"
+#include "timebase.h"
+
+// Output levels both engines start from on mode entry
+static constexpr float CANDLE_START_WHITE = 0.08f;
+static constexpr float CANDLE_RED_CAP     = (float)dutyFromPercent(BRIGHTNESS_MAX_RED) / (float)MAX_DUTY;
+
+// The crossfade samples the next sub-mode from a different region of the
+// same noise axes so the two levels are uncorrelated. One offset per octave.
+static constexpr float XFADE_OFFSET[FLAME_MAX_OCTAVES] = {7919.0f, 5003.0f, 3571.0f, 2503.0f};
+
+const char* flameSubModeName(FlameSubMode m) {
+    return FLAME_PROFILES[(int)m].name;
+}
+
+// ─── Scheduler ────────────────────────────────────────────────────────────────
+
+// Weighted draw over every sub-mode but `exclude` (FLAME_SUBMODES: none).
+// Returns `fallback` when no sub-mode is left with a non-zero weight.
+static FlameSubMode pickWeighted(Prng& rng, int exclude, FlameSubMode fallback) {
+    int total = 0;
+    for (int m = 0; m < FLAME_SUBMODES; m++) {
+        if (m != exclude) total += FLAME_PROFILES[m].pct;
+    }
+    if (total == 0) return fallback;
+    int r = rng.range(0, total);
+    int acc = 0;
+    for (int m = 0; m < FLAME_SUBMODES; m++) {
+        if (m == exclude) continue;
+        acc += FLAME_PROFILES[m].pct;
+        if (r < acc) return (FlameSubMode)m;
+    }
+    return fallback;
+}
+
+FlameSubMode pickSubMode(Prng& rng) {
+    return pickWeighted(rng, FLAME_SUBMODES, FlameSubMode::FLICKER);
+}
+
+FlameSubMode pickNextSubMode(Prng& rng, FlameSubMode current) {
+    return pickWeighted(rng, (int)current, current);
+}
+
+void candleScheduleBegin(CandleSchedule& s, uint64_t nowUs) {
+    uint32_t now = (uint32_t)(nowUs / 1000);
+    s.rng.seed(prngSeed());
+    s.snuffW1.begin(s.rng, CANDLE_SNUFF_RATE, nowUs);
+    s.snuffW2.begin(s.rng, CANDLE_SNUFF_RATE, nowUs);
+    s.subMode     = FlameSubMode::FLICKER;
+    s.nextSubMode = pickNextSubMode(s.rng, s.subMode);
+    s.subModeEnd  = now + s.rng.range(CANDLE_SUBMODE_MIN_MS, CANDLE_SUBMODE_MAX_MS);
+    s.xfadeEnd    = 0;
+    s.xfading     = false;
+}
+
+CandleControl candleScheduleStep(CandleSchedule& s, uint64_t nowUs) {
+    uint32_t now = (uint32_t)(nowUs / 1000);
+    if (!s.xfading && timeReached(now, s.subModeEnd)) {
+        // Start crossfade to next sub-mode
+        s.nextSubMode = pickNextSubMode(s.rng, s.subMode);
+        s.xfadeEnd    = now + CANDLE_XFADE_MS;
+        s.subModeEnd  = s.xfadeEnd + s.rng.range(CANDLE_SUBMODE_MIN_MS, CANDLE_SUBMODE_MAX_MS);
+        s.xfading     = true;
+    }
+    if (s.xfading && timeReached(now, s.xfadeEnd)) {
+        s.subMode = s.nextSubMode;
+        s.xfading = false;
+    }
+
+    CandleControl c;
+    c.subMode     = s.subMode;
+    c.nextSubMode = s.nextSubMode;
+    c.xfading     = s.xfading;
+    c.xfadeQ16    = 0;
+    if (c.xfading) {
+        int32_t left = (int32_t)(s.xfadeEnd - now);
+        c.xfadeQ16 = clampQ16(Q16_ONE - (int32_t)(((int64_t)left << 16) / (int32_t)CANDLE_XFADE_MS),
+                              0, Q16_ONE);
+    }
+    // Snuffs are timed here so both engines see the same events. The timers
+    // run in every sub-mode so FLICKER never starts with a backlog; an event
+    // that lands while a channel is still recovering is ignored by the engine.
+    bool flicker = s.subMode == FlameSubMode::FLICKER;
+    c.snuffW1 = s.snuffW1.poll(s.rng, nowUs) && flicker;
+    c.snuffW2 = s.snuffW2.poll(s.rng, nowUs) && flicker;
+    return c;
+}
+
+// ─── Fixed-point engine ──────────────────────────────────────────────────────
+
+struct PhaseOffsets {
+    uint32_t v[FLAME_OCTAVES];
+};
+
+static constexpr PhaseOffsets makeXfadeOffsets() {
+    PhaseOffsets o{};
+    for (int k = 0; k < FLAME_OCTAVES; k++) o.v[k] = noisePhaseFromUnits(XFADE_OFFSET[k]);
+    return o;
+}
+
+static constexpr PhaseOffsets NO_OFFSETS    = {};
+static constexpr PhaseOffsets XFADE_OFFSETS = makeXfadeOffsets();
+
+static constexpr uint32_t GUST_RATE = phaseRate(CANDLE_WIND_GUST_SPEED);
+static constexpr uint32_t W1_RATE   = phaseRate(CANDLE_W1_SPEED);
+static constexpr uint32_t W2_RATE   = phaseRate(CANDLE_W2_SPEED);
+
+// Red target over dimness 0–1 in 256 steps, already scaled to a fraction of
+// MAX_DUTY. One guard entry so interpolation never needs a bounds check.
+struct RedCurve {
+    uint16_t v[258];
+};
+
+static constexpr RedCurve makeRedCurve() {
+    RedCurve c{};
+    for (int i = 0; i <= 256; i++) {
+        double redOfCap = CANDLE_RED_MIN +
+            (CANDLE_RED_MAX - CANDLE_RED_MIN) * ctPow(i / 256.0, CANDLE_RED_CURVE);
+        c.v[i] = (uint16_t)q16(redOfCap * CANDLE_RED_CAP);
+    }
+    c.v[257] = c.v[256];
+    return c;
+}
+
+static constexpr RedCurve RED_CURVE = makeRedCurve();
+
+// Weighted octave sum, unrolled at compile time over FLAME_OCTAVES.
+template <int K = FLAME_OCTAVES>
+static inline int32_t fbmQ16(const FixedProfile& p, const uint32_t* ph, const uint32_t* offset) {
+    if constexpr (K == 0) {
+        return 0;
+    } else {
+        return fbmQ16<K - 1>(p, ph, offset) + mulQ16(p.weight[K - 1], noiseQ16(ph[K - 1] + offset[K - 1]));
+    }
+}
+
+static inline int32_t levelQ16(const FixedProfile& p, const uint32_t* ph, const uint32_t* offset,
+                               int32_t gust) {
+    int32_t level = p.base + mulQ16(p.span, fbmQ16(p, ph, offset));
+    return mulQ16(level, Q16_ONE - mulQ16(p.gustDepth, Q16_ONE - gust));
+}
+
+static inline uint16_t dutyFromQ16(int32_t x) {
+    return (uint16_t)clampQ16((int32_t)(((int64_t)x * MAX_DUTY) >> 16), 0, MAX_DUTY);
+}
+
+void candleBegin(CandleState& s) {
+    s.rng.seed(prngSeed());
+    for (int k = 0; k < FLAME_OCTAVES; k++) {
+        s.phOctave[k] = noisePhaseFromUnits((float)s.rng.range(0, 10000) + k * 20000.0f);
+    }
+    s.phGust  = noisePhaseFromUnits((float)s.rng.range(0, 10000));
+    s.phW1    = noisePhaseFromUnits((float)s.rng.range(0, 10000));
+    s.phW2    = noisePhaseFromUnits((float)s.rng.range(20000, 40000));  // well-separated noise region
+    s.snuffW1 = Q16_ONE;
+    s.snuffW2 = Q16_ONE;
+    s.outW1   = q16(CANDLE_START_WHITE);
+    s.outW2   = q16(CANDLE_START_WHITE);
+    s.outRed  = q16(CANDLE_RED_MIN * CANDLE_RED_CAP);
+    s.level   = 0;
+}
+
+CandleDuty candleStep(CandleState& s, const CandleControl& c, uint32_t dtQ16) {
+    const FixedProfile& p = FIXED_PROFILES.p[(int)c.subMode];
+
+    // ── Advance noise phases ──────────────────────────────────────────────────
+    for (int k = 0; k < FLAME_OCTAVES; k++) s.phOctave[k] += phaseAdvance(p.rate[k], dtQ16);
+    s.phGust  += phaseAdvance(GUST_RATE, dtQ16);
+    s.phW1    += phaseAdvance(W1_RATE, dtQ16);
+    s.phW2    += phaseAdvance(W2_RATE, dtQ16);
+
+    // ── Flame level ───────────────────────────────────────────────────────────
+    int32_t gust  = noiseQ16(s.phGust);
+    int32_t level = levelQ16(p, s.phOctave, NO_OFFSETS.v, gust);
+    if (c.xfading) {
+        int32_t next = levelQ16(FIXED_PROFILES.p[(int)c.nextSubMode], s.phOctave,
+                                XFADE_OFFSETS.v, gust);
+        level += mulQ16(next - level, c.xfadeQ16);
+    }
+    s.level = level;
+
+    // ── W1/W2 independent drift ───────────────────────────────────────────────
+    int32_t targetW1 = level + mulQ16(level, mulQ16(p.split, 2 * noiseQ16(s.phW1) - Q16_ONE));
+    int32_t targetW2 = level + mulQ16(level, mulQ16(p.split, 2 * noiseQ16(s.phW2) - Q16_ONE));
+    targetW1 = clampQ16(targetW1, 0, Q16_ONE);
+    targetW2 = clampQ16(targetW2, 0, Q16_ONE);
+
+    // ── Snuff events (flicker mode only) ──────────────────────────────────────
+    if (c.subMode == FlameSubMode::FLICKER) {
+        int32_t recover = (int32_t)(((int64_t)SNUFF_RECOVER_Q16 * dtQ16) >> 16);
+        recover = clampQ16(recover, 0, Q16_ONE);
+        snuffStepQ16(s.snuffW1, c.snuffW1, recover);
+        snuffStepQ16(s.snuffW2, c.snuffW2, recover);
+    } else {
+        s.snuffW1 = Q16_ONE;
+        s.snuffW2 = Q16_ONE;
+    }
+    targetW1 = mulQ16(targetW1, s.snuffW1);
+    targetW2 = mulQ16(targetW2, s.snuffW2);
+
+    // ── Red: inverse curve, looked up and interpolated ────────────────────────
+    int32_t  dim  = Q16_ONE - clampQ16(mulQ16(level, p.invPeak), 0, Q16_ONE);
+    uint32_t idx  = (uint32_t)dim >> 8;
+    int32_t  frac = dim & 0xFF;
+    int32_t  a    = RED_CURVE.v[idx];
+    int32_t  targetRed = a + (((RED_CURVE.v[idx + 1] - a) * frac) >> 8);
+
+    // ── Exponential smoothing ─────────────────────────────────────────────────
+    int32_t alpha = (int32_t)(((int64_t)p.smoothing * dtQ16) >> 16);
+    alpha = clampQ16(alpha, 0, Q16_ONE);
+    s.outW1  += mulQ16(targetW1  - s.outW1,  alpha);
+    s.outW2  += mulQ16(targetW2  - s.outW2,  alpha);
+    s.outRed += mulQ16(targetRed - s.outRed, alpha);
+
+    return { dutyFromQ16(s.outW1), dutyFromQ16(s.outW2), dutyFromQ16(s.outRed) };
+}
+
+void candleSyncFromRef(CandleState& s, const CandleRefState& ref) {
+    auto toQ16 = [](float x) { return (int32_t)(x * 65536.0f + 0.5f); };
+    for (int k = 0; k < FLAME_OCTAVES; k++) s.phOctave[k] = noisePhaseFromUnits(ref.tOctave[k]);
+    s.phGust  = noisePhaseFromUnits(ref.tGust);
+    s.phW1    = noisePhaseFromUnits(ref.tW1);
+    s.phW2    = noisePhaseFromUnits(ref.tW2);
+    s.snuffW1 = toQ16(ref.snuffW1);
+    s.snuffW2 = toQ16(ref.snuffW2);
+    s.outW1   = toQ16(ref.outW1);
+    s.outW2   = toQ16(ref.outW2);
+    s.outRed  = toQ16(ref.outRed);
+    s.level   = toQ16(ref.level);
+}
+
+// ─── Float reference ──────────────────────────────────────────────────────────
+//
+// The engine as it ran before the fixed-point port. Not used for rendering;
+// `bench candle` runs it side by side with candleStep().
+
+static constexpr float NOISE_PERIOD_UNITS = 65536.0f;   // uint32 phase wraps here
+
+static float sampleNoise(float t) {
+    return noiseSample(noisePhaseFromUnits(t)) * (1.0f / 65280.0f);   // 0–1
+}
+
+// Advance a noise coordinate, wrapping at the 65536-unit period the phase
+// accumulators wrap at, so the reference keeps full precision on long runs.
+static void advanceUnits(float& t, float delta) {
+    t += delta;
+    if (t >= NOISE_PERIOD_UNITS) t -= NOISE_PERIOD_UNITS;
+}
+
+// Weighted octave sum for a profile, optionally offset into another noise region.
+static float levelRef(const FlameProfile& p, const float* t, const float* offset, float gust) {
+    float n = 0.0f;
+    for (int k = 0; k < FLAME_OCTAVES; k++) {
+        n += flameOctaveWeight(p, k) * sampleNoise(t[k] + offset[k]);
+    }
+    float envelope = 1.0f - p.gustDepth * (1.0f - gust);
+    return (p.brightness * (1.0f - p.depth) + p.brightness * p.depth * n) * envelope;
+}
+
+static void snuffStepRef(float& snuff, bool trigger, float recover) {
+    if (snuff >= 1.0f && !trigger) return;
+    if (snuff >= 1.0f) snuff = 1.0f - CANDLE_SNUFF_DEPTH;   // trigger dip
+    snuff += (1.0f - snuff) * recover;
+    if (snuff >= 1.0f - SNUFF_REST_EPSILON) snuff = 1.0f;
+}
+
+void candleRefBegin(CandleRefState& s) {
+    s.rng.seed(prngSeed());
+    for (int k = 0; k < FLAME_OCTAVES; k++) s.tOctave[k] = (float)s.rng.range(0, 10000) + k * 20000.0f;
+    s.tGust   = (float)s.rng.range(0, 10000);
+    s.tW1     = (float)s.rng.range(0, 10000);
+    s.tW2     = (float)s.rng.range(20000, 40000);  // well-separated noise region
+    s.snuffW1 = 1.0f;
+    s.snuffW2 = 1.0f;
+    s.outW1   = CANDLE_START_WHITE;
+    s.outW2   = CANDLE_START_WHITE;
+    s.outRed  = CANDLE_RED_MIN * CANDLE_RED_CAP;
+    s.level   = 0.0f;
+}
+
+CandleDuty candleRefStep(CandleRefState& s, const CandleControl& c, float dtf) {
+    const FlameProfile& p = FLAME_PROFILES[(int)c.subMode];
+    static constexpr float NO_OFFSET[FLAME_MAX_OCTAVES] = {};
+
+    // ── Advance Perlin time axes ──────────────────────────────────────────────
+    // Wrapped at the noise period so float precision never degrades with uptime.
+    for (int k = 0; k < FLAME_OCTAVES; k++) advanceUnits(s.tOctave[k], flameOctaveSpeed(p, k) * dtf);
+    advanceUnits(s.tGust, CANDLE_WIND_GUST_SPEED * dtf);
+    advanceUnits(s.tW1,   CANDLE_W1_SPEED * dtf);
+    advanceUnits(s.tW2,   CANDLE_W2_SPEED * dtf);
+
+    // ── Sample noise ──────────────────────────────────────────────────────────
+    float gustVal  = sampleNoise(s.tGust);
+    float curLevel = levelRef(p, s.tOctave, NO_OFFSET, gustVal);
+
+    // During xfade, blend toward the next sub-mode's noise
+    if (c.xfading) {
+        float xfadeT    = (float)c.xfadeQ16 * (1.0f / 65536.0f);
+        float nextLevel = levelRef(FLAME_PROFILES[(int)c.nextSubMode], s.tOctave, XFADE_OFFSET, gustVal);
+        curLevel = curLevel + (nextLevel - curLevel) * xfadeT;
+    }
+    s.level = curLevel;
+
+    // ── W1/W2 independent drift ───────────────────────────────────────────────
+    // Each channel has its own slow Perlin axis, so they drift autonomously.
+    // Drift depth is per profile: wide in calm, narrow in flicker/wind.
+    float targetW1 = curLevel * (1.0f + p.split * (sampleNoise(s.tW1) - 0.5f) * 2.0f);
+    float targetW2 = curLevel * (1.0f + p.split * (sampleNoise(s.tW2) - 0.5f) * 2.0f);
+    targetW1 = constrain(targetW1, 0.0f, 1.0f);
+    targetW2 = constrain(targetW2, 0.0f, 1.0f);
+
+    // ── Snuff events (flicker mode only) ──────────────────────────────────────
+    // A rare random trigger dips one channel toward zero then releases it.
+    // The recovery uses its own faster smoothing so the return is snappy.
+    if (c.subMode == FlameSubMode::FLICKER) {
+        float recover = constrain(CANDLE_SNUFF_RECOVER * dtf, 0.0f, 1.0f);
+        snuffStepRef(s.snuffW1, c.snuffW1, recover);
+        snuffStepRef(s.snuffW2, c.snuffW2, recover);
+    } else {
+        s.snuffW1 = 1.0f;
+        s.snuffW2 = 1.0f;
+    }
+    targetW1 *= s.snuffW1;
+    targetW2 *= s.snuffW2;
+
+    // ── Red: inverse curve over its own full brightness range ─────────────────
+    // dimness=0 when flame is at peak → red at RED_MIN fraction of its cap.
+    // dimness=1 when flame is near zero → red at RED_MAX fraction of its cap.
+    float dimness   = 1.0f - constrain(curLevel / p.brightness, 0.0f, 1.0f);
+    float redOfCap  = CANDLE_RED_MIN +
+                      (CANDLE_RED_MAX - CANDLE_RED_MIN) * powf(dimness, CANDLE_RED_CURVE);
+    float targetRed = redOfCap * CANDLE_RED_CAP;
+
+    // ── Exponential smoothing ─────────────────────────────────────────────────
+    float alpha = constrain(p.smoothing * dtf, 0.0f, 1.0f);
+    s.outW1  += (targetW1  - s.outW1)  * alpha;
+    s.outW2  += (targetW2  - s.outW2)  * alpha;
+    s.outRed += (targetRed - s.outRed) * alpha;
+
+    return {
+        (uint16_t)constrain((int)(s.outW1  * MAX_DUTY), 0, MAX_DUTY),
+        (uint16_t)constrain((int)(s.outW2  * MAX_DUTY), 0, MAX_DUTY),
+        (uint16_t)constrain((int)(s.outRed * MAX_DUTY), 0, MAX_DUTY),
+    };
+}
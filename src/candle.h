@@ -0,0 +1,109 @@
+#pragma once
+#include <stdint.h>
+#include "flame_profile.h"
+#include "prng.h"
+#include "poisson.h"
+
+// ─── Candle simulation ───────────────────────────────────────────────────────
+//
+// Sub-modes (CALM, FLICKER, WIND — see flame_profile.h) cycle according to
+// configured time percentages. Each sums octaves of 1D Perlin noise (FastLED
+// inoise8, via the interpolated wavetable in noise_table.h) at moving time
+// positions — smooth by construction, no explicit filter needed.
+// A slower Perlin layer acts as a gust envelope for profiles that use one.
+//
+// Two more slow Perlin axes drive a small W1/W2 split so the two whites are
+// never perfectly synchronised.
+//
+// The live engine (candleStep) runs entirely in Q16 fixed point: noise phases
+// are uint32_t, flame profiles are folded at compile time and the red
+// response curve is a constexpr lookup table. The original float engine is
+// kept as candleRefStep so `bench candle` can check the two agree.
+//
+// The scheduler is split out so both engines can be fed identical decisions
+// (sub-mode changes, crossfade progress, snuff events) from one random stream.
+//
+// All parameters live in config.h. No magic numbers here.
+
+const char* flameSubModeName(FlameSubMode m);
+
+// ── Scheduler ─────────────────────────────────────────────────────────────────
+
+struct CandleSchedule {
+    FlameSubMode  subMode     = FlameSubMode::FLICKER;
+    FlameSubMode  nextSubMode = FlameSubMode::FLICKER;
+    uint32_t      subModeEnd  = 0;   // frameTime().nowMs when current sub-mode ends
+    uint32_t      xfadeEnd    = 0;   // frameTime().nowMs when crossfade ends
+    bool          xfading     = false;
+    PoissonEvent  snuffW1, snuffW2;  // per-channel snuff timers
+    Prng          rng;               // sub-mode picks, durations and snuff timing
+};
+
+// One frame's worth of scheduler decisions.
+struct CandleControl {
+    FlameSubMode subMode;
+    FlameSubMode nextSubMode;
+    bool         xfading;
+    int32_t      xfadeQ16;   // crossfade progress toward nextSubMode, 0–Q16_ONE
+    bool         snuffW1;    // snuff event due this frame (FLICKER only)
+    bool         snuffW2;
+};
+
+// Pick a sub-mode weighted by the profiles' PCT values, for a flame starting cold.
+FlameSubMode  pickSubMode(Prng& rng);
+
+// Pick the next sub-mode weighted by the profiles' PCT values, excluding current.
+FlameSubMode  pickNextSubMode(Prng& rng, FlameSubMode current);
+
+void          candleScheduleBegin(CandleSchedule& s, uint64_t nowUs);
+CandleControl candleScheduleStep(CandleSchedule& s, uint64_t nowUs);
+
+// PWM duties for the three candle channels (0–MAX_DUTY).
+struct CandleDuty {
+    uint16_t w1, w2, red;
+};
+
+// ── Fixed-point engine (live) ─────────────────────────────────────────────────
+
+struct CandleState {
+    // Noise phases (see noise_table.h)
+    uint32_t phOctave[FLAME_OCTAVES];
+    uint32_t phGust, phW1, phW2;
+
+    // Snuff multipliers, Q16: Q16_ONE = normal, less = snuffed
+    int32_t snuffW1, snuffW2;
+
+    // Smoothed output levels, Q16 fraction of MAX_DUTY
+    int32_t outW1, outW2, outRed;
+
+    int32_t level;   // last flame level before the W1/W2 split, Q16 (diagnostics)
+
+    Prng rng;        // starting noise positions
+};
+
+void       candleBegin(CandleState& s);
+CandleDuty candleStep(CandleState& s, const CandleControl& c, uint32_t dtQ16);
+
+// ── Float reference ───────────────────────────────────────────────────────────
+
+struct CandleRefState {
+    // Perlin time accumulators, inoise8 units
+    float tOctave[FLAME_OCTAVES];
+    float tGust, tW1, tW2;
+
+    float snuffW1, snuffW2;   // 1.0 = normal, <1 = snuffed
+
+    // Smoothed output levels (0.0–1.0 fraction of MAX_DUTY)
+    float outW1, outW2, outRed;
+
+    float level;
+
+    Prng rng;
+};
+
+void       candleRefBegin(CandleRefState& s);
+CandleDuty candleRefStep(CandleRefState& s, const CandleControl& c, float dtMs);
+
+// Load the reference's noise positions, snuff and output levels into a
+// fixed-point state so both engines continue from the same point.
+void candleSyncFromRef(CandleState& s, const CandleRefState& ref);
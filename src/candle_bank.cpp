@@ -0,0 +1,103 @@
+#include "candle_bank.h"
+#include "candle.h"
+#include "flame_fixed.h"
+
+static constexpr uint32_t GUST_RATE = phaseRate(CANDLE_WIND_GUST_SPEED);
+
+// Mean sub-mode run, for the bank's retarget rate
+static constexpr float SUBMODE_MEAN_S = (CANDLE_SUBMODE_MIN_MS + CANDLE_SUBMODE_MAX_MS) * 0.5f / 1000.0f;
+
+// Level → 0–Q16_ONE of the brightest profile's peak, for rendering
+static constexpr float maxBrightness() {
+    float m = 0.0f;
+    for (const auto& p : FLAME_PROFILES) m = p.brightness > m ? p.brightness : m;
+    return m;
+}
+static constexpr int32_t LEVEL_TO_UNIT = q16(1.0 / maxBrightness());
+
+// One profile's constants for this frame, shared by every flame using it.
+struct BankFrame {
+    uint32_t adv[FLAME_OCTAVES];
+    int32_t  weight[FLAME_OCTAVES];
+    int32_t  base, span;   // gust envelope already applied
+    int32_t  alpha;
+};
+
+// Advance flame i's octaves and return their weighted sum, unrolled over K.
+template <int K = FLAME_OCTAVES>
+static inline int32_t bankFbm(const BankFrame& f, uint32_t* const* phase, int i) {
+    if constexpr (K == 0) {
+        return 0;
+    } else {
+        uint32_t ph = phase[K - 1][i] += f.adv[K - 1];
+        return bankFbm<K - 1>(f, phase, i) + mulQ16(f.weight[K - 1], noiseQ16(ph));
+    }
+}
+
+void candleBankBegin(const CandleBankView& b, uint64_t nowUs) {
+    CandleBankShared& sh = *b.shared;
+    sh.rng.seed(prngSeed());
+    for (int i = 0; i < b.n; i++) {
+        for (int k = 0; k < FLAME_OCTAVES; k++) b.phase[k][i] = sh.rng.next();
+        FlameSubMode m = pickSubMode(sh.rng);   // starting mix follows the PCT weights
+        b.subMode[i] = (uint8_t)m;
+        b.level[i]   = FIXED_PROFILES.p[(int)m].base;
+        b.snuff[i]   = Q16_ONE;
+    }
+    sh.phGust = sh.rng.next();
+    sh.snuff.begin(sh.rng, b.n * CANDLE_SNUFF_RATE, nowUs);
+    sh.retarget.begin(sh.rng, b.n / SUBMODE_MEAN_S, nowUs);
+}
+
+void candleBankStep(const CandleBankView& b, uint64_t nowUs, uint32_t dtQ16) {
+    CandleBankShared& sh = *b.shared;
+
+    // ── Bank-wide events ──────────────────────────────────────────────────────
+    while (sh.retarget.poll(sh.rng, nowUs)) {
+        uint32_t i = sh.rng.below(b.n);
+        b.subMode[i] = (uint8_t)pickNextSubMode(sh.rng, (FlameSubMode)b.subMode[i]);
+    }
+    while (sh.snuff.poll(sh.rng, nowUs)) {
+        uint32_t i = sh.rng.below(b.n);
+        if (b.subMode[i] == (uint8_t)FlameSubMode::FLICKER) snuffStepQ16(b.snuff[i], true, 0);
+    }
+
+    // ── Per-profile constants for this frame ──────────────────────────────────
+    sh.phGust += phaseAdvance(GUST_RATE, dtQ16);
+    int32_t gust = noiseQ16(sh.phGust);
+    BankFrame frame[FLAME_SUBMODES];
+    for (int m = 0; m < FLAME_SUBMODES; m++) {
+        const FixedProfile& p = FIXED_PROFILES.p[m];
+        BankFrame&          f = frame[m];
+        int32_t envelope = Q16_ONE - mulQ16(p.gustDepth, Q16_ONE - gust);
+        for (int k = 0; k < FLAME_OCTAVES; k++) {
+            f.adv[k]    = phaseAdvance(p.rate[k], dtQ16);
+            f.weight[k] = p.weight[k];
+        }
+        f.base  = mulQ16(p.base, envelope);
+        f.span  = mulQ16(p.span, envelope);
+        f.alpha = clampQ16((int32_t)(((int64_t)p.smoothing * dtQ16) >> 16), 0, Q16_ONE);
+    }
+    int32_t recover = clampQ16((int32_t)(((int64_t)SNUFF_RECOVER_Q16 * dtQ16) >> 16), 0, Q16_ONE);
+
+    // ── Batch kernel ──────────────────────────────────────────────────────────
+    for (int i = 0; i < b.n; i++) {
+        const BankFrame& f = frame[b.subMode[i]];
+        int32_t target = f.base + mulQ16(f.span, bankFbm(f, b.phase, i));
+        if (b.snuff[i] < Q16_ONE) {
+            snuffStepQ16(b.snuff[i], false, recover);
+            target = mulQ16(target, b.snuff[i]);
+        }
+        b.level[i] += mulQ16(target - b.level[i], f.alpha);
+    }
+}
+
+void candleBankRender(const CandleBankView& b, CRGB* out, uint8_t brightness) {
+    static constexpr int HEAT_SPAN = CANDLE_STRIP_HEAT_MAX - CANDLE_STRIP_HEAT_MIN;
+    for (int i = 0; i < b.n; i++) {
+        int32_t unit = clampQ16(mulQ16(b.level[i], LEVEL_TO_UNIT), 0, Q16_ONE);
+        uint8_t heat = CANDLE_STRIP_HEAT_MIN + (uint8_t)((unit * HEAT_SPAN) >> 16);
+        out[i] = HeatColor(heat);
+        out[i].nscale8_video(brightness);
+    }
+}
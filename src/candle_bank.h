@@ -0,0 +1,61 @@
+#pragma once
+#include <Arduino.h>
+#include <FastLED.h>
+#include "flame_profile.h"
+#include "prng.h"
+#include "poisson.h"
+
+// ─── Candle bank ─────────────────────────────────────────────────────────────
+//
+// Many independent flames in struct-of-arrays layout — one per strip pixel in
+// Candle mode, thousands in `bench bank`. Each flame has its own noise
+// phases, smoothed level, snuff multiplier and sub-mode id; candleBankStep()
+// updates them all in one pass over contiguous arrays.
+//
+// Per-profile work (phase advance, gust envelope, smoothing factor) is done
+// once per frame, not per flame. Sub-mode changes and snuffs are bank-wide
+// Poisson timers that land on a random flame, so a frame with no events costs
+// two compares however many flames there are. Flames switch sub-mode without
+// a crossfade; their own output smoothing hides the step.
+
+// Bank-wide state shared by every flame.
+struct CandleBankShared {
+    Prng         rng;
+    uint32_t     phGust;     // one gust axis for the whole bank
+    PoissonEvent snuff;      // n × CANDLE_SNUFF_RATE, applied to FLICKER flames
+    PoissonEvent retarget;   // n / mean sub-mode run: re-pick one flame's sub-mode
+};
+
+// Non-owning view of a bank; what the kernels operate on.
+struct CandleBankView {
+    int               n;
+    uint32_t*         phase[FLAME_OCTAVES];   // phase[k][i]: octave k of flame i
+    int32_t*          level;                  // smoothed level, Q16 fraction of MAX_DUTY
+    int32_t*          snuff;                  // Q16 multiplier, Q16_ONE = at rest
+    uint8_t*          subMode;                // FlameSubMode
+    CandleBankShared* shared;
+};
+
+template <int N>
+struct CandleBank {
+    uint32_t         phase[FLAME_OCTAVES][N];
+    int32_t          level[N];
+    int32_t          snuff[N];
+    uint8_t          subMode[N];
+    CandleBankShared shared;
+
+    CandleBankView view() {
+        CandleBankView v{N, {}, level, snuff, subMode, &shared};
+        for (int k = 0; k < FLAME_OCTAVES; k++) v.phase[k] = phase[k];
+        return v;
+    }
+};
+
+// Scatter every flame to a random noise position and sub-mode.
+void candleBankBegin(const CandleBankView& b, uint64_t nowUs);
+
+// Advance every flame by one frame.
+void candleBankStep(const CandleBankView& b, uint64_t nowUs, uint32_t dtQ16);
+
+// One pixel per flame: HeatColor by level, value scaled by brightness.
+void candleBankRender(const CandleBankView& b, CRGB* out, uint8_t brightness);
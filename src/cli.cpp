@@ -1,6 +1,13 @@
 #include "cli.h"
 #include "config.h"
 #include "types.h"
+#include "render.h"
+#include "led_sink.h"
+#include "bench.h"
+#include "sim.h"
+#include "stream.h"
+#include "log.h"
+#include "perf.h"
 
 // ─── Extern references to main.cpp globals ───────────────────────────────────
 
@@ -9,7 +16,7 @@ extern CandleMode currentMode;
 extern bool powerOn;
 extern const ModeConfig MODES[];
 
-void turnOffAllLEDs();
+void showStrip();
 
 // ─── Channel mask ─────────────────────────────────────────────────────────────
 // Bits 0-3 = PWM channels (indices match LED_PINS).
@@ -124,15 +131,17 @@ static void replaceInputLine(const char* newLine) {
 
 static void setChannelDuty(uint8_t mask, int duty) {
     duty = constrain(duty, 0, MAX_DUTY);
-    if (mask & CH_W1)  { ledcWrite(LED_PINS[WHITE_LED_1], duty); savedDuty[WHITE_LED_1] = duty; }
-    if (mask & CH_W2)  { ledcWrite(LED_PINS[WHITE_LED_2], duty); savedDuty[WHITE_LED_2] = duty; }
-    if (mask & CH_UV)  { ledcWrite(LED_PINS[UV_LED],      duty); savedDuty[UV_LED]      = duty; }
-    if (mask & CH_RED) { ledcWrite(LED_PINS[RED_LED],     duty); savedDuty[RED_LED]     = duty; }
+    // Staged together, committed once; the sink applies the channel caps
+    if (mask & CH_W1)  { ledSink().setDuty(WHITE_LED_1, duty); savedDuty[WHITE_LED_1] = duty; }
+    if (mask & CH_W2)  { ledSink().setDuty(WHITE_LED_2, duty); savedDuty[WHITE_LED_2] = duty; }
+    if (mask & CH_UV)  { ledSink().setDuty(UV_LED,      duty); savedDuty[UV_LED]      = duty; }
+    if (mask & CH_RED) { ledSink().setDuty(RED_LED,     duty); savedDuty[RED_LED]     = duty; }
+    ledSink().commitDuty();
     if (mask & CH_RGB) {
         fill_solid(leds, NUM_LEDS, currentRgbColor);
         // Scale brightness: duty/255 applied as FastLED global brightness for simplicity
         FastLED.setBrightness((uint8_t)duty);
-        FastLED.show();
+        showStrip();
     }
 }
 
@@ -140,27 +149,25 @@ static void setRgbColor(CRGB color) {
     currentRgbColor = color;
     savedRgbColor   = color;
     fill_solid(leds, NUM_LEDS, color);
-    FastLED.show();
+    showStrip();
 }
 
 static void testSetPwmFreq(double freq) {
-    for (int i = 0; i < 4; i++) {
-        ledcAttach(LED_PINS[i], freq, PWM_RESOLUTION);
-        ledcWrite(LED_PINS[i], 0);
-    }
+    ledSink().setPwmFrequency(freq);
     testPwmFreq = freq;
 }
 
 static void cmdOff(uint8_t mask) {
     // savedDuty is maintained by setChannelDuty/testHold — just zero the outputs
-    if (mask & CH_W1)  ledcWrite(LED_PINS[WHITE_LED_1], 0);
-    if (mask & CH_W2)  ledcWrite(LED_PINS[WHITE_LED_2], 0);
-    if (mask & CH_UV)  ledcWrite(LED_PINS[UV_LED],      0);
-    if (mask & CH_RED) ledcWrite(LED_PINS[RED_LED],     0);
+    if (mask & CH_W1)  ledSink().setDuty(WHITE_LED_1, 0);
+    if (mask & CH_W2)  ledSink().setDuty(WHITE_LED_2, 0);
+    if (mask & CH_UV)  ledSink().setDuty(UV_LED,      0);
+    if (mask & CH_RED) ledSink().setDuty(RED_LED,     0);
+    ledSink().commitDuty();
     if (mask & CH_RGB) {
         savedRgbColor = currentRgbColor;
         fill_solid(leds, NUM_LEDS, CRGB::Black);
-        FastLED.show();
+        showStrip();
     }
     Serial.printf("[OFF] ");
     printMaskName(mask);
@@ -168,14 +175,15 @@ static void cmdOff(uint8_t mask) {
 }
 
 static void cmdOn(uint8_t mask) {
-    if (mask & CH_W1)  ledcWrite(LED_PINS[WHITE_LED_1], savedDuty[WHITE_LED_1]);
-    if (mask & CH_W2)  ledcWrite(LED_PINS[WHITE_LED_2], savedDuty[WHITE_LED_2]);
-    if (mask & CH_UV)  ledcWrite(LED_PINS[UV_LED],      savedDuty[UV_LED]);
-    if (mask & CH_RED) ledcWrite(LED_PINS[RED_LED],     savedDuty[RED_LED]);
+    if (mask & CH_W1)  ledSink().setDuty(WHITE_LED_1, savedDuty[WHITE_LED_1]);
+    if (mask & CH_W2)  ledSink().setDuty(WHITE_LED_2, savedDuty[WHITE_LED_2]);
+    if (mask & CH_UV)  ledSink().setDuty(UV_LED,      savedDuty[UV_LED]);
+    if (mask & CH_RED) ledSink().setDuty(RED_LED,     savedDuty[RED_LED]);
+    ledSink().commitDuty();
     if (mask & CH_RGB) {
         currentRgbColor = savedRgbColor;
         fill_solid(leds, NUM_LEDS, currentRgbColor);
-        FastLED.show();
+        showStrip();
     }
     Serial.printf("[ON] ");
     printMaskName(mask);
@@ -241,8 +249,11 @@ static bool parseColor(const char* token, CRGB& out) {
 static void printNormalMenu() {
     Serial.println("\n--- ESP Candle CLI ---");
     Serial.println("  s          status");
-    Serial.println("  m <0-3>    set mode  (0=Candle 1=Color 2=Magic 3=Auto)");
+    Serial.println("  m <0-4>    set mode  (0=Candle 1=Color 2=Magic 3=Auto 4=Trace)");
     Serial.println("  t          enter test mode");
+    Serial.println("  perf       stage timings, loop/frame rate, jitter, heap; then reset");
+    Serial.println("  log [tag|all] [debug|info|warn|error|off]");
+    Serial.println("             show or set log levels  (no args = levels + counters)");
     Serial.println("  ?          this menu");
     Serial.println("----------------------");
 }
@@ -257,8 +268,12 @@ static void printTestMenu() {
     Serial.println("  off [ch]              turn off channel(s)");
     Serial.println("  on  [ch]              restore last value for channel(s)");
     Serial.printf("  hold <0-%d> [ch]  hold PWM duty / RGB brightness\n", MAX_DUTY);
-    Serial.println("  ramp [ch]             ramp min->max->min, printing each step");
+    Serial.println("  ramp [ch]             ramp min->max->min, 8 ms per step  (any key stops a test)");
     Serial.println("  rand [ch]             random bursts for 10 s");
+    Serial.println("  bench [name|all]      run on-device benchmark (no name = list)");
+    Serial.println("  sim <0-4> <n>[s|m|h|d] [fps=60] [csv=<ms>] [seed=<n>] [start=<n>[s|m|h|d]]");
+    Serial.println("                        run a mode on a virtual clock, print stats");
+    Serial.println("                        (start=1193h soaks across the nowMs rollover)");
     Serial.println("RGB:");
     Serial.println("  rgb <color|#rrggbb>   set solid color (white red green blue");
     Serial.println("                         yellow cyan magenta orange purple pink warm)");
@@ -272,12 +287,15 @@ static void printTestMenu() {
 // ─── Normal-mode commands ─────────────────────────────────────────────────────
 
 static void cmdStatus() {
-    Serial.printf("[STATUS] uptime=%lus  power=%s  mode=%s  heap=%dB  temp=%.1fC\n",
+    Serial.printf("[STATUS] uptime=%lus  power=%s  mode=%s  heap=%dB  temp=%.1fC  "
+                  "shows=%lu  skipped=%lu  pwm=%lu  elided=%lu\n",
         millis() / 1000,
         powerOn ? "ON" : "OFF",
         MODES[currentMode].name,
         ESP.getFreeHeap(),
-        temperatureRead());
+        temperatureRead(),
+        (unsigned long)ledSink().showsSent, (unsigned long)ledSink().showsSkipped,
+        (unsigned long)ledSink().dutyWrites, (unsigned long)ledSink().dutyElided);
 }
 
 static void cmdSetMode(int n) {
@@ -285,12 +303,45 @@ static void cmdSetMode(int n) {
         Serial.printf("[CLI] Invalid mode %d (0-%d)\n", n, NUM_MODES - 1);
         return;
     }
-    if (MODES[currentMode].exitFunction) MODES[currentMode].exitFunction();
-    CandleMode prev = currentMode;
-    currentMode = (CandleMode)n;
-    if (MODES[currentMode].enterFunction) MODES[currentMode].enterFunction();
-    powerOn = true;
-    Serial.printf("[MODE] %s -> %s\n", MODES[prev].name, MODES[currentMode].name);
+    // Applied at the render task's next frame boundary; it reports the [MODE] change
+    if (!renderPost(RenderCmdType::SET_MODE, (int8_t)n)) {
+        Serial.println("[CLI] Render queue full, try again");
+    }
+}
+
+// "log" alone lists levels and counters; "log <tag|all> <level>" sets a filter.
+static void cmdLog(char* args) {
+    char* sp   = nullptr;
+    char* tagS = strtok_r(args, " ", &sp);
+    char* levS = strtok_r(nullptr, " ", &sp);
+
+    if (tagS && levS) {
+        LogLevel level;
+        LogTag   tag;
+        if (!logParseLevel(levS, level)) {
+            Serial.printf("[LOG] Unknown level '%s'\n", levS);
+            return;
+        }
+        if (strcasecmp(tagS, "all") == 0) {
+            for (int t = 0; t < LOG_TAGS; t++) logSetLevel((LogTag)t, level);
+        } else if (logParseTag(tagS, tag)) {
+            logSetLevel(tag, level);
+        } else {
+            Serial.printf("[LOG] Unknown tag '%s'\n", tagS);
+            return;
+        }
+    } else if (tagS) {
+        Serial.println("[LOG] Usage: log <tag|all> <debug|info|warn|error|off>");
+        return;
+    }
+
+    LogStats st = logStats();
+    Serial.print("[LOG]");
+    for (int t = 0; t < LOG_TAGS; t++) {
+        Serial.printf(" %s=%s", LOG_TAG_NAMES[t], LOG_LEVEL_NAMES[logLevel((LogTag)t)]);
+    }
+    Serial.printf("\n[LOG] logged=%lu  dropped=%lu  cut=%lu\n",
+        (unsigned long)st.logged, (unsigned long)st.dropped, (unsigned long)st.cut);
 }
 
 // ─── Test-mode commands ───────────────────────────────────────────────────────
@@ -303,133 +354,209 @@ static void testInfo() {
         currentRgbColor.r, currentRgbColor.g, currentRgbColor.b);
 }
 
-// Ramp PWM channels in mask; for RGB channel ramps brightness on currentRgbColor
-static void testRamp(uint8_t mask) {
-    uint8_t pwmMask = mask & CH_PWM;
-    bool    doRgb   = (mask & CH_RGB) != 0;
-
-    Serial.printf("[RAMP] ");
-    printMaskName(mask);
-    Serial.printf("  %d->%d->%d  freq=%.0f Hz\n",
-        testMinBrightness, testMaxBrightness, testMinBrightness, testPwmFreq);
-
-    for (int v = testMinBrightness; v <= testMaxBrightness; v++) {
-        if (pwmMask) setChannelDuty(pwmMask, v);
-        if (doRgb) {
-            fill_solid(leds, NUM_LEDS, currentRgbColor);
-            FastLED.setBrightness((uint8_t)v);
-            FastLED.show();
-        }
-        Serial.printf("  up   v=%3d\n", v);
-        delay(8);
-    }
-    for (int v = testMaxBrightness; v >= testMinBrightness; v--) {
-        if (pwmMask) setChannelDuty(pwmMask, v);
-        if (doRgb) {
-            fill_solid(leds, NUM_LEDS, currentRgbColor);
-            FastLED.setBrightness((uint8_t)v);
-            FastLED.show();
-        }
-        Serial.printf("  down v=%3d\n", v);
-        delay(8);
-    }
-    if (pwmMask) setChannelDuty(pwmMask, 0);
-    if (doRgb)  { fill_solid(leds, NUM_LEDS, CRGB::Black); FastLED.setBrightness(255); FastLED.show(); }
-    Serial.println("[RAMP] done");
-}
-
-static void testRand(uint8_t mask) {
-    uint8_t pwmMask = mask & CH_PWM;
-    bool    doRgb   = (mask & CH_RGB) != 0;
-    int range = testMaxBrightness - testMinBrightness;
-    if (range < 1) range = 1;
-
-    Serial.printf("[RAND] ");
-    printMaskName(mask);
-    Serial.printf("  10 s  range=%d-%d\n", testMinBrightness, testMaxBrightness);
-
-    unsigned long end = millis() + 10000;
-    while (millis() < end) {
-        int v = testMinBrightness + random(0, range + 1);
-        if (pwmMask) setChannelDuty(pwmMask, v);
-        if (doRgb) {
-            fill_solid(leds, NUM_LEDS, currentRgbColor);
-            FastLED.setBrightness((uint8_t)v);
-            FastLED.show();
-        }
-        Serial.printf("  v=%3d\n", v);
-        delay(80);
-    }
-    if (pwmMask) setChannelDuty(pwmMask, 0);
-    if (doRgb)  { fill_solid(leds, NUM_LEDS, CRGB::Black); FastLED.setBrightness(255); FastLED.show(); }
-    Serial.println("[RAND] done");
-}
-
 static void testHold(int duty, uint8_t mask) {
     duty = constrain(duty, 0, MAX_DUTY);
     uint8_t pwmMask = mask & CH_PWM;
     bool    doRgb   = (mask & CH_RGB) != 0;
 
     if (pwmMask) {
-        // Write directly via ledcWrite per channel and update savedDuty
-        if (pwmMask & CH_W1)  { ledcWrite(LED_PINS[WHITE_LED_1], duty); savedDuty[WHITE_LED_1] = duty; }
-        if (pwmMask & CH_W2)  { ledcWrite(LED_PINS[WHITE_LED_2], duty); savedDuty[WHITE_LED_2] = duty; }
-        if (pwmMask & CH_UV)  { ledcWrite(LED_PINS[UV_LED],      duty); savedDuty[UV_LED]      = duty; }
-        if (pwmMask & CH_RED) { ledcWrite(LED_PINS[RED_LED],     duty); savedDuty[RED_LED]     = duty; }
+        // Stage each channel through the sink, commit once, update savedDuty
+        if (pwmMask & CH_W1)  { ledSink().setDuty(WHITE_LED_1, duty); savedDuty[WHITE_LED_1] = duty; }
+        if (pwmMask & CH_W2)  { ledSink().setDuty(WHITE_LED_2, duty); savedDuty[WHITE_LED_2] = duty; }
+        if (pwmMask & CH_UV)  { ledSink().setDuty(UV_LED,      duty); savedDuty[UV_LED]      = duty; }
+        if (pwmMask & CH_RED) { ledSink().setDuty(RED_LED,     duty); savedDuty[RED_LED]     = duty; }
+        ledSink().commitDuty();
     }
     if (doRgb) {
         fill_solid(leds, NUM_LEDS, currentRgbColor);
         FastLED.setBrightness((uint8_t)duty);
-        FastLED.show();
+        showStrip();
     }
     Serial.printf("[HOLD] duty=%d  ch=", duty);
     printMaskName(mask);
-    // Confirm actual pin values written
+    // Confirm actual pin values written (after the channel caps)
     Serial.print("  pins:");
-    if (pwmMask & CH_W1)  Serial.printf(" GPIO%d=%d", LED_PINS[WHITE_LED_1], duty);
-    if (pwmMask & CH_W2)  Serial.printf(" GPIO%d=%d", LED_PINS[WHITE_LED_2], duty);
-    if (pwmMask & CH_UV)  Serial.printf(" GPIO%d=%d", LED_PINS[UV_LED],      duty);
-    if (pwmMask & CH_RED) Serial.printf(" GPIO%d=%d", LED_PINS[RED_LED],     duty);
+    if (pwmMask & CH_W1)  Serial.printf(" GPIO%d=%d", LED_PINS[WHITE_LED_1], constrain(duty, 0, dutyCap(WHITE_LED_1)));
+    if (pwmMask & CH_W2)  Serial.printf(" GPIO%d=%d", LED_PINS[WHITE_LED_2], constrain(duty, 0, dutyCap(WHITE_LED_2)));
+    if (pwmMask & CH_UV)  Serial.printf(" GPIO%d=%d", LED_PINS[UV_LED],      constrain(duty, 0, dutyCap(UV_LED)));
+    if (pwmMask & CH_RED) Serial.printf(" GPIO%d=%d", LED_PINS[RED_LED],     constrain(duty, 0, dutyCap(RED_LED)));
     Serial.println();
 }
 
+
+// ─── Test sequencer ───────────────────────────────────────────────────────────
+//
+// ramp, rand and the rgb patterns are state machines that cliUpdate()
+// advances once per loop(), so the button, the CLI and the status heartbeat
+// keep running underneath them. Each step is derived from the time since the
+// test started, so a ramp holds each level TEST_RAMP_STEP_MS however slow
+// the serial port is. Progress lines are rate-limited to one per TEST_PRINT_MS,
+// with a summary at the end. Any key aborts the running test.
+
+enum class TestSeq : uint8_t { NONE, RAMP, RAND, RAINBOW, CHASE };
+
+static constexpr uint32_t TEST_RAMP_STEP_MS    = 8;       // per level, min → max then max → min
+static constexpr uint32_t TEST_RAND_MS         = 10000;
+static constexpr uint32_t TEST_RAND_STEP_MS    = 80;
+static constexpr uint32_t TEST_RAINBOW_MS      = 10000;
+static constexpr uint32_t TEST_RAINBOW_STEP_MS = 30;
+static constexpr int      TEST_CHASE_LAPS      = 5;
+static constexpr uint32_t TEST_CHASE_STEP_MS   = 50;
+static constexpr uint32_t TEST_PRINT_MS        = 250;
+
+static const char* const TEST_SEQ_TAGS[] = {"", "[RAMP]", "[RAND]", "[RGB RAINBOW]", "[RGB CHASE]"};
+
+struct TestRun {
+    TestSeq  seq         = TestSeq::NONE;
+    uint8_t  mask        = 0;
+    uint32_t startMs     = 0;
+    uint32_t lastStep    = 0;    // step index last applied (rand, rainbow, chase)
+    int      lastValue   = -1;   // level last applied (ramp)
+    uint32_t steps       = 0;    // output updates so far
+    uint32_t lastPrintMs = 0;
+};
+static TestRun testRun;
+
+// Drive the PWM channels in mask to v; the RGB channel shows currentRgbColor at brightness v.
+static void testApplyLevel(uint8_t mask, int v) {
+    if (mask & CH_PWM) setChannelDuty(mask & CH_PWM, v);
+    if (mask & CH_RGB) {
+        fill_solid(leds, NUM_LEDS, currentRgbColor);
+        FastLED.setBrightness((uint8_t)v);
+        showStrip();
+    }
+}
+
+static bool testPrintDue(uint32_t now) {
+    if (now - testRun.lastPrintMs < TEST_PRINT_MS) return false;
+    testRun.lastPrintMs = now;
+    return true;
+}
+
+static void testSeqStart(TestSeq seq, uint8_t mask) {
+    testRun           = TestRun{};
+    testRun.seq       = seq;
+    testRun.mask      = mask;
+    testRun.startMs   = millis();
+    testRun.lastStep  = UINT32_MAX;
+    testRun.lastPrintMs = testRun.startMs - TEST_PRINT_MS;   // print the first step
+}
+
+// Leave the test's outputs off and report how it went.
+static void testSeqEnd(bool aborted) {
+    if (testRun.seq == TestSeq::NONE) return;
+    uint8_t pwmMask = testRun.mask & CH_PWM;
+    if (pwmMask) setChannelDuty(pwmMask, 0);
+    if (testRun.mask & CH_RGB) {
+        fill_solid(leds, NUM_LEDS, CRGB::Black);
+        FastLED.setBrightness(255);
+        showStrip();
+    }
+    Serial.printf("%s %s  %lu steps in %lu ms\n", TEST_SEQ_TAGS[(int)testRun.seq],
+        aborted ? "aborted" : "done", (unsigned long)testRun.steps,
+        (unsigned long)(millis() - testRun.startMs));
+    testRun.seq = TestSeq::NONE;
+}
+
+// Ramp PWM channels in mask; for RGB channel ramps brightness on currentRgbColor
+static void testRamp(uint8_t mask) {
+    Serial.printf("[RAMP] ");
+    printMaskName(mask);
+    uint32_t levels = (uint32_t)abs(testMaxBrightness - testMinBrightness) + 1;
+    Serial.printf("  %d->%d->%d  %lu ms per step, %lu ms each way  freq=%.0f Hz\n",
+        testMinBrightness, testMaxBrightness, testMinBrightness,
+        (unsigned long)TEST_RAMP_STEP_MS, (unsigned long)(levels * TEST_RAMP_STEP_MS), testPwmFreq);
+    testSeqStart(TestSeq::RAMP, mask);
+}
+
+static void testRand(uint8_t mask) {
+    Serial.printf("[RAND] ");
+    printMaskName(mask);
+    Serial.printf("  %lu s  range=%d-%d\n", (unsigned long)(TEST_RAND_MS / 1000),
+        testMinBrightness, testMaxBrightness);
+    testSeqStart(TestSeq::RAND, mask);
+}
+
 static void testRgbRainbow() {
-    Serial.println("[RGB RAINBOW] 10 s");
-    unsigned long end = millis() + 10000;
-    uint8_t hue = 0;
+    Serial.printf("[RGB RAINBOW] %lu s\n", (unsigned long)(TEST_RAINBOW_MS / 1000));
     FastLED.setBrightness((uint8_t)testMaxBrightness);
-    while (millis() < end) {
-        for (int i = 0; i < NUM_LEDS; i++) {
-            leds[i] = CHSV((uint8_t)(hue + i * (255 / NUM_LEDS)), 255, 255);
-        }
-        FastLED.show();
-        Serial.printf("  hue=%3d\n", hue);
-        hue++;
-        delay(30);
-    }
-    fill_solid(leds, NUM_LEDS, CRGB::Black);
-    FastLED.setBrightness(255);
-    FastLED.show();
-    Serial.println("[RGB RAINBOW] done");
+    testSeqStart(TestSeq::RAINBOW, CH_RGB);
 }
 
 static void testRgbChase() {
-    const int LAPS = 5;
-    Serial.printf("[RGB CHASE] %d laps\n", LAPS);
+    Serial.printf("[RGB CHASE] %d laps\n", TEST_CHASE_LAPS);
     FastLED.setBrightness((uint8_t)testMaxBrightness);
-    for (int lap = 0; lap < LAPS; lap++) {
-        for (int i = 0; i < NUM_LEDS; i++) {
+    testSeqStart(TestSeq::CHASE, CH_RGB);
+}
+
+// Apply whatever the running test should show now. Called every cliUpdate().
+static void testSeqStep() {
+    TestRun& r = testRun;
+    if (r.seq == TestSeq::NONE) return;
+    uint32_t now     = millis();
+    uint32_t elapsed = now - r.startMs;
+
+    switch (r.seq) {
+        case TestSeq::RAMP: {
+            // One level per step, every level both ways, as the blocking ramp did
+            int      dir    = testMaxBrightness >= testMinBrightness ? 1 : -1;
+            uint32_t levels = (uint32_t)abs(testMaxBrightness - testMinBrightness) + 1;
+            uint32_t step   = elapsed / TEST_RAMP_STEP_MS;
+            if (step >= 2 * levels) { testSeqEnd(false); return; }
+            bool up = step < levels;
+            int  v  = up ? testMinBrightness + dir * (int)step
+                         : testMaxBrightness - dir * (int)(step - levels);
+            if (v == r.lastValue) return;
+            r.lastValue = v;
+            testApplyLevel(r.mask, v);
+            r.steps++;
+            if (testPrintDue(now)) Serial.printf("  %s v=%4d\n", up ? "up  " : "down", v);
+            break;
+        }
+        case TestSeq::RAND: {
+            if (elapsed >= TEST_RAND_MS) { testSeqEnd(false); return; }
+            uint32_t step = elapsed / TEST_RAND_STEP_MS;
+            if (step == r.lastStep) return;
+            r.lastStep = step;
+            int range = testMaxBrightness - testMinBrightness;
+            if (range < 1) range = 1;
+            int v = testMinBrightness + random(0, range + 1);
+            testApplyLevel(r.mask, v);
+            r.steps++;
+            if (testPrintDue(now)) Serial.printf("  v=%4d\n", v);
+            break;
+        }
+        case TestSeq::RAINBOW: {
+            if (elapsed >= TEST_RAINBOW_MS) { testSeqEnd(false); return; }
+            uint32_t step = elapsed / TEST_RAINBOW_STEP_MS;
+            if (step == r.lastStep) return;
+            r.lastStep = step;
+            uint8_t hue = (uint8_t)step;
+            for (int i = 0; i < NUM_LEDS; i++) {
+                leds[i] = CHSV((uint8_t)(hue + i * (255 / NUM_LEDS)), 255, 255);
+            }
+            showStrip();
+            r.steps++;
+            if (testPrintDue(now)) Serial.printf("  hue=%3d\n", hue);
+            break;
+        }
+        case TestSeq::CHASE: {
+            uint32_t step = elapsed / TEST_CHASE_STEP_MS;
+            int      lap  = (int)(step / NUM_LEDS);
+            if (lap >= TEST_CHASE_LAPS) { testSeqEnd(false); return; }
+            if (step == r.lastStep) return;
+            r.lastStep = step;
+            int i = (int)(step % NUM_LEDS);
             fill_solid(leds, NUM_LEDS, CRGB::Black);
             leds[i] = CHSV((uint8_t)(lap * 51), 255, 255);
-            FastLED.show();
-            Serial.printf("  lap=%d  led=%2d\n", lap, i);
-            delay(50);
+            showStrip();
+            r.steps++;
+            if (i == 0) Serial.printf("  lap=%d\n", lap);
+            break;
         }
+        case TestSeq::NONE:
+            break;
     }
-    fill_solid(leds, NUM_LEDS, CRGB::Black);
-    FastLED.setBrightness(255);
-    FastLED.show();
-    Serial.println("[RGB CHASE] done");
 }
 
 // ─── Command dispatchers ──────────────────────────────────────────────────────
@@ -437,6 +564,12 @@ static void testRgbChase() {
 static void dispatchNormal(char* line) {
     if      (strcmp(line, "s") == 0) cmdStatus();
     else if (strcmp(line, "t") == 0) {
+        // The render task must stop touching the outputs (and lend `sim` the
+        // timebase) before test mode may drive them
+        if (!renderSetPaused(true)) {
+            Serial.println("[TEST] render task did not pause - not entering test mode");
+            return;
+        }
         ctx        = CliContext::TEST;
         testActive = true;
         testAllOff();
@@ -445,6 +578,9 @@ static void dispatchNormal(char* line) {
         printTestMenu();
     }
     else if (strncmp(line, "m ", 2) == 0) cmdSetMode(atoi(line + 2));
+    else if (strcmp(line, "perf") == 0)    perfPrint();
+    else if (strcmp(line, "log") == 0)     cmdLog(line + 3);
+    else if (strncmp(line, "log ", 4) == 0) cmdLog(line + 4);
     else if (strcmp(line, "?")  == 0) printNormalMenu();
     else Serial.printf("[CLI] Unknown: '%s'  (? for help)\n", line);
 }
@@ -517,6 +653,22 @@ static void dispatchTest(char* line) {
         uint8_t mask = ch ? parseChannelMask(ch) : testChannelMask;
         testRand(mask);
 
+    // ── bench [name] ──────────────────────────────────────────────────────────
+    } else if (strcmp(line, "bench") == 0) {
+        benchList();
+
+    } else if (strncmp(line, "bench ", 6) == 0) {
+        if (!benchRun(line + 6)) {
+            Serial.printf("[BENCH] Unknown benchmark '%s'\n", line + 6);
+            benchList();
+        }
+
+    // ── sim <mode> <duration> [...] ───────────────────────────────────────────
+    } else if (strncmp(line, "sim ", 4) == 0) {
+        SimOptions opt;
+        if (simParseArgs(line + 4, opt)) simRun(opt);
+        else Serial.println("[SIM] usage: sim <0-4> <n>[s|m|h|d] [fps=10-10000] [csv=<ms>] [seed=<n>] [start=<n>[s|m|h|d]]");
+
     // ── rgb ... ───────────────────────────────────────────────────────────────
     } else if (strncmp(line, "rgb", 3) == 0) {
         const char* arg = (line[3] == ' ') ? line + 4 : "";
@@ -548,14 +700,14 @@ static void dispatchTest(char* line) {
     // ── exit ──────────────────────────────────────────────────────────────────
     } else if (strcmp(line, "exit") == 0) {
         testAllOff();
-        for (int i = 0; i < 4; i++) {
-            ledcAttach(LED_PINS[i], PWM_FREQ, PWM_RESOLUTION);
-            ledcWrite(LED_PINS[i], 0);
-        }
+        ledSink().setPwmFrequency(PWM_FREQ);
         FastLED.setBrightness(WS2812_BRIGHTNESS);
         testActive = false;
         ctx = CliContext::NORMAL;
         Serial.println("[TEST] Exiting test mode");
+        if (!renderSetPaused(false)) {   // render task re-enters the current mode
+            Serial.println("[TEST] render task has not resumed yet (it will on its next frame)");
+        }
         printNormalMenu();
 
     } else if (strcmp(line, "?") == 0) {
@@ -609,9 +761,19 @@ void cliBegin() {
 }
 
 void cliUpdate() {
+    // A frame stream owns the port, and the outputs, until it ends
+    if (streamLinkActive()) {
+        if (streamLinkUpdate()) return;
+        if (testActive) testAllOff();
+        else            renderSetPaused(false);
+    }
+
     while (Serial.available()) {
         char c = (char)Serial.read();
 
+        // Typing anything stops a running test pattern; the key still counts
+        if (testRun.seq != TestSeq::NONE) testSeqEnd(true);
+
         // ── ANSI escape sequence ───────────────────────────────────────────────
         if (escState == EscState::NONE && c == '\x1b') {
             escState = EscState::ESC;
@@ -645,6 +807,19 @@ void cliUpdate() {
 
         if (c == '\r') continue;
 
+        // ── 0x00: start of a binary frame stream (stream.h) ────────────────────
+        if (c == '\0') {
+            inputLen = 0;
+            inputBuf[0] = '\0';
+            if (!renderSetPaused(true)) {
+                Serial.println("[STREAM] render task did not pause - stream refused");
+                continue;
+            }
+            streamLinkBegin();
+            streamLinkUpdate();
+            return;
+        }
+
         // ── Enter ──────────────────────────────────────────────────────────────
         if (c == '\n') {
             Serial.println();
@@ -663,6 +838,8 @@ void cliUpdate() {
         // ── Printable character ────────────────────────────────────────────────
         if (inputLen < BUF_SIZE - 1) { inputBuf[inputLen++] = c; Serial.print(c); }
     }
+
+    testSeqStep();
 }
 
 bool cliTestActive() {
@@ -7,8 +7,9 @@
 // Called once from setup() - prints the normal menu
 void cliBegin();
 
-// Called every loop() iteration - reads serial input and dispatches commands
+// Called every loop() iteration - reads serial input, dispatches commands and
+// advances any running test pattern (any key aborts it)
 void cliUpdate();
 
-// Returns true while a blocking test is running (loop() should skip normal mode updates)
+// Returns true while test mode owns the outputs (loop() should not commit rendered frames)
 bool cliTestActive();
@@ -0,0 +1,60 @@
+#include "color_strip.h"
+#include "config.h"
+
+CRGB colorPalette[256];
+
+// Blur taps out of 256: centre pixel and each neighbour. They sum to 256, so
+// a flat colour passes through unchanged.
+static constexpr uint16_t BLUR_CENTRE = 180;
+static constexpr uint16_t BLUR_SIDE   = 38;
+static_assert(BLUR_CENTRE + 2 * BLUR_SIDE == 256, "blur must preserve brightness");
+static_assert(sizeof(CRGB) == 3, "blur walks CRGB arrays as packed bytes");
+
+void hsvPaletteBuild(CRGB out[256], uint8_t sat, uint8_t val) {
+    for (int h = 0; h < 256; h++) hsv2rgb_rainbow(CHSV((uint8_t)h, sat, val), out[h]);
+}
+
+void colorPaletteBegin() {
+    hsvPaletteBuild(colorPalette, COLOR_SATURATION, COLOR_BRIGHTNESS);
+}
+
+void colorStripFill(const ColorStripView& s, uint8_t hue) {
+    memset(s.history, hue, 2 * s.ring);
+    *s.head = 0;
+}
+
+void colorStripPush(const ColorStripView& s, uint8_t hue) {
+    uint32_t pos = *s.head & (s.ring - 1);
+    s.history[pos]          = hue;
+    s.history[pos + s.ring] = hue;
+    (*s.head)++;
+}
+
+static inline uint8_t blurTap(uint8_t prev, uint8_t centre, uint8_t next) {
+    return (uint8_t)((BLUR_CENTRE * centre + BLUR_SIDE * (prev + next)) >> 8);
+}
+
+static void blurPixel(const CRGB* src, CRGB* out, int i, int prev, int next) {
+    for (int c = 0; c < 3; c++) out[i][c] = blurTap(src[prev][c], src[i][c], src[next][c]);
+}
+
+void colorStripRender(const ColorStripView& s, const uint8_t* jitter, CRGB* out) {
+    // Newest hue sits at base in the upper copy; older ones follow downwards
+    // without wrapping because base ≥ ring ≥ n.
+    const uint8_t* hist = s.history + ((*s.head - 1) & (s.ring - 1)) + s.ring;
+    for (int i = 0; i < s.n; i++) {
+        s.scratch[i] = colorPalette[(uint8_t)(hist[-i] + jitter[i])];
+    }
+
+    // Ping-pong blur, scratch → out. The strip is a ring: the ends wrap.
+    int n = s.n;
+    if (n < 3) {
+        for (int i = 0; i < n; i++) blurPixel(s.scratch, out, i, (i + n - 1) % n, (i + 1) % n);
+        return;
+    }
+    const uint8_t* a = s.scratch[0].raw;
+    uint8_t*       o = out[0].raw;
+    for (int k = 3; k < 3 * (n - 1); k++) o[k] = blurTap(a[k - 3], a[k], a[k + 3]);
+    blurPixel(s.scratch, out, 0, n - 1, 1);
+    blurPixel(s.scratch, out, n - 1, n - 2, 0);
+}
@@ -0,0 +1,65 @@
+#pragma once
+#include <Arduino.h>
+#include <FastLED.h>
+
+// ─── Colour-mode pixel pipeline ──────────────────────────────────────────────
+//
+// Colour mode spreads a hue history along the strip: pixel i shows the hue
+// pushed i steps ago, plus a little per-pixel jitter, then a 3-tap blur
+// softens the steps. Per pixel that is one palette lookup and one blur tap
+// set — no modulo, no HSV conversion:
+//
+//   history  double-mapped power-of-two ring. Every hue is written at pos and
+//            pos + RING, so the newest n entries are always one contiguous
+//            run read backwards from a single base index.
+//   colour   colorPalette[] — hue → RGB at COLOR_SATURATION/COLOR_BRIGHTNESS,
+//            built once at boot.
+//   blur     ping-pong: palette colours go to a scratch buffer and the blur
+//            reads only scratch, so no tap ever sees an already-blurred
+//            neighbour. The interior is a flat byte loop the compiler can
+//            unroll; only the two wrap-around end pixels are special.
+
+// hsv2rgb_rainbow(h, COLOR_SATURATION, COLOR_BRIGHTNESS) for every hue.
+extern CRGB colorPalette[256];
+
+// Fill out[h] = hsv2rgb_rainbow(h, sat, val) for every hue.
+void hsvPaletteBuild(CRGB out[256], uint8_t sat, uint8_t val);
+
+// Fill colorPalette. Call once from setup() before rendering.
+void colorPaletteBegin();
+
+// Smallest power of two holding n hues.
+inline constexpr int colorRingSize(int n) {
+    int r = 1;
+    while (r < n) r <<= 1;
+    return r;
+}
+
+// Non-owning view of a strip; what the kernels operate on.
+struct ColorStripView {
+    int       n;
+    int       ring;      // ring size, power of two ≥ n
+    uint8_t*  history;   // 2 × ring entries (double-mapped)
+    uint32_t* head;      // hues pushed so far
+    CRGB*     scratch;   // n pixels, pre-blur
+};
+
+template <int N>
+struct ColorStrip {
+    static constexpr int RING = colorRingSize(N);
+    uint8_t  history[2 * RING];
+    uint32_t head = 0;
+    CRGB     scratch[N];
+
+    ColorStripView view() { return {N, RING, history, &head, scratch}; }
+};
+
+// Set the whole history to one hue.
+void colorStripFill(const ColorStripView& s, uint8_t hue);
+
+// Push the newest hue; pixel 0 shows it on the next render.
+void colorStripPush(const ColorStripView& s, uint8_t hue);
+
+// Pixel i = palette[history[newest − i] + jitter[i]], then the 3-tap
+// wrap-around blur into out[n]. out must not alias the scratch buffer.
+void colorStripRender(const ColorStripView& s, const uint8_t* jitter, CRGB* out);
@@ -20,7 +20,8 @@ inline constexpr uint8_t PWM_RESOLUTION = 12;
 inline constexpr int     MAX_DUTY       = (1 << PWM_RESOLUTION) - 1; // 4095
 
 // Per-channel hard brightness caps (0–100 %).
-// PWM duty never exceeds dutyFromPercent(cap), regardless of mode requests.
+// PWM duty never exceeds dutyCap(ch): LedSink clamps every write, from the
+// mode engines and CLI test mode alike.
 inline constexpr int BRIGHTNESS_MAX_WHITE = 40;
 inline constexpr int BRIGHTNESS_MAX_UV    = 75;
 inline constexpr int BRIGHTNESS_MAX_RED   = 80;
@@ -29,14 +30,82 @@ inline constexpr int BRIGHTNESS_MAX_RED   = 80;
 inline constexpr int NUM_LEDS            = 20;
 inline constexpr int WS2812_BRIGHTNESS   = 64;  // global FastLED brightness (0–255)
 
+// WS2812 wire timing: 24 bits × 1.25 µs per pixel, then a >280 µs low latch.
+// Used to model transfer time where there is no hardware to measure.
+inline constexpr uint32_t WS2812_US_PER_PIXEL = 30;
+inline constexpr uint32_t WS2812_RESET_US     = 300;
+
+// Strip segments — the logical strip (leds[0 .. NUM_LEDS-1]) is cut into
+// consecutive runs, each on its own data pin and RMT channel. FastLED starts
+// every segment before waiting on any of them, so a refresh takes as long as
+// the longest segment, not the whole strip. Lengths must sum to NUM_LEDS;
+// one pin per RMT TX channel at most. A reversed segment is wired with its
+// first logical pixel at the far end of the run.
+// The PCB has one strip on GPIO33; larger installations can add runs on the
+// spare GPIO10/11/12, e.g. pins {33, 10, 11, 12} with lengths {60, 60, 60, 60}.
+inline constexpr int      STRIP_SEGMENT_PINS[]     = {WS2812_PIN};
+inline constexpr uint16_t STRIP_SEGMENT_LEDS[]     = {NUM_LEDS};
+inline constexpr bool     STRIP_SEGMENT_REVERSED[] = {false};
+inline constexpr int      STRIP_RMT_CHANNELS       = 4;   // ESP32-S3 RMT TX channels
+
 // Button
 inline constexpr unsigned long LONG_PRESS_TIME = 3000; // ms
 
+// Render task — mode engines run on their own core so CLI, button and
+// serial logging on the Arduino loop() core cannot stall the animation.
+// loop() runs on core 1 (ARDUINO_RUNNING_CORE); core 0 is free without WiFi.
+inline constexpr int      RENDER_CORE          = 0;
+inline constexpr int      RENDER_TASK_PRIORITY = 2;     // above loopTask (1)
+inline constexpr uint32_t RENDER_TASK_STACK    = 4096;  // bytes
+inline constexpr int      RENDER_CMD_QUEUE     = 8;     // pending mode commands (power of 2)
+
+// Strip output task — runs FastLED.show() so the caller only pays for a
+// 60-byte copy while the RMT clocks the frame out. Lives on the loop() core
+// and sleeps on the RMT semaphore for the whole transfer.
+inline constexpr int      OUTPUT_CORE          = 1;
+inline constexpr int      OUTPUT_TASK_PRIORITY = 3;     // wake promptly to start the next transfer
+inline constexpr uint32_t OUTPUT_TASK_STACK    = 3072;  // bytes
+
+// Log drain task — tagged diagnostics (log.h) are recorded into a ring where
+// they happen and formatted and written to Serial here, so float formatting
+// and a full USB CDC buffer never stall the caller. Shares the loop() core
+// at loopTask's priority, below the render and output tasks.
+inline constexpr int      LOG_CORE             = 1;
+inline constexpr int      LOG_TASK_PRIORITY    = 1;
+inline constexpr uint32_t LOG_TASK_STACK       = 3072;  // bytes
+inline constexpr uint32_t LOG_DRAIN_MS         = 10;    // drain poll interval
+inline constexpr size_t   LOG_RING             = 32;    // pending records (power of 2)
+inline constexpr int      LOG_MAX_ARGS         = 10;    // arguments per record
+inline constexpr size_t   LOG_LINE_MAX         = 192;   // formatted line, longer is cut
+
+// Performance counters — always-on stage timings from the CPU cycle counter
+// (perf.h), printed and reset by the CLI's `perf` command. false compiles
+// every probe out.
+inline constexpr bool     PERF_COUNTERS        = true;
+inline constexpr uint32_t PERF_STALL_US        = 5000;  // a sample this long counts as a stall
+inline constexpr uint32_t PERF_HEAP_MS         = 100;   // free-heap sample interval
+
+// PWM keyframes — loop() samples the rendered duties at this interval and
+// hands each change to the LEDC fade unit, which ramps the channel in
+// hardware until the next keyframe. 0 = ledcWrite() every rendered frame.
+// The engines keep rendering at the render task's rate either way.
+// Fades run 1 ms short of the interval: starting a fade on a channel whose
+// previous fade is still running blocks until it ends.
+inline constexpr uint32_t PWM_KEYFRAME_MS      = 10;    // 100 Hz control rate
+inline constexpr uint32_t PWM_KEYFRAME_FADE_MS = PWM_KEYFRAME_MS ? PWM_KEYFRAME_MS - 1 : 0;
+
 // Helper: convert 0–100 % to a PWM duty count
 inline constexpr int dutyFromPercent(int pct) {
     return (MAX_DUTY * pct) / 100;
 }
 
+// Hard cap of one LED_PINS[] channel as a duty count (BRIGHTNESS_MAX_*).
+inline constexpr int dutyCap(int ch) {
+    return dutyFromPercent(ch == UV_LED  ? BRIGHTNESS_MAX_UV
+                         : ch == RED_LED ? BRIGHTNESS_MAX_RED
+                         :                 BRIGHTNESS_MAX_WHITE);
+}
+
 
 // ─── Candle mode ──────────────────────────────────────────────────────────────
 //
@@ -52,6 +121,9 @@ inline constexpr int dutyFromPercent(int pct) {
 // Each sub-mode runs for a random duration within its MIN/MAX window (ms),
 // and the scheduler weights selection by these percentages.
 // Transitions between sub-modes crossfade over CANDLE_XFADE_MS.
+//
+// The per-sub-mode constants below are assembled into FLAME_PROFILES
+// (flame_profile.h); add a sub-mode there, not in the engine.
 
 inline constexpr int   CANDLE_PCT_CALM    = 45;   // % of time in calm mode
 inline constexpr int   CANDLE_PCT_FLICKER = 45;   // % of time in flicker mode
@@ -79,10 +151,10 @@ inline constexpr float CANDLE_SPLIT_DEPTH_FLICKER = 0.25f; // smaller but still
 
 // Snuff events (flicker mode only) — one white channel briefly dips near zero
 // then recovers, like a gas pocket momentarily killing the flame.
-// SNUFF_CHANCE : probability per frame of triggering (0–1000 scale, checked each update)
+// SNUFF_RATE   : average snuffs per second per channel (Poisson, frame-rate independent)
 // SNUFF_DEPTH  : how far the channel dips (1.0 = full off)
 // SNUFF_RECOVER: smoothing factor for recovery — higher = snappier return
-inline constexpr int   CANDLE_SNUFF_CHANCE   = 2;     // out of 1000 per frame
+inline constexpr float CANDLE_SNUFF_RATE     = 2.0f;  // per s — was 2/1000 per frame at 1 kHz
 inline constexpr float CANDLE_SNUFF_DEPTH    = 0.97f; // dip to ~3% of normal
 inline constexpr float CANDLE_SNUFF_RECOVER  = 0.08f; // lerp per ms back to normal
 
@@ -118,6 +190,14 @@ inline constexpr float CANDLE_WIND_SMOOTHING   = 0.22f;   // output lerp per ms
 inline constexpr float CANDLE_WIND_GUST_SPEED  = 0.006f;  // slow envelope Perlin per ms
 inline constexpr float CANDLE_WIND_GUST_DEPTH  = 0.85f;   // gust can pull flame very low
 
+// ── Strip flames ──────────────────────────────────────────────────────────────
+// In Candle mode each WS2812 pixel runs its own independent flame (CandleBank)
+// with the same sub-mode profiles, shown as a FastLED HeatColor between
+// HEAT_MIN (flame floor) and HEAT_MAX (flame peak).
+inline constexpr uint8_t CANDLE_STRIP_BRIGHTNESS = 96;   // pixel value scale (0 = strip stays dark)
+inline constexpr uint8_t CANDLE_STRIP_HEAT_MIN   = 40;   // deep red ember
+inline constexpr uint8_t CANDLE_STRIP_HEAT_MAX   = 170;  // orange-yellow tip
+
 
 // ─── Color mode ───────────────────────────────────────────────────────────────
 //
@@ -128,6 +208,7 @@ inline constexpr float COLOR_SPEED_MIN    = 0.002f; // ~2 min per full cycle —
 inline constexpr float COLOR_SPEED_MAX    = 0.12f;  // ~3 s per full cycle — visibly moving
 inline constexpr int   COLOR_BRIGHTNESS   = 160;    // WS2812 value channel (0–255)
 inline constexpr int   COLOR_SATURATION   = 240;    // WS2812 saturation (0–255)
+inline constexpr uint32_t COLOR_STEP_MS    = 20;     // colour engine update cadence
 
 
 // ─── Magic mode ───────────────────────────────────────────────────────────────
@@ -143,16 +224,38 @@ inline constexpr float         MAGIC_DRIFT_SPEED_MIN = 0.003f; // hue units/ms
 inline constexpr float         MAGIC_DRIFT_SPEED_MAX = 0.021f;
 inline constexpr int           MAGIC_DRIFT_BRIGHTNESS = 55;    // base WS2812 value
 inline constexpr int           MAGIC_DRIFT_RIPPLE     = 20;    // ± brightness ripple per LED
+inline constexpr int           MAGIC_DRIFT_SATURATION = 230;
+
+// Drift ripples: two sines along the strip whose phase also creeps with the
+// drift hue, so the pattern slides as the colour moves.
+// SPACING: radians between neighbouring pixels. RATE: radians per hue unit.
+inline constexpr float MAGIC_HUE_RIPPLE          = 6.0f;    // ± hue units
+inline constexpr float MAGIC_HUE_RIPPLE_SPACING  = 0.45f;
+inline constexpr float MAGIC_HUE_RIPPLE_RATE     = 0.025f;
+inline constexpr float MAGIC_VALUE_RIPPLE_SPACING = 0.30f;  // brightness ripple (± MAGIC_DRIFT_RIPPLE)
+inline constexpr float MAGIC_VALUE_RIPPLE_RATE    = 0.018f;
 
 // Spark phase: dim background with bright sparks
 inline constexpr unsigned long MAGIC_SPARK_PHASE_MIN  = 2000;  // ms
 inline constexpr unsigned long MAGIC_SPARK_PHASE_MAX  = 6000;
-inline constexpr int           MAGIC_SPARK_FADE       = 210;   // nscale8 decay per frame (0–255)
-inline constexpr int           MAGIC_SPARK_TINT_V     = 18;    // dim tint brightness added per frame
-inline constexpr int           MAGIC_SPARK_CHANCE     = 8;     // % chance per frame to spawn a spark
+// The background fades as if nscale8(FADE) then += tint ran once per ms,
+// scaled by dt: it settles at tint × 256 / (255 − FADE) whatever the frame rate.
+inline constexpr int           MAGIC_SPARK_FADE       = 210;   // background nscale8 decay per ms (0–255)
+inline constexpr int           MAGIC_SPARK_TINT_V     = 18;    // dim tint brightness added per ms
+inline constexpr float         MAGIC_SPARK_RATE       = 80.0f; // sparks per s — was 8% per frame at 1 kHz
 inline constexpr int           MAGIC_SPARK_BRIGHTNESS_MIN = 200;
 inline constexpr int           MAGIC_SPARK_BRIGHTNESS_MAX = 255;
 inline constexpr int           MAGIC_SPARK_HUE_SPREAD = 20;    // ± hue variation around drift hue
+inline constexpr int           MAGIC_SPARK_SATURATION = 200;
+
+// Sparks are particles (sparks.h): each flies along the strip in a random
+// direction and fades linearly to nothing. The pool holds rate × longest
+// life with room to spare; spawns beyond it are dropped.
+inline constexpr int           MAGIC_SPARK_POOL       = 64;
+inline constexpr int           MAGIC_SPARK_SPEED_MIN  = 8;     // pixels per s
+inline constexpr int           MAGIC_SPARK_SPEED_MAX  = 30;
+inline constexpr uint32_t      MAGIC_SPARK_LIFE_MIN   = 150;   // ms
+inline constexpr uint32_t      MAGIC_SPARK_LIFE_MAX   = 450;
 
 // Red LED drift in magic mode (independent slow random walk)
 inline constexpr float MAGIC_RED_STEP    = 0.000006f; // random-walk step per ms
@@ -161,3 +264,34 @@ inline constexpr float MAGIC_RED_CENTRE  = 0.45f;     // resting level (fraction
 inline constexpr float MAGIC_RED_PULL    = 0.000008f; // centre-pull strength per ms
 inline constexpr float MAGIC_RED_MIN     = 0.15f;     // minimum level
 inline constexpr float MAGIC_RED_MAX     = 0.85f;     // maximum level
+
+
+// ─── Auto mode ────────────────────────────────────────────────────────────────
+//
+// Cycles Candle, Color and Magic, holding each for a random time. On a change
+// the outgoing and incoming engines run side by side for AUTO_XFADE_MS while
+// their frames are blended (frameBlend). 0 = hard cut.
+
+inline constexpr uint32_t AUTO_HOLD_MIN_MS = 30000;
+inline constexpr uint32_t AUTO_HOLD_MAX_MS = 180000;
+inline constexpr uint32_t AUTO_XFADE_MS    = 4000;
+
+// ─── Trace mode ───────────────────────────────────────────────────────────────
+//
+// Plays a recorded flame trace (trace.h) from its own flash partition. Build
+// one with tools/trace_encode.py and write it at the partition's offset in
+// partitions.csv. Without a valid trace the mode runs the procedural candle.
+
+inline constexpr const char* TRACE_PARTITION         = "flametrace";
+inline constexpr uint8_t     TRACE_PARTITION_SUBTYPE = 0x40;  // custom data subtype
+inline constexpr uint16_t    TRACE_READ_BUF          = 128;   // bytes per reader window refill
+inline constexpr uint8_t     TRACE_STRIP_BRIGHTNESS  = 96;    // pixel value scale for the strip channel
+
+// ─── Frame stream ─────────────────────────────────────────────────────────────
+//
+// Binary frames from a PC on the CLI's USB serial port (stream.h). A 0x00
+// byte switches the port into stream mode; it drops back to the text CLI on
+// a STOP packet or after STREAM_IDLE_MS without a valid packet.
+
+inline constexpr uint32_t STREAM_IDLE_MS  = 2000;
+inline constexpr uint16_t STREAM_READ_BUF = 256;   // bytes pulled from the port per read
@@ -0,0 +1,101 @@
+#pragma once
+#include <stdint.h>
+
+// ─── Q16.16 fixed point ──────────────────────────────────────────────────────
+//
+// Fractions are int32_t with Q16_ONE (65536) = 1.0. Products go through
+// int64_t so intermediates never overflow — Xtensa does a 32×32→64 multiply
+// in two instructions, far cheaper than the soft-float paths it replaces.
+//
+// The ct*() functions are constexpr-only helpers for folding config.h floats
+// and building lookup tables at compile time. They are slow series
+// expansions; never call them at runtime.
+
+inline constexpr int32_t Q16_ONE = 65536;
+
+// Fold a compile-time constant into Q16 (rounded to nearest).
+inline constexpr int32_t q16(double x) {
+    return (int32_t)(x * 65536.0 + (x >= 0.0 ? 0.5 : -0.5));
+}
+
+// a × b in Q16, rounded to nearest.
+inline constexpr int32_t mulQ16(int32_t a, int32_t b) {
+    return (int32_t)(((int64_t)a * b + 0x8000) >> 16);
+}
+
+inline constexpr int32_t clampQ16(int32_t x, int32_t lo, int32_t hi) {
+    return x < lo ? lo : (x > hi ? hi : x);
+}
+
+// ── Compile-time math ─────────────────────────────────────────────────────────
+
+inline constexpr double CT_LN2 = 0.69314718055994530942;
+
+// Natural log: reduce to m·2^k with m in [1,2), then 2·atanh((m-1)/(m+1)).
+inline constexpr double ctLog(double x) {
+    int k = 0;
+    while (x >= 2.0) { x *= 0.5; k++; }
+    while (x < 1.0)  { x *= 2.0; k--; }
+    double y = (x - 1.0) / (x + 1.0), y2 = y * y, term = y, sum = 0.0;
+    for (int n = 1; n < 40; n += 2) { sum += term / n; term *= y2; }
+    return 2.0 * sum + k * CT_LN2;
+}
+
+// e^x: reduce to r + k·ln2 with |r| ≤ ln2/2, Taylor series, scale by 2^k.
+inline constexpr double ctExp(double x) {
+    int k = (int)(x / CT_LN2 + (x >= 0.0 ? 0.5 : -0.5));
+    double r = x - k * CT_LN2, term = 1.0, sum = 1.0;
+    for (int n = 1; n < 24; n++) { term *= r / n; sum += term; }
+    for (; k > 0; k--) sum *= 2.0;
+    for (; k < 0; k++) sum *= 0.5;
+    return sum;
+}
+
+inline constexpr double ctPow(double x, double e) {
+    return x <= 0.0 ? 0.0 : ctExp(e * ctLog(x));
+}
+
+// Sine by series after reducing to [-π, π].
+inline constexpr double CT_PI = 3.14159265358979323846;
+
+inline constexpr double ctSin(double x) {
+    while (x >  CT_PI) x -= 2.0 * CT_PI;
+    while (x < -CT_PI) x += 2.0 * CT_PI;
+    double term = x, sum = x;
+    for (int n = 1; n < 20; n++) { term *= -x * x / ((2 * n) * (2 * n + 1)); sum += term; }
+    return sum;
+}
+
+// ── Sine table ────────────────────────────────────────────────────────────────
+//
+// Phases are uint16_t turns (65536 = 2π), so advancing one wraps for free.
+// 256 entries, nearest lookup: worst error ~1.2 % of full scale, below one
+// step of anything drawn on 8-bit pixels with a ripple of a few dozen units.
+
+struct SineTable {
+    int16_t v[256];
+};
+
+inline constexpr SineTable makeSineTable() {
+    SineTable t{};
+    for (int i = 0; i < 256; i++) {
+        double s = ctSin(2.0 * CT_PI * i / 256.0) * 32767.0;
+        t.v[i] = (int16_t)(s + (s >= 0.0 ? 0.5 : -0.5));
+    }
+    return t;
+}
+
+inline constexpr SineTable SINE_TABLE = makeSineTable();
+
+// Fold an angle in radians into a uint16_t phase step.
+inline constexpr uint16_t phaseFromRadians(double rad) {
+    double turns = rad / (2.0 * CT_PI);
+    turns -= (double)(int64_t)turns;
+    if (turns < 0.0) turns += 1.0;
+    return (uint16_t)(uint32_t)(turns * 65536.0 + 0.5);
+}
+
+// sin(2π · phase / 65536) in Q15 (±32767).
+inline int16_t sinQ15(uint16_t phase) {
+    return SINE_TABLE.v[(uint8_t)((phase + 0x80) >> 8)];
+}
@@ -0,0 +1,84 @@
+#pragma once
+#include <stdint.h>
+#include "config.h"
+#include "fixed_point.h"
+#include "flame_profile.h"
+#include "noise_table.h"
+
+// ─── Flame profiles in Q16 ───────────────────────────────────────────────────
+//
+// FLAME_PROFILES folded to fixed point at compile time, plus the small
+// integer helpers shared by the single-flame engine (candle.cpp) and the
+// per-pixel CandleBank.
+
+// Noise phase advance per ms for a speed in inoise8 units per ms.
+inline constexpr uint32_t phaseRate(float unitsPerMs) {
+    return (uint32_t)(unitsPerMs * 65536.0f + 0.5f);
+}
+
+// A FlameProfile folded to Q16 for the integer engine.
+struct FixedProfile {
+    uint32_t rate[FLAME_OCTAVES];     // noise phase advance per ms, per octave
+    int32_t  weight[FLAME_OCTAVES];   // normalised octave weights
+    int32_t  base, span;              // level = base + span * fbm
+    int32_t  gustDepth;               // gust envelope depth (0 = none)
+    int32_t  smoothing;               // output lerp per ms
+    int32_t  invPeak;                 // 1 / peak brightness, for the red dimness term
+    int32_t  split;                   // W1/W2 drift depth
+};
+
+inline constexpr FixedProfile fixedProfile(const FlameProfile& p) {
+    FixedProfile f{};
+    for (int k = 0; k < FLAME_OCTAVES; k++) {
+        f.rate[k]   = phaseRate(flameOctaveSpeed(p, k));
+        f.weight[k] = q16(flameOctaveWeight(p, k));
+    }
+    f.base      = q16(p.brightness * (1.0f - p.depth));
+    f.span      = q16(p.brightness * p.depth);
+    f.gustDepth = q16(p.gustDepth);
+    f.smoothing = q16(p.smoothing);
+    f.invPeak   = q16(1.0 / p.brightness);
+    f.split     = q16(p.split);
+    return f;
+}
+
+struct FixedProfiles {
+    FixedProfile p[FLAME_SUBMODES];
+};
+
+inline constexpr FixedProfiles makeFixedProfiles() {
+    FixedProfiles t{};
+    for (int m = 0; m < FLAME_SUBMODES; m++) t.p[m] = fixedProfile(FLAME_PROFILES[m]);
+    return t;
+}
+
+// Indexed by FlameSubMode
+inline constexpr FixedProfiles FIXED_PROFILES = makeFixedProfiles();
+
+// Noise wavetable sample as a Q16 fraction 0–Q16_ONE.
+inline int32_t noiseQ16(uint32_t phase) {
+    int32_t n = noiseSample(phase);
+    return n + (n >> 8);
+}
+
+// Phase advance for one frame of dtQ16 ms at a phaseRate().
+inline uint32_t phaseAdvance(uint32_t rate, uint32_t dtQ16) {
+    return (uint32_t)(((uint64_t)rate * dtQ16) >> 16);
+}
+
+// A recovering snuff closer than this to 1.0 snaps back to rest. Without it
+// the exponential approach stalls one LSB short and the channel never rolls
+// for another snuff until the sub-mode changes.
+inline constexpr float SNUFF_REST_EPSILON = 1.0f / 256.0f;
+
+inline constexpr int32_t SNUFF_DIP_Q16     = q16(1.0 - CANDLE_SNUFF_DEPTH);
+inline constexpr int32_t SNUFF_RECOVER_Q16 = q16(CANDLE_SNUFF_RECOVER);
+inline constexpr int32_t SNUFF_REST_Q16    = q16(1.0 - SNUFF_REST_EPSILON);
+
+// Advance one snuff multiplier: start a dip on trigger if at rest, else recover.
+inline void snuffStepQ16(int32_t& snuff, bool trigger, int32_t recover) {
+    if (snuff >= Q16_ONE && !trigger) return;
+    if (snuff >= Q16_ONE) snuff = SNUFF_DIP_Q16;   // trigger dip
+    snuff += mulQ16(Q16_ONE - snuff, recover);
+    if (snuff >= SNUFF_REST_Q16) snuff = Q16_ONE;
+}
@@ -0,0 +1,92 @@
+#pragma once
+#include "config.h"
+
+// ─── Flame profiles ──────────────────────────────────────────────────────────
+//
+// One row per candle sub-mode, assembled from the tuning constants in
+// config.h. The engines read every per-sub-mode value from this table, so a
+// new sub-mode is a new enum value, its constants and one more row — no
+// switch statements to extend and no extra per-frame branching.
+//
+// A flame level is an fBm sum: each octave samples noise on its own axis at
+// its own speed, weighted. Weights are normalised at compile time, so they
+// only need to be right relative to each other. Profiles may use different
+// octave counts; the engines unroll over the largest (FLAME_OCTAVES) and
+// unused octaves carry zero weight.
+
+enum class FlameSubMode : uint8_t { CALM, FLICKER, WIND, COUNT };
+
+inline constexpr int FLAME_SUBMODES    = (int)FlameSubMode::COUNT;
+inline constexpr int FLAME_MAX_OCTAVES = 4;
+
+struct FlameOctave {
+    float speed;    // Perlin advance per ms
+    float weight;   // relative share of the level
+};
+
+struct FlameProfile {
+    const char* name;
+    int   pct;          // % of time spent in this sub-mode
+    float brightness;   // peak output (fraction of MAX_DUTY)
+    float depth;        // noise modulation depth (floor = peak*(1-depth))
+    float smoothing;    // output lerp per ms
+    float split;        // ± W1/W2 drift (fraction of level)
+    float gustDepth;    // slow gust envelope depth (0 = none)
+    int   octaves;
+    FlameOctave octave[FLAME_MAX_OCTAVES];
+};
+
+// Indexed by FlameSubMode
+inline constexpr FlameProfile FLAME_PROFILES[FLAME_SUBMODES] = {
+    { "CALM", CANDLE_PCT_CALM,
+      CANDLE_CALM_BRIGHTNESS, CANDLE_CALM_DEPTH, CANDLE_CALM_SMOOTHING,
+      CANDLE_SPLIT_DEPTH, 0.0f,
+      2, { { CANDLE_CALM_SPEED,  1.0f - CANDLE_CALM_OCTAVE2 },
+           { CANDLE_CALM_SPEED2, CANDLE_CALM_OCTAVE2 } } },
+    { "FLICKER", CANDLE_PCT_FLICKER,
+      CANDLE_FLICKER_BRIGHTNESS, CANDLE_FLICKER_DEPTH, CANDLE_FLICKER_SMOOTHING,
+      CANDLE_SPLIT_DEPTH_FLICKER, 0.0f,
+      2, { { CANDLE_FLICKER_SPEED,  1.0f - CANDLE_FLICKER_OCTAVE2 },
+           { CANDLE_FLICKER_SPEED2, CANDLE_FLICKER_OCTAVE2 } } },
+    { "WIND", CANDLE_PCT_WIND,
+      CANDLE_WIND_BRIGHTNESS, CANDLE_WIND_DEPTH, CANDLE_WIND_SMOOTHING,
+      CANDLE_SPLIT_DEPTH_FLICKER, CANDLE_WIND_GUST_DEPTH,
+      2, { { CANDLE_WIND_SPEED,  1.0f - CANDLE_WIND_OCTAVE2 },
+           { CANDLE_WIND_SPEED2, CANDLE_WIND_OCTAVE2 } } },
+};
+
+// Octaves the engines unroll over: the most any profile uses.
+inline constexpr int flameMaxOctaves() {
+    int n = 1;
+    for (const auto& p : FLAME_PROFILES) n = p.octaves > n ? p.octaves : n;
+    return n;
+}
+inline constexpr int FLAME_OCTAVES = flameMaxOctaves();
+
+inline constexpr float flameWeightSum(const FlameProfile& p) {
+    float sum = 0.0f;
+    for (int k = 0; k < p.octaves; k++) sum += p.octave[k].weight;
+    return sum;
+}
+
+// Normalised weight of octave k (0 beyond the profile's octave count).
+inline constexpr float flameOctaveWeight(const FlameProfile& p, int k) {
+    return k < p.octaves ? p.octave[k].weight / flameWeightSum(p) : 0.0f;
+}
+
+inline constexpr float flameOctaveSpeed(const FlameProfile& p, int k) {
+    return k < p.octaves ? p.octave[k].speed : 0.0f;
+}
+
+inline constexpr bool flameProfilesValid() {
+    int pct = 0;
+    for (const auto& p : FLAME_PROFILES) {
+        if (p.octaves < 1 || p.octaves > FLAME_MAX_OCTAVES) return false;
+        if (flameWeightSum(p) <= 0.0f || p.brightness <= 0.0f) return false;
+        pct += p.pct;
+    }
+    return pct == 100;
+}
+static_assert(flameProfilesValid(),
+              "FLAME_PROFILES: octave counts 1..FLAME_MAX_OCTAVES, positive weights "
+              "and brightness, PCT values summing to 100");
@@ -0,0 +1,19 @@
+#include "frame.h"
+
+void frameClear(Frame& f) {
+    fill_solid(f.leds, NUM_LEDS, CRGB::Black);
+    for (int ch = 0; ch < 4; ch++) f.duty[ch] = 0;
+}
+
+void frameBlend(const Frame& a, const Frame& b, uint16_t amount, Frame& out) {
+    // CRGB is three packed bytes, so the pixels are one run of channels
+    const uint8_t* pa = reinterpret_cast<const uint8_t*>(a.leds);
+    const uint8_t* pb = reinterpret_cast<const uint8_t*>(b.leds);
+    uint8_t*       po = reinterpret_cast<uint8_t*>(out.leds);
+    for (int i = 0; i < NUM_LEDS * 3; i++) {
+        po[i] = (uint8_t)(pa[i] + (((int32_t)pb[i] - pa[i]) * amount >> 8));
+    }
+    for (int ch = 0; ch < 4; ch++) {
+        out.duty[ch] = (uint16_t)(a.duty[ch] + (((int32_t)b.duty[ch] - a.duty[ch]) * amount >> 8));
+    }
+}
@@ -0,0 +1,29 @@
+#pragma once
+#include <Arduino.h>
+#include <FastLED.h>
+#include "config.h"
+
+// ─── Frame ────────────────────────────────────────────────────────────────────
+//
+// Everything a mode engine draws in one frame: the strip pixels and the four
+// PWM duties. Engines render into a Frame they are handed and never touch
+// the hardware; the render task publishes its frame to the output stage in
+// loop(), which alone commits it to the sink. Because the target is just
+// memory, two engines can render side by side into frames of their own and
+// be blended (Auto mode crossfades), or run against a virtual clock (sim).
+//
+// An engine may keep drawing on top of what it left in its frame last time
+// (Color mode only redraws on its colour steps), so each engine needs a
+// target that persists between its own updates.
+
+struct Frame {
+    CRGB     leds[NUM_LEDS];
+    uint16_t duty[4];        // PWM duty per LED_PINS[] channel
+};
+
+// All pixels black, all duties zero.
+void frameClear(Frame& f);
+
+// out = a + (b − a) × amount / 256, pixels and duties alike. amount runs
+// 0–256 so both ends are exact. out may alias a or b.
+void frameBlend(const Frame& a, const Frame& b, uint16_t amount, Frame& out);
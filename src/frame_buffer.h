@@ -0,0 +1,56 @@
+#pragma once
+#include <stdint.h>
+#include <string.h>
+#include <atomic>
+
+// ─── Double-buffered frame handoff ───────────────────────────────────────────
+//
+// One writer publishes whole frames; one reader on another core picks up the
+// newest one. A seqlock over two slots: seq_ is twice the number of frames
+// published, odd while the writer is filling a slot. Frame n lives in slot
+// n & 1, so writing frame n + 1 leaves frame n intact and a reader only
+// retries if two publishes land during its copy — the writer never waits.
+//
+// The writer marks seq_ odd and fences before touching a slot, so a reader
+// that saw any of those bytes is guaranteed to see the odd mark (or later)
+// when it re-reads seq_ after its own fence.
+//
+// T must be trivially copyable. Portable (std::atomic only) so the handoff can
+// be stress-tested on a Linux host with std::thread.
+
+template <typename T>
+class FrameBuffer {
+public:
+    // Writer side: copy a finished frame into the back slot and flip.
+    void publish(const T& frame) {
+        uint32_t seq = seq_.load(std::memory_order_relaxed);
+        seq_.store(seq + 1, std::memory_order_relaxed);          // odd: slot being written
+        std::atomic_thread_fence(std::memory_order_release);
+        memcpy(&slots_[((seq >> 1) + 1) & 1], &frame, sizeof(T));
+        seq_.store(seq + 2, std::memory_order_release);
+    }
+
+    // Reader side: copy the newest frame into out if it is newer than
+    // lastSeq (a sequence() value). Returns false when nothing new has been
+    // published.
+    bool read(T& out, uint32_t& lastSeq) const {
+        for (;;) {
+            uint32_t before = seq_.load(std::memory_order_acquire) & ~1u;   // newest complete frame
+            if ((before >> 1) == lastSeq) return false;
+            memcpy(&out, &slots_[(before >> 1) & 1], sizeof(T));
+            std::atomic_thread_fence(std::memory_order_acquire);
+            // Our slot is rewritten from the second publish after it (seq before + 3)
+            if (seq_.load(std::memory_order_relaxed) - before <= 2) {
+                lastSeq = before >> 1;
+                return true;
+            }
+        }
+    }
+
+    // Frames published so far.
+    uint32_t sequence() const { return seq_.load(std::memory_order_acquire) >> 1; }
+
+private:
+    T slots_[2] = {};
+    std::atomic<uint32_t> seq_{0};
+};
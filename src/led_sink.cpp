@@ -0,0 +1,209 @@
+#include "led_sink.h"
+#include "strip_segments.h"
+#include "perf.h"
+
+// ─── Shared dirty-frame check ─────────────────────────────────────────────────
+//
+// Most frames leave the strip untouched (Candle mode never draws on it,
+// power-off holds it black), so keep a copy of the last frame actually sent
+// and only transmit when pixels or global brightness moved.
+
+void LedSink::show(const CRGB* leds, uint8_t brightness) {
+    if (shownValid_ && brightness == shownBrightness_ &&
+        memcmp(shownLeds_, leds, sizeof(shownLeds_)) == 0) {
+        showsSkipped++;
+        return;
+    }
+    memcpy(shownLeds_, leds, sizeof(shownLeds_));
+    shownBrightness_ = brightness;
+    shownValid_      = true;
+    showsSent++;
+    transmit(leds, brightness);
+}
+
+// ─── Duty coalescing ──────────────────────────────────────────────────────────
+//
+// Engines hand over all four duties every frame, and most frames move none
+// or one of them (UV holds a constant, Candle leaves it at zero). Only
+// changed channels cost a peripheral write.
+
+void LedSink::commitDuty() {
+    for (uint8_t ch = 0; ch < 4; ch++) {
+        if ((committedKnown_ & (1 << ch)) && staged_[ch] == committed_[ch]) {
+            dutyElided++;
+            continue;
+        }
+        outputDuty(ch, staged_[ch]);
+        committed_[ch]   = staged_[ch];
+        committedKnown_ |= 1 << ch;
+        dutyWrites++;
+    }
+}
+
+void LedSink::writeDuties(const uint16_t duty[4]) {
+    for (uint8_t ch = 0; ch < 4; ch++) setDuty(ch, duty[ch]);
+    commitDuty();
+}
+
+void LedSink::fadeDuty(uint8_t ch, uint16_t from, uint16_t to, uint32_t ms) {
+    from = capDuty(ch, from);
+    to   = capDuty(ch, to);
+    staged_[ch] = to;
+    if ((committedKnown_ & (1 << ch)) && to == committed_[ch]) {
+        dutyElided++;
+        return;
+    }
+    outputFade(ch, from, to, ms);
+    committed_[ch]   = to;
+    committedKnown_ |= 1 << ch;
+    dutyWrites++;
+}
+
+void LedSink::setPwmFrequency(double hz) {
+    attachPwm(hz);
+    for (uint8_t ch = 0; ch < 4; ch++) staged_[ch] = committed_[ch] = 0;
+    committedKnown_ = 0x0F;
+}
+
+// ─── Recording sink ───────────────────────────────────────────────────────────
+
+void RecordingLedSink::outputFade(uint8_t ch, uint16_t from, uint16_t to, uint32_t ms) {
+    fade_[ch] = {from, to, now(), ms * 1000};
+}
+
+uint16_t RecordingLedSink::duty(uint8_t ch) const {
+    const Fade& f = fade_[ch];
+    uint32_t elapsed = now() - f.startUs;
+    if (elapsed >= f.lengthUs) return f.to;
+    int32_t span = (int32_t)f.to - (int32_t)f.from;
+    return (uint16_t)(f.from + (int64_t)span * elapsed / f.lengthUs);
+}
+
+void RecordingLedSink::transmit(const CRGB* leds, uint8_t brightness) {
+    uint32_t t = now();
+    // A new frame queues behind one still on the wire, as the RMT would.
+    uint32_t start = stripBusy() ? busyUntil_ : t;
+    busyUntil_ = start + stripWireUs(STRIP_LAYOUT);
+
+    if (count_ >= capacity_) { dropped_++; return; }
+    LedRecord& r = records_[count_++];
+    r.startUs    = t;
+    r.doneUs     = busyUntil_;
+    r.brightness = brightness;
+    for (int ch = 0; ch < 4; ch++) r.duty[ch] = duty(ch);
+    memcpy(r.leds, leds, sizeof(r.leds));
+}
+
+#if defined(ESP32)
+
+// ─── Async hardware sink ──────────────────────────────────────────────────────
+//
+// transmit() copies the frame into a staging buffer and wakes the output task,
+// which scatters it into the front buffer registered with FastLED — one
+// controller per strip segment — and runs FastLED.show(). The segments clock
+// out in parallel and the task sleeps on the RMT driver until the last one ends;
+// the caller is already rendering the next frame into its own buffer.
+// If frames arrive faster than the wire drains them, the newest staged frame
+// wins — intermediate ones are never sent.
+
+// The data pin is a template argument, so the segment table is walked at
+// compile time.
+template <int SEG = 0>
+static void addStripSegments(CRGB* wire) {
+    if constexpr (SEG < STRIP_SEGMENTS) {
+        FastLED.addLeds<WS2812, STRIP_SEGMENT_PINS[SEG], GRB>(
+            wire + stripSegmentFirst(STRIP_LAYOUT, SEG), STRIP_SEGMENT_LEDS[SEG]);
+        addStripSegments<SEG + 1>(wire);
+    }
+}
+
+class AsyncLedSink : public LedSink {
+public:
+    void begin() override {
+        setPwmFrequency(PWM_FREQ);
+        addStripSegments(front_);
+        xTaskCreatePinnedToCore(outputTask, "ledout", OUTPUT_TASK_STACK, this,
+                                OUTPUT_TASK_PRIORITY, &task_, OUTPUT_CORE);
+    }
+
+    bool stripBusy() const override { return completed_ != submitted_; }
+
+protected:
+    void outputDuty(uint8_t ch, uint16_t duty) override {
+        ledcWrite(LED_PINS[ch], duty);
+    }
+
+    // Non-blocking as long as the channel's previous fade has finished.
+    void outputFade(uint8_t ch, uint16_t from, uint16_t to, uint32_t ms) override {
+        ledcFade(LED_PINS[ch], from, to, (int)ms);
+    }
+
+    void attachPwm(double hz) override {
+        for (int i = 0; i < 4; i++) {
+            ledcAttach(LED_PINS[i], hz, PWM_RESOLUTION);
+            ledcWrite(LED_PINS[i], 0);
+        }
+    }
+
+    void transmit(const CRGB* leds, uint8_t brightness) override {
+        portENTER_CRITICAL(&mux_);
+        memcpy(staged_, leds, sizeof(CRGB) * NUM_LEDS);
+        stagedBrightness_ = brightness;
+        submitted_++;
+        portEXIT_CRITICAL(&mux_);
+        xTaskNotifyGive(task_);
+    }
+
+private:
+    static void outputTask(void* arg) {
+        AsyncLedSink* self = static_cast<AsyncLedSink*>(arg);
+        for (;;) {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+            // Take the staged frame by swapping buffers; the scatter runs
+            // with interrupts on and transmit() free to stage the next one.
+            portENTER_CRITICAL(&self->mux_);
+            CRGB* taken         = self->staged_;
+            self->staged_       = self->spare_;
+            self->spare_        = taken;
+            uint8_t  brightness = self->stagedBrightness_;
+            uint32_t seq        = self->submitted_;
+            portEXIT_CRITICAL(&self->mux_);
+
+            stripScatter(STRIP_LAYOUT, taken, self->front_);
+
+            {
+                PerfScope perf(PERF_SHOW);
+                FastLED.show(brightness);
+            }
+            self->completed_ = seq;
+        }
+    }
+
+    CRGB              front_[NUM_LEDS];   // wire order, read by the RMT driver
+    CRGB              stageBufs_[2][NUM_LEDS];
+    CRGB*             staged_ = stageBufs_[0];   // newest frame not yet on the wire
+    CRGB*             spare_  = stageBufs_[1];   // the output task's, between swaps
+    uint8_t           stagedBrightness_ = 0;
+    volatile uint32_t submitted_ = 0;
+    volatile uint32_t completed_ = 0;
+    portMUX_TYPE      mux_  = portMUX_INITIALIZER_UNLOCKED;
+    TaskHandle_t      task_ = nullptr;
+};
+
+LedSink& ledSink() {
+    static AsyncLedSink sink;
+    return sink;
+}
+
+#else
+
+// Host builds: record everything into a fixed window, latest frames dropped.
+static LedRecord hostRecords[256];
+
+LedSink& ledSink() {
+    static RecordingLedSink sink(hostRecords, sizeof(hostRecords) / sizeof(hostRecords[0]));
+    return sink;
+}
+
+#endif
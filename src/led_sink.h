@@ -0,0 +1,145 @@
+#pragma once
+#include <Arduino.h>
+#include <FastLED.h>
+#include "config.h"
+
+// ─── LED output sink ──────────────────────────────────────────────────────────
+//
+// Every write to the physical outputs — the four PWM channels and the WS2812
+// strip — goes through one LedSink. Mode engines never touch ledcWrite() or
+// FastLED.show() directly.
+//
+// show() is non-blocking: an implementation starts the strip transfer from its
+// own front buffer and returns, so the caller can immediately start filling
+// the next frame. Frames identical to the last one sent (pixels and global
+// brightness) are skipped before they reach the implementation.
+//
+// PWM duties are coalesced the same way. The sink keeps the duty last
+// committed to each channel; setDuty() stages a value, commitDuty() writes
+// only the channels whose duty actually changed, and the rest are counted as
+// elided. Every duty is clamped to its channel's dutyCap() here — the one
+// place the BRIGHTNESS_MAX_* caps are enforced for engines and CLI alike.
+//
+// Two implementations:
+//   AsyncLedSink      (ESP32)  — output task runs FastLED.show() off the caller's path
+//   RecordingLedSink  (any)    — stores timestamped frames in a caller-owned
+//                                array, modelling WS2812 wire time (longest
+//                                strip segment, see strip_segments.h) and LEDC
+//                                fades, so output latency and keyframe
+//                                interpolation can be measured on a host build
+
+class LedSink {
+public:
+    virtual ~LedSink() = default;
+
+    // Attach PWM pins / register the strip. Called once from setup().
+    virtual void begin() {}
+
+    // Stage a duty count for one PWM channel (index into LED_PINS[]). Nothing
+    // reaches the peripheral until commitDuty().
+    void setDuty(uint8_t ch, uint16_t duty) { staged_[ch] = capDuty(ch, duty); }
+
+    // Write every channel whose staged duty differs from the committed one.
+    void commitDuty();
+
+    // Stage and commit: one channel, or all four at the end of a frame.
+    void writeDuty(uint8_t ch, uint16_t duty) { setDuty(ch, duty); commitDuty(); }
+    void writeDuties(const uint16_t duty[4]);
+
+    // Ramp one PWM channel linearly from `from` to `to` over `ms`, in hardware
+    // where the sink has it. Returns immediately. Elided when the channel is
+    // already committed to `to`.
+    void fadeDuty(uint8_t ch, uint16_t from, uint16_t to, uint32_t ms);
+
+    // Re-attach all PWM channels at a new carrier frequency, outputs at zero.
+    void setPwmFrequency(double hz);
+
+    // Queue a strip frame for transfer; returns without waiting for the wire.
+    void show(const CRGB* leds, uint8_t brightness);
+
+    // True while a previously started strip transfer is still in flight.
+    virtual bool stripBusy() const { return false; }
+
+    uint32_t showsSent    = 0;
+    uint32_t showsSkipped = 0;
+    uint32_t dutyWrites   = 0;   // channel writes and fades that reached the peripheral
+    uint32_t dutyElided   = 0;   // channel commits dropped as unchanged
+
+protected:
+    // Start pushing leds[] (already known to differ from the last frame).
+    virtual void transmit(const CRGB* leds, uint8_t brightness) = 0;
+
+    // Drive one channel (already capped and known to change).
+    virtual void outputDuty(uint8_t ch, uint16_t duty) = 0;
+
+    // Start a hardware fade. Default: jump to `to`.
+    virtual void outputFade(uint8_t ch, uint16_t /*from*/, uint16_t to, uint32_t /*ms*/) { outputDuty(ch, to); }
+
+    // Re-attach the PWM channels at hz with every output at zero.
+    virtual void attachPwm(double /*hz*/) {}
+
+private:
+    static uint16_t capDuty(uint8_t ch, uint16_t duty) {
+        return duty > dutyCap(ch) ? (uint16_t)dutyCap(ch) : duty;
+    }
+
+    CRGB     shownLeds_[NUM_LEDS];
+    uint8_t  shownBrightness_ = 0;
+    bool     shownValid_      = false;
+    uint16_t staged_[4]       = {0, 0, 0, 0};
+    uint16_t committed_[4]    = {0, 0, 0, 0};
+    uint8_t  committedKnown_  = 0;       // bit per channel: committed_[] matches the output
+};
+
+// One recorded output frame. duty[] is the PWM state at the time of the show.
+struct LedRecord {
+    uint32_t startUs;        // when show() handed the frame over
+    uint32_t doneUs;         // modelled end of the wire transfer + latch
+    uint16_t duty[4];
+    uint8_t  brightness;
+    CRGB     leds[NUM_LEDS];
+};
+
+class RecordingLedSink : public LedSink {
+public:
+    // records[] is caller-owned; recording stops (and counts drops) when full.
+    // clockUs defaults to micros() — pass a virtual clock for simulated runs.
+    RecordingLedSink(LedRecord* records, size_t capacity, uint32_t (*clockUs)() = nullptr)
+        : records_(records), capacity_(capacity), clockUs_(clockUs) {}
+
+    bool stripBusy() const override { return (int32_t)(now() - busyUntil_) < 0; }
+
+    // Modelled LEDC output of one channel right now, mid-fade included.
+    uint16_t duty(uint8_t ch) const;
+
+    size_t           count()   const { return count_; }
+    uint32_t         dropped() const { return dropped_; }
+    const LedRecord& at(size_t i) const { return records_[i]; }
+    void             clear() { count_ = 0; dropped_ = 0; }
+
+protected:
+    void transmit(const CRGB* leds, uint8_t brightness) override;
+    void outputDuty(uint8_t ch, uint16_t duty) override { outputFade(ch, duty, duty, 0); }
+    void outputFade(uint8_t ch, uint16_t from, uint16_t to, uint32_t ms) override;
+    void attachPwm(double /*hz*/) override { for (uint8_t ch = 0; ch < 4; ch++) outputDuty(ch, 0); }
+
+private:
+    uint32_t now() const { return clockUs_ ? clockUs_() : (uint32_t)micros(); }
+
+    LedRecord* records_;
+    size_t     capacity_;
+    uint32_t (*clockUs_)();
+    size_t     count_     = 0;
+    uint32_t   dropped_   = 0;
+    uint32_t   busyUntil_ = 0;
+
+    // One linear LEDC ramp per channel; a plain write is a zero-length fade.
+    struct Fade {
+        uint16_t from = 0, to = 0;
+        uint32_t startUs = 0, lengthUs = 0;
+    };
+    Fade fade_[4];
+};
+
+// The sink that drives the real hardware on this build.
+LedSink& ledSink();
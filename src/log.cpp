@@ -0,0 +1,159 @@
+#include "log.h"
+
+const char* const LOG_TAG_NAMES[LOG_TAGS] = {"CANDLE", "AUTO", "TRACE", "MODE", "PWR", "BTN", "STATUS"};
+const char* const LOG_LEVEL_NAMES[LOG_OFF + 1] = {"debug", "info", "warn", "error", "off"};
+
+std::atomic<uint8_t> logThreshold[LOG_TAGS] = {
+    {LOG_INFO}, {LOG_INFO}, {LOG_INFO}, {LOG_INFO}, {LOG_INFO}, {LOG_INFO}, {LOG_INFO},
+};
+
+static LogQueue              logQueue;
+static std::atomic<uint32_t> logLogged{0};
+static std::atomic<uint32_t> logDropped{0};
+static std::atomic<uint32_t> logCut{0};
+
+bool logPush(const LogRecord& r) {
+    if (!logQueue.push(r)) {
+        logDropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    logLogged.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+// ─── Formatting ───────────────────────────────────────────────────────────────
+
+// Each conversion is handed to snprintf on its own, with the stored argument
+// cast to what its length modifier and conversion expect — a va_list cannot
+// be rebuilt portably from stored values.
+size_t logFormat(const LogRecord& r, char* out, size_t size) {
+    if (size == 0) return 0;
+    size_t      n   = 0;
+    int         arg = 0;
+    const char* p   = r.fmt;
+
+    while (*p && n + 1 < size) {
+        if (*p != '%') { out[n++] = *p++; continue; }
+        if (p[1] == '%') { out[n++] = '%'; p += 2; continue; }
+
+        // Copy one conversion spec ("%-7s", "%6.3f", "%lu") and note its length modifier
+        char   spec[16];
+        size_t k     = 0;
+        int    longs = 0;
+        bool   sizeT = false;
+        spec[k++] = *p++;
+        while (*p && !strchr("diouxXcspfFeEgGaA", *p)) {
+            if (*p == 'l') longs++;
+            if (*p == 'z') sizeT = true;
+            if (k < sizeof(spec) - 2) spec[k++] = *p;
+            p++;
+        }
+        if (!*p) break;
+        char conv = *p++;
+        spec[k++] = conv;
+        spec[k]   = '\0';
+
+        char*  dst  = out + n;
+        size_t room = size - n;
+        int    w;
+        if (arg >= r.argc) {
+            w = snprintf(dst, room, "%%?");
+        } else {
+            const LogArg& a    = r.args[arg];
+            LogArgKind    kind = (LogArgKind)((r.kinds >> (2 * arg)) & 3);
+            arg++;
+            int64_t i = kind == LOG_ARG_FLOAT ? (int64_t)a.f : a.i;
+            switch (conv) {
+                case 'd': case 'i':
+                    w = sizeT      ? snprintf(dst, room, spec, (ptrdiff_t)i)
+                      : longs >= 2 ? snprintf(dst, room, spec, (long long)i)
+                      : longs == 1 ? snprintf(dst, room, spec, (long)i)
+                      :              snprintf(dst, room, spec, (int)i);
+                    break;
+                case 'o': case 'u': case 'x': case 'X':
+                    w = sizeT      ? snprintf(dst, room, spec, (size_t)i)
+                      : longs >= 2 ? snprintf(dst, room, spec, (unsigned long long)i)
+                      : longs == 1 ? snprintf(dst, room, spec, (unsigned long)i)
+                      :              snprintf(dst, room, spec, (unsigned)i);
+                    break;
+                case 'c':
+                    w = snprintf(dst, room, spec, (int)i);
+                    break;
+                case 's':
+                    w = snprintf(dst, room, spec, kind == LOG_ARG_PTR && a.p ? (const char*)a.p : "(?)");
+                    break;
+                case 'p':
+                    w = snprintf(dst, room, spec, kind == LOG_ARG_PTR ? a.p : nullptr);
+                    break;
+                default:
+                    w = snprintf(dst, room, spec, kind == LOG_ARG_FLOAT ? a.f : (double)i);
+                    break;
+            }
+        }
+        if (w < 0) break;
+        n += (size_t)w < room ? (size_t)w : room - 1;
+    }
+    out[n] = '\0';
+    return n;
+}
+
+// ─── Drain task ───────────────────────────────────────────────────────────────
+
+static void logTask(void*) {
+    LogRecord r;
+    char      line[LOG_LINE_MAX];
+    uint32_t  reportedDrops = 0;
+
+    for (;;) {
+        while (logQueue.pop(r)) {
+            int head = snprintf(line, sizeof(line), "%lu.%03lu [%s] ",
+                (unsigned long)(r.tUs / 1000000), (unsigned long)(r.tUs / 1000 % 1000),
+                r.tag < LOG_TAGS ? LOG_TAG_NAMES[r.tag] : "?");
+            size_t n = (size_t)head + logFormat(r, line + head, sizeof(line) - head - 1);
+            if (n + 2 >= sizeof(line)) logCut.fetch_add(1, std::memory_order_relaxed);
+            line[n++] = '\n';
+            Serial.write((const uint8_t*)line, n);
+        }
+
+        uint32_t drops = logDropped.load(std::memory_order_relaxed);
+        if (drops != reportedDrops) {
+            Serial.printf("[LOG] %lu records dropped (ring full)\n", (unsigned long)(drops - reportedDrops));
+            reportedDrops = drops;
+        }
+        vTaskDelay(pdMS_TO_TICKS(LOG_DRAIN_MS));
+    }
+}
+
+void logBegin() {
+    xTaskCreatePinnedToCore(logTask, "log", LOG_TASK_STACK, nullptr,
+                            LOG_TASK_PRIORITY, nullptr, LOG_CORE);
+}
+
+// ─── Filters and counters ─────────────────────────────────────────────────────
+
+void logSetLevel(LogTag tag, LogLevel level) {
+    logThreshold[tag].store(level, std::memory_order_relaxed);
+}
+
+LogLevel logLevel(LogTag tag) {
+    return (LogLevel)logThreshold[tag].load(std::memory_order_relaxed);
+}
+
+LogStats logStats() {
+    return {logLogged.load(std::memory_order_relaxed), logDropped.load(std::memory_order_relaxed),
+            logCut.load(std::memory_order_relaxed)};
+}
+
+bool logParseTag(const char* s, LogTag& out) {
+    for (int t = 0; t < LOG_TAGS; t++) {
+        if (strcasecmp(s, LOG_TAG_NAMES[t]) == 0) { out = (LogTag)t; return true; }
+    }
+    return false;
+}
+
+bool logParseLevel(const char* s, LogLevel& out) {
+    for (int l = 0; l <= LOG_OFF; l++) {
+        if (strcasecmp(s, LOG_LEVEL_NAMES[l]) == 0) { out = (LogLevel)l; return true; }
+    }
+    return false;
+}
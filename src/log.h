@@ -0,0 +1,127 @@
+#pragma once
+#include <Arduino.h>
+#include <atomic>
+#include <type_traits>
+#include "config.h"
+#include "mpsc_queue.h"
+
+// ─── Deferred logging ─────────────────────────────────────────────────────────
+//
+// Tagged diagnostics that cost their caller almost nothing. logInfo() and
+// friends do no formatting: they check the tag's level filter, then record
+// the format-string pointer, a micros() timestamp and the raw arguments into
+// a lock-free ring (MpscQueue — the render task and loop() both log). A
+// low-priority drain task on the loop() core formats each record and writes
+// it to Serial, so neither float formatting nor a full USB CDC buffer can
+// stall the render path. When the ring is full the record is dropped and
+// counted; the drain reports the loss.
+//
+// Because formatting happens later, on another task, the format string and
+// every %s argument must outlive the call: string literals and static names
+// (MODES[].name, flameSubModeName()) are fine, stack buffers are not.
+// Arguments are integers, floats and such strings, at most LOG_MAX_ARGS.
+//
+// Output lines read "<seconds>.<ms> [TAG] message", stamped when logged.
+
+enum LogLevel : uint8_t { LOG_DEBUG, LOG_INFO, LOG_WARN, LOG_ERROR, LOG_OFF };
+
+enum LogTag : uint8_t { LOG_CANDLE, LOG_AUTO, LOG_TRACE, LOG_MODE, LOG_PWR, LOG_BTN, LOG_STATUS, LOG_TAGS };
+
+extern const char* const LOG_TAG_NAMES[LOG_TAGS];
+extern const char* const LOG_LEVEL_NAMES[LOG_OFF + 1];
+
+enum LogArgKind : uint8_t { LOG_ARG_INT, LOG_ARG_FLOAT, LOG_ARG_PTR };
+
+union LogArg {
+    int64_t     i;
+    double      f;
+    const void* p;
+};
+
+struct LogRecord {
+    const char* fmt;
+    uint32_t    tUs;
+    uint32_t    kinds;   // LogArgKind of each argument, 2 bits apiece
+    uint8_t     tag;
+    uint8_t     level;
+    uint8_t     argc;
+    LogArg      args[LOG_MAX_ARGS];
+};
+static_assert(LOG_MAX_ARGS <= 16, "LogRecord::kinds holds 16 arguments");
+
+using LogQueue = MpscQueue<LogRecord, LOG_RING>;
+
+struct LogStats {
+    uint32_t logged;    // records queued
+    uint32_t dropped;   // records lost to a full ring
+    uint32_t cut;       // lines truncated at LOG_LINE_MAX
+};
+
+// Per-tag minimum level; read on every call, so a plain relaxed load.
+extern std::atomic<uint8_t> logThreshold[LOG_TAGS];
+
+inline bool logEnabled(LogTag tag, LogLevel level) {
+    return level >= logThreshold[tag].load(std::memory_order_relaxed);
+}
+
+template <typename T>
+inline void logPut(LogRecord& r, int i, T v) {
+    if constexpr (std::is_floating_point<T>::value) {
+        r.args[i].f = v;
+        r.kinds |= (uint32_t)LOG_ARG_FLOAT << (2 * i);
+    } else if constexpr (std::is_pointer<T>::value) {
+        r.args[i].p = v;
+        r.kinds |= (uint32_t)LOG_ARG_PTR << (2 * i);
+    } else {
+        static_assert(std::is_integral<T>::value || std::is_enum<T>::value,
+                      "log arguments are integers, floats or static strings");
+        r.args[i].i = (int64_t)v;
+    }
+}
+
+// Fill r with a message; no formatting. The hot-path half of every log call.
+template <typename... A>
+inline void logCapture(LogRecord& r, LogTag tag, LogLevel level, const char* fmt, A... args) {
+    static_assert(sizeof...(A) <= LOG_MAX_ARGS, "more log arguments than LOG_MAX_ARGS");
+    r.fmt   = fmt;
+    r.tUs   = (uint32_t)micros();
+    r.kinds = 0;
+    r.tag   = tag;
+    r.level = level;
+    r.argc  = (uint8_t)sizeof...(A);
+    int i = 0;
+    (logPut(r, i++, args), ...);
+    (void)i;
+}
+
+// Queue a record for the drain; false (and counted) when the ring is full.
+bool logPush(const LogRecord& r);
+
+template <typename... A>
+inline void logMsg(LogTag tag, LogLevel level, const char* fmt, A... args) {
+    if (!logEnabled(tag, level)) return;
+    LogRecord r;
+    logCapture(r, tag, level, fmt, args...);
+    logPush(r);
+}
+
+template <typename... A> inline void logDebug(LogTag t, const char* fmt, A... a) { logMsg(t, LOG_DEBUG, fmt, a...); }
+template <typename... A> inline void logInfo (LogTag t, const char* fmt, A... a) { logMsg(t, LOG_INFO,  fmt, a...); }
+template <typename... A> inline void logWarn (LogTag t, const char* fmt, A... a) { logMsg(t, LOG_WARN,  fmt, a...); }
+template <typename... A> inline void logError(LogTag t, const char* fmt, A... a) { logMsg(t, LOG_ERROR, fmt, a...); }
+
+// Format r's message (printf rules, arguments from the record) into
+// out[size]. Returns the length written; size − 1 means it was cut.
+size_t logFormat(const LogRecord& r, char* out, size_t size);
+
+// Start the drain task. Called once from setup(); records logged before it
+// wait in the ring.
+void logBegin();
+
+void     logSetLevel(LogTag tag, LogLevel level);
+LogLevel logLevel(LogTag tag);
+LogStats logStats();
+
+// Case-insensitive tag / level names, as printed by the CLI's `log` command.
+bool logParseTag(const char* s, LogTag& out);
+bool logParseLevel(const char* s, LogLevel& out);
@@ -0,0 +1,41 @@
+#include "magic_drift.h"
+#include "config.h"
+#include "fixed_point.h"
+#include "color_strip.h"
+
+static CRGB magicPalette[256];   // hue → RGB at MAGIC_DRIFT_SATURATION, full value
+
+// Per-pixel phase steps and per-hue-unit phase rates, as uint16_t turns
+static constexpr uint16_t HUE_STEP   = phaseFromRadians(MAGIC_HUE_RIPPLE_SPACING);
+static constexpr uint16_t VALUE_STEP = phaseFromRadians(MAGIC_VALUE_RIPPLE_SPACING);
+static constexpr float    HUE_RATE   = MAGIC_HUE_RIPPLE_RATE   * (float)(65536.0 / (2.0 * CT_PI));
+static constexpr float    VALUE_RATE = MAGIC_VALUE_RIPPLE_RATE * (float)(65536.0 / (2.0 * CT_PI));
+
+// Ripple amplitudes applied to a Q15 sine: hue in Q8 hue units, value in
+// Q8 brightness units, so one shift brings both back to integers.
+static constexpr int32_t HUE_AMP_Q8   = (int32_t)(MAGIC_HUE_RIPPLE * 256.0f);
+static constexpr int32_t VALUE_AMP_Q8 = MAGIC_DRIFT_RIPPLE * 256;
+
+void magicDriftBegin() {
+    hsvPaletteBuild(magicPalette, MAGIC_DRIFT_SATURATION, 255);
+}
+
+void magicDriftRender(CRGB* out, int n, float driftHue) {
+    // Everything float happens once per frame
+    uint16_t hueQ8      = (uint16_t)(int32_t)(driftHue * 256.0f);
+    uint16_t huePhase   = (uint16_t)(uint32_t)(driftHue * HUE_RATE);
+    uint16_t valuePhase = (uint16_t)(uint32_t)(driftHue * VALUE_RATE);
+
+    for (int i = 0; i < n; i++) {
+        int32_t hueRipple   = (sinQ15(huePhase)   * HUE_AMP_Q8)   >> 15;
+        int32_t valueRipple = (sinQ15(valuePhase) * VALUE_AMP_Q8) >> 15;
+        uint8_t h = (uint8_t)((hueQ8 + hueRipple) >> 8);
+        uint8_t v = (uint8_t)(MAGIC_DRIFT_BRIGHTNESS + (valueRipple >> 8));
+
+        out[i] = magicPalette[h];
+        out[i].nscale8(scale8_video(v, v));   // hsv2rgb_rainbow's own value curve
+
+        huePhase   += HUE_STEP;
+        valuePhase += VALUE_STEP;
+    }
+}
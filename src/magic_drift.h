@@ -0,0 +1,19 @@
+#pragma once
+#include <Arduino.h>
+#include <FastLED.h>
+
+// ─── Magic drift ripple ──────────────────────────────────────────────────────
+//
+// The DRIFT phase of Magic mode: every pixel near the drift hue, with a hue
+// ripple and a brightness ripple running along the strip. Both ripples are
+// sines whose argument grows by a fixed step per pixel, so the kernel keeps
+// two uint16_t phases and adds a constant to each — one sine-table load per
+// ripple per pixel, no sinf(). Colour comes from a hue palette at
+// MAGIC_DRIFT_SATURATION, scaled by value the same way hsv2rgb_rainbow()
+// scales it, so pixels match the per-pixel HSV conversion it replaces.
+
+// Build the drift palette. Call once from setup() before rendering.
+void magicDriftBegin();
+
+// Draw n ripple pixels for the current drift hue (0–256).
+void magicDriftRender(CRGB* out, int n, float driftHue);
@@ -0,0 +1,71 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+
+// ─── Multi-producer / single-consumer ring ───────────────────────────────────
+//
+// Lock-free bounded FIFO for when more than one task produces (here: the
+// render task, loop() and the CLI all log) and exactly one consumes. Like
+// SpscQueue it has no FreeRTOS or Arduino dependencies.
+//
+// Every slot carries a sequence number saying whose turn it is. A producer
+// claims a slot by advancing head_ with a compare-exchange, fills it, then
+// publishes it by bumping the slot's sequence; the consumer reads a slot only
+// once its sequence says it was published, and hands it back to producers one
+// lap later. A producer that finds its slot still unread returns false, so
+// push() never blocks or spins on the consumer.
+//
+// N must be a power of two.
+
+template <typename T, size_t N>
+class MpscQueue {
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "MpscQueue size must be a power of two");
+
+public:
+    MpscQueue() {
+        for (size_t i = 0; i < N; i++) slots_[i].seq.store((uint32_t)i, std::memory_order_relaxed);
+    }
+
+    // Any producer. Returns false (and drops v) when the ring is full.
+    bool push(const T& v) {
+        uint32_t pos = head_.load(std::memory_order_relaxed);
+        for (;;) {
+            Slot&   s    = slots_[pos & (N - 1)];
+            int32_t diff = (int32_t)(s.seq.load(std::memory_order_acquire) - pos);
+            if (diff == 0) {
+                // Slot is free this lap; claim it unless another producer got there first
+                if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    s.value = v;
+                    s.seq.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;   // the consumer has not freed it yet: full
+            } else {
+                pos = head_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Consumer side. Returns false when the ring is empty (or the oldest
+    // claimed slot is still being filled).
+    bool pop(T& out) {
+        uint32_t pos = tail_.load(std::memory_order_relaxed);
+        Slot&    s   = slots_[pos & (N - 1)];
+        if (s.seq.load(std::memory_order_acquire) != pos + 1) return false;
+        out = s.value;
+        s.seq.store(pos + N, std::memory_order_release);
+        tail_.store(pos + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+private:
+    struct Slot {
+        std::atomic<uint32_t> seq;
+        T                     value;
+    };
+    Slot                  slots_[N];
+    std::atomic<uint32_t> head_{0};   // next slot a producer claims
+    std::atomic<uint32_t> tail_{0};   // written by consumer only
+};
@@ -0,0 +1,15 @@
+#include <Arduino.h>
+#include <FastLED.h>
+#include "noise_table.h"
+
+DRAM_ATTR uint8_t noiseTable[NOISE_TABLE_SIZE + 1];
+
+void noiseTableBegin() {
+    for (int i = 0; i < NOISE_TABLE_SIZE; i++) {
+        // inoise8 clusters around 128 (~64–192 practical range); rescale to 0–255.
+        int raw = (int)inoise8((uint16_t)(i * NOISE_TABLE_STEP));
+        raw = (raw - 64) * 255 / 128;
+        noiseTable[i] = (uint8_t)constrain(raw, 0, 255);
+    }
+    noiseTable[NOISE_TABLE_SIZE] = noiseTable[0];
+}
@@ -0,0 +1,36 @@
+#pragma once
+#include <stdint.h>
+
+// ─── 1D noise wavetable ──────────────────────────────────────────────────────
+//
+// FastLED's inoise8() is periodic over a 16-bit coordinate. We precompute it
+// once at boot every NOISE_TABLE_STEP coordinate units, already rescaled from
+// its ~64–192 practical range to 0–255, and sample with linear interpolation.
+//
+// Positions are fixed-point phases: the upper 16 bits are the inoise8
+// coordinate, the lower 16 bits a fraction of one unit. A uint32_t phase wraps
+// exactly at the noise period, so it can be advanced forever without drift.
+
+inline constexpr int      NOISE_TABLE_BITS = 12;                      // 4096 entries
+inline constexpr int      NOISE_TABLE_SIZE = 1 << NOISE_TABLE_BITS;
+inline constexpr uint32_t NOISE_TABLE_STEP = 65536 / NOISE_TABLE_SIZE; // 16 coordinate units
+
+// One extra guard entry (== entry 0) so interpolation never needs a mask.
+extern uint8_t noiseTable[NOISE_TABLE_SIZE + 1];
+
+// Fill noiseTable from inoise8(). Call once from setup() before rendering.
+void noiseTableBegin();
+
+// Convert a coordinate in inoise8 units (may be fractional) to a phase.
+inline constexpr uint32_t noisePhaseFromUnits(float units) {
+    return (uint32_t)(int64_t)(units * 65536.0f);
+}
+
+// Interpolated noise at phase. Returns 0–65280 (0–255 in Q8.8).
+inline uint16_t noiseSample(uint32_t phase) {
+    uint32_t idx  = phase >> (32 - NOISE_TABLE_BITS);
+    uint32_t frac = (phase >> (16 - NOISE_TABLE_BITS)) & 0xFFFF;   // 0–65535 within one entry
+    int32_t  a    = noiseTable[idx];
+    int32_t  b    = noiseTable[idx + 1];
+    return (uint16_t)((a << 8) + (((b - a) * (int32_t)frac) >> 8));
+}
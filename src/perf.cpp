@@ -0,0 +1,113 @@
+#include <math.h>
+#include "perf.h"
+
+extern const ModeConfig MODES[];
+
+static PerfHist              perfHist[PERF_STAGES];
+static std::atomic<uint32_t> perfEpoch{1};      // PerfHist{} starts at 0: stale until first sample
+static uint8_t               perfShift    = 7;  // floor(log2(cycles per µs))
+static uint32_t              perfMhz      = 240;
+static uint32_t              perfStallCyc = PERF_STALL_US * 240;
+
+// loop() only
+static uint32_t perfResetMs = 0;
+static uint32_t perfHeapMs  = 0;
+static uint32_t perfHeapLow = UINT32_MAX;
+
+static const char* const PERF_STAGE_NAMES[PERF_MODE] = {"loop", "cli", "button", "commit", "show", "frame"};
+
+void perfBegin() {
+    perfMhz      = getCpuFrequencyMhz();
+    perfShift    = (uint8_t)(31 - __builtin_clz(perfMhz));
+    perfStallCyc = PERF_STALL_US * perfMhz;
+    perfResetMs  = millis();
+}
+
+void perfRecord(PerfStage s, uint32_t cyc) {
+    PerfHist& h = perfHist[s];
+    uint32_t  e = perfEpoch.load(std::memory_order_relaxed);
+    if (h.epoch != e) {
+        h       = PerfHist{};
+        h.epoch = e;
+    }
+    h.count++;
+    h.sumCyc   += cyc;
+    h.sumSqCyc += (uint64_t)cyc * cyc;
+    if (cyc > h.maxCyc) h.maxCyc = cyc;
+    if (cyc >= perfStallCyc) h.stalls++;
+
+    int b = cyc ? 31 - __builtin_clz(cyc) - perfShift : 0;
+    h.buckets[b < 0 ? 0 : b >= PERF_BUCKETS ? PERF_BUCKETS - 1 : b]++;
+}
+
+void perfSampleHeap() {
+    if (!PERF_COUNTERS) return;
+    uint32_t now = millis();
+    if (now - perfHeapMs < PERF_HEAP_MS) return;
+    perfHeapMs = now;
+    uint32_t free = ESP.getFreeHeap();
+    if (free < perfHeapLow) perfHeapLow = free;
+}
+
+void perfReset() {
+    perfEpoch.fetch_add(1, std::memory_order_relaxed);
+    perfResetMs = millis();
+    perfHeapLow = UINT32_MAX;
+}
+
+// ─── Report ───────────────────────────────────────────────────────────────────
+
+// "<edge" in µs of the bucket holding quantile q, or ">=" the last edge.
+static void perfQuantile(const PerfHist& h, float q, char* out, size_t size) {
+    uint32_t want = (uint32_t)(h.count * q);
+    uint32_t seen = 0;
+    int      b    = 0;
+    for (; b < PERF_BUCKETS - 1; b++) {
+        seen += h.buckets[b];
+        if (seen > want) break;
+    }
+    bool     open = b == PERF_BUCKETS - 1;
+    uint32_t edge = (uint32_t)(((uint64_t)1 << (b + perfShift + (open ? 0 : 1))) / perfMhz);
+    snprintf(out, size, "%s%lu", open ? ">=" : "<", (unsigned long)edge);
+}
+
+void perfPrint() {
+    uint32_t epoch   = perfEpoch.load(std::memory_order_relaxed);
+    float    seconds = (millis() - perfResetMs) / 1000.0f;
+    if (seconds <= 0.0f) seconds = 0.001f;
+
+    // Snapshot first so the rates and the table describe the same samples
+    static PerfHist snap[PERF_STAGES];
+    for (int s = 0; s < PERF_STAGES; s++) {
+        snap[s] = perfHist[s];
+        if (snap[s].epoch != epoch) snap[s] = PerfHist{};
+    }
+
+    const PerfHist& frame = snap[PERF_FRAME];
+    double meanFrame = frame.count ? (double)frame.sumCyc / frame.count : 0.0;
+    double varFrame  = frame.count ? (double)frame.sumSqCyc / frame.count - meanFrame * meanFrame : 0.0;
+    Serial.printf("[PERF] %.1f s  loop=%.0f/s  frames=%.0f/s  frame interval=%.0f us  jitter=%.1f us rms  "
+                  "(stall >= %lu us)\n", seconds, snap[PERF_LOOP].count / seconds, frame.count / seconds,
+        meanFrame / perfMhz, sqrt(varFrame > 0.0 ? varFrame : 0.0) / perfMhz,
+        (unsigned long)PERF_STALL_US);
+
+    Serial.println("[PERF] stage         count    mean us     p50     p99    max us  stalls");
+    for (int s = 0; s < PERF_STAGES; s++) {
+        const PerfHist& h = snap[s];
+        if (h.count == 0) continue;
+        const char* name = s < PERF_MODE ? PERF_STAGE_NAMES[s] : MODES[s - PERF_MODE].name;
+        char p50[16], p99[16];
+        perfQuantile(h, 0.50f, p50, sizeof(p50));
+        perfQuantile(h, 0.99f, p99, sizeof(p99));
+        Serial.printf("[PERF] %-9s %9lu %10.1f %7s %7s %9lu %7lu\n", name,
+            (unsigned long)h.count, (double)h.sumCyc / h.count / perfMhz, p50, p99,
+            (unsigned long)(h.maxCyc / perfMhz), (unsigned long)h.stalls);
+    }
+
+    Serial.printf("[PERF] heap  free=%luB  low since reset=%luB  low since boot=%luB\n",
+        (unsigned long)ESP.getFreeHeap(),
+        (unsigned long)(perfHeapLow == UINT32_MAX ? ESP.getFreeHeap() : perfHeapLow),
+        (unsigned long)ESP.getMinFreeHeap());
+
+    perfReset();
+}
@@ -0,0 +1,71 @@
+#pragma once
+#include <Arduino.h>
+#include <atomic>
+#include "config.h"
+#include "types.h"
+
+// ─── Performance counters ─────────────────────────────────────────────────────
+//
+// Where frame time goes, measured in the field. Each stage below is timed
+// with the CPU cycle counter and folded into a PerfHist: count, sum, worst
+// case, samples over PERF_STALL_US, and a histogram of power-of-two buckets
+// (bucket k holds samples of roughly 2^k to 2^(k+1) µs). A sample costs a
+// handful of adds and a count-leading-zeros; nothing allocates or locks.
+//
+// Every stage has exactly one writer task: loop() for LOOP, CLI, BUTTON and
+// COMMIT, the render task for FRAME and the mode stages, the strip output
+// task for SHOW. The CLI's `perf` command reads them without stopping
+// anyone — a figure can be one sample stale — then resets them by bumping
+// an epoch that each writer notices on its next sample, so no stage is
+// ever written by two tasks.
+
+enum PerfStage : uint8_t {
+    PERF_LOOP,       // one loop() pass
+    PERF_CLI,        // cliUpdate()
+    PERF_BUTTON,     // handleButton()
+    PERF_COMMIT,     // rendered frame → leds[] and the PWM sink
+    PERF_SHOW,       // FastLED.show() in the output task, wire time included
+    PERF_FRAME,      // interval between render frames — a period, not a duration
+    PERF_MODE,       // + CandleMode: that mode's updateFunction
+    PERF_STAGES = PERF_MODE + NUM_MODES
+};
+
+inline constexpr int PERF_BUCKETS = 16;
+
+struct PerfHist {
+    uint32_t epoch;
+    uint32_t count;
+    uint32_t maxCyc;
+    uint32_t stalls;                   // samples of PERF_STALL_US or more
+    uint64_t sumCyc;
+    uint64_t sumSqCyc;                 // spread, e.g. frame-interval jitter
+    uint32_t buckets[PERF_BUCKETS];
+};
+
+inline uint32_t perfNow() {
+    return PERF_COUNTERS ? ESP.getCycleCount() : 0;
+}
+
+// Fold one sample of `cycles` into stage s. Call only from the stage's task.
+void perfRecord(PerfStage s, uint32_t cycles);
+
+// Times the enclosing block into one stage.
+struct PerfScope {
+    PerfStage stage;
+    uint32_t  start;
+    explicit PerfScope(PerfStage s) : stage(s), start(perfNow()) {}
+    ~PerfScope() { if (PERF_COUNTERS) perfRecord(stage, perfNow() - start); }
+};
+
+// Size the buckets and stall threshold for the CPU clock. Called once from setup().
+void perfBegin();
+
+// Track the free-heap low-water mark; called every loop() pass, samples
+// every PERF_HEAP_MS.
+void perfSampleHeap();
+
+// Print every stage, loop and frame rate, frame jitter and heap, then reset.
+void perfPrint();
+
+// Start a new measurement window.
+void perfReset();
@@ -0,0 +1,43 @@
+#pragma once
+#include <stdint.h>
+#include <math.h>
+#include "prng.h"
+
+// ─── Poisson event timer ─────────────────────────────────────────────────────
+//
+// Random events (snuffs, sparks) with a rate in events per second instead of
+// a chance per frame, so they look the same at any frame rate. The gap to
+// the next event is drawn from an exponential distribution when the previous
+// one fires; in between, poll() is a single 64-bit compare against the frame
+// time — no RNG call on the frames where nothing happens.
+
+// Longest backlog poll() will replay after a stall or pause. Older events
+// are dropped and the timer restarts from now.
+inline constexpr uint64_t POISSON_MAX_LAG_US = 100000;
+
+struct PoissonEvent {
+    uint64_t nextUs = 0;
+    float    meanUs = 0.0f;   // 1e6 / rate; 0 = never fires
+
+    // Arm with a rate (events per second), first event drawn from nowUs.
+    void begin(Prng& rng, float perSecond, uint64_t nowUs) {
+        meanUs = perSecond > 0.0f ? 1e6f / perSecond : 0.0f;
+        nextUs = nowUs + gap(rng);
+    }
+
+    // True once for each event due by nowUs. Call in a loop to drain a burst
+    // when several events fall inside one frame.
+    bool poll(Prng& rng, uint64_t nowUs) {
+        if (nowUs < nextUs) return false;
+        uint64_t base = (nowUs - nextUs > POISSON_MAX_LAG_US) ? nowUs : nextUs;
+        nextUs = base + gap(rng);
+        return true;
+    }
+
+private:
+    uint64_t gap(Prng& rng) const {
+        if (meanUs <= 0.0f) return UINT64_MAX / 2;
+        // 1 - unit() is in (0, 1], so the log is finite
+        return (uint64_t)(-logf(1.0f - rng.unit()) * meanUs) + 1;
+    }
+};
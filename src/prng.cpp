@@ -0,0 +1,22 @@
+#include <Arduino.h>
+#include "prng.h"
+
+static Prng root;
+static bool rootSeeded = false;
+
+uint32_t prngSeed() {
+    if (!rootSeeded) {
+#if defined(ESP32)
+        root.seed(esp_random());
+#else
+        root.seed((uint32_t)micros());
+#endif
+        rootSeeded = true;
+    }
+    return root.next();
+}
+
+void prngSetRoot(uint32_t seed) {
+    root.seed(seed);
+    rootSeeded = true;
+}
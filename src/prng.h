@@ -0,0 +1,79 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// ─── Engine PRNG ─────────────────────────────────────────────────────────────
+//
+// A 32-bit xorshift generator small enough to live in every engine's state
+// struct. Each draw is three shifts and three XORs — no libc call, no
+// esp_random() hardware read — and bounded draws use a multiply-high instead
+// of a modulo.
+//
+// Engines seed their generator on entry from prngSeed(), which draws from a
+// root generator. The root starts from hardware entropy; prngSetRoot() makes
+// every engine entered afterwards replay identically (CLI `sim seed=`).
+// Not for anything security related.
+
+struct Prng {
+    uint32_t state = 0x9E3779B9u;
+
+    // Any seed (including 0) maps to a valid non-zero state.
+    void seed(uint32_t s) {
+        s += 0x9E3779B9u;                    // splitmix32 finaliser: nearby seeds diverge
+        s  = (s ^ (s >> 16)) * 0x85EBCA6Bu;
+        s  = (s ^ (s >> 13)) * 0xC2B2AE35u;
+        s ^= s >> 16;
+        state = s ? s : 0x9E3779B9u;
+    }
+
+    uint32_t next() {
+        uint32_t x = state;
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        return state = x;
+    }
+
+    // Uniform in [0, n).
+    uint32_t below(uint32_t n) {
+        return (uint32_t)(((uint64_t)next() * n) >> 32);
+    }
+
+    // Uniform in [lo, hi) — same contract as Arduino random(lo, hi).
+    int32_t range(int32_t lo, int32_t hi) {
+        return hi > lo ? lo + (int32_t)below((uint32_t)(hi - lo)) : lo;
+    }
+
+    // Uniform in [0, 1).
+    float unit() {
+        return (float)(next() >> 8) * (1.0f / 16777216.0f);
+    }
+
+    // Uniform in [-1, 1).
+    float signedUnit() {
+        return (float)(int32_t)next() * (1.0f / 2147483648.0f);
+    }
+
+    // n values in [0, bound), four per draw. For per-pixel jitter.
+    void fill(uint8_t* out, size_t n, uint8_t bound) {
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            uint32_t r = next();
+            out[i]     = (uint8_t)(((r         & 0xFF) * bound) >> 8);
+            out[i + 1] = (uint8_t)((((r >> 8)  & 0xFF) * bound) >> 8);
+            out[i + 2] = (uint8_t)((((r >> 16) & 0xFF) * bound) >> 8);
+            out[i + 3] = (uint8_t)(((r >> 24)          * bound) >> 8);
+        }
+        if (i < n) {
+            for (uint32_t r = next(); i < n; i++, r >>= 8) {
+                out[i] = (uint8_t)(((r & 0xFF) * bound) >> 8);
+            }
+        }
+    }
+};
+
+// A fresh seed for an engine entering now.
+uint32_t prngSeed();
+
+// Reseed the root generator. Engines entered afterwards are reproducible.
+void prngSetRoot(uint32_t seed);
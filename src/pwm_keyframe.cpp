@@ -0,0 +1,27 @@
+#include "pwm_keyframe.h"
+#include "config.h"
+
+static constexpr uint32_t KEYFRAME_US = PWM_KEYFRAME_MS * 1000;
+
+void PwmKeyframer::update(LedSink& sink, const uint16_t duty[4], uint32_t nowUs) {
+    int32_t late = (int32_t)(nowUs - nextUs_);
+    if (valid_ && late < 0) return;
+
+    // Hold the cadence through loop() jitter, but restart it after a stall
+    // rather than firing a burst of catch-up keyframes.
+    nextUs_ = (valid_ && late < (int32_t)KEYFRAME_US) ? nextUs_ + KEYFRAME_US
+                                                      : nowUs + KEYFRAME_US;
+    keyframes++;
+
+    for (uint8_t ch = 0; ch < 4; ch++) {
+        if (!valid_) {
+            sink.writeDuty(ch, duty[ch]);
+            jumps++;
+        } else if (duty[ch] != sent_[ch]) {
+            sink.fadeDuty(ch, sent_[ch], duty[ch], PWM_KEYFRAME_FADE_MS);
+            fades++;
+        }
+        sent_[ch] = duty[ch];
+    }
+    valid_ = true;
+}
@@ -0,0 +1,44 @@
+#pragma once
+#include <Arduino.h>
+#include "led_sink.h"
+
+// ─── PWM keyframe output ──────────────────────────────────────────────────────
+//
+// The engines render a new duty set every frame (~1 kHz), but the mono LEDs
+// only need a few points per second to look the same once the LEDC
+// peripheral interpolates between them. PwmKeyframer samples the rendered
+// duties every PWM_KEYFRAME_MS and, for each channel that moved, starts a
+// hardware fade from the previous keyframe to the new one. Between keyframes
+// the CPU does not touch the PWM at all.
+//
+// Output trails the engine by one keyframe interval; the candle smoothing
+// time constants are of the same order, so the lag is not visible.
+//
+// Only the PWM output runs at the control rate; the engines still render
+// every frame. That is deliberate: the strip, Auto's crossfade and the
+// engines' own smoothing share the same Frame at the render task's rate, so
+// what keyframing saves is the LEDC writes, not the engine maths. In Candle
+// mode that is two to four times fewer writes (test/test_pwm_keyframe).
+//
+// Portable: drive it with a RecordingLedSink and a virtual clock to check
+// keyframe timing and interpolation on a host build.
+
+class PwmKeyframer {
+public:
+    // Poll with the newest rendered duties; emits at most one keyframe per
+    // interval. nowUs is any free-running µs counter (wraps are fine).
+    void update(LedSink& sink, const uint16_t duty[4], uint32_t nowUs);
+
+    // Someone else wrote the PWM (CLI test mode): the next keyframe jumps
+    // straight to its duties instead of fading from stale values.
+    void invalidate() { valid_ = false; }
+
+    uint32_t keyframes = 0;   // update() calls that emitted a keyframe
+    uint32_t fades     = 0;   // channel fades started
+    uint32_t jumps     = 0;   // direct writes after invalidate()
+
+private:
+    uint16_t sent_[4] = {0, 0, 0, 0};   // duty each channel is fading towards
+    uint32_t nextUs_  = 0;
+    bool     valid_   = false;
+};
@@ -0,0 +1,145 @@
+#include "render.h"
+#include "spsc_queue.h"
+#include "frame_buffer.h"
+#include "timebase.h"
+#include "perf.h"
+
+// ─── Extern references to main.cpp globals ───────────────────────────────────
+
+extern Frame renderFrame;
+extern CandleMode currentMode;
+extern CandleMode lastActiveMode;
+extern bool powerOn;
+extern const ModeConfig MODES[];
+
+void turnOffAllLEDs();
+
+// ─── Handoff state ────────────────────────────────────────────────────────────
+
+static SpscQueue<RenderCmd, RENDER_CMD_QUEUE>   cmdQueue;    // loop() → render
+static SpscQueue<RenderEvent, RENDER_CMD_QUEUE> eventQueue;  // render → loop()
+static FrameBuffer<Frame>                  frames;
+
+static std::atomic<bool> pausedAck{false};
+static bool              paused = false;   // render task only
+static uint32_t          lastFrameSeq = 0; // loop() only
+
+static void notify(RenderEventType type, CandleMode from, CandleMode to) {
+    // Dropped if loop() has fallen behind — it is only used for logging.
+    eventQueue.push({type, from, to});
+}
+
+// Mode switches happen here, between frames, so an engine never sees its
+// state change in the middle of an update.
+static void applyCommand(const RenderCmd& cmd) {
+    switch (cmd.type) {
+        case RenderCmdType::SET_MODE: {
+            if (MODES[currentMode].exitFunction) MODES[currentMode].exitFunction(renderFrame);
+            CandleMode prev = currentMode;
+            currentMode = (CandleMode)cmd.arg;
+            if (MODES[currentMode].enterFunction) MODES[currentMode].enterFunction(renderFrame);
+            powerOn = true;
+            notify(RenderEventType::MODE_CHANGED, prev, currentMode);
+            break;
+        }
+        case RenderCmdType::BUTTON_SHORT:
+            if (powerOn) {
+                CandleMode prev = currentMode;
+                if (MODES[currentMode].exitFunction) MODES[currentMode].exitFunction(renderFrame);
+                currentMode    = (CandleMode)((currentMode + 1) % NUM_MODES);
+                lastActiveMode = currentMode;
+                if (MODES[currentMode].enterFunction) MODES[currentMode].enterFunction(renderFrame);
+                notify(RenderEventType::MODE_CHANGED, prev, currentMode);
+            } else {
+                powerOn     = true;
+                currentMode = lastActiveMode;
+                if (MODES[currentMode].enterFunction) MODES[currentMode].enterFunction(renderFrame);
+                notify(RenderEventType::POWER_ON, currentMode, currentMode);
+            }
+            break;
+        case RenderCmdType::POWER_OFF:
+            powerOn = false;
+            turnOffAllLEDs();
+            notify(RenderEventType::POWER_OFF, currentMode, currentMode);
+            break;
+        case RenderCmdType::PAUSE:
+            paused = true;
+            break;
+        case RenderCmdType::RESUME:
+            // The CLI zeroed the outputs; re-entering restores mode PWM levels.
+            // The timebase was left alone while paused (a CLI `sim` may have
+            // borrowed it), so resample before the enter function reads it.
+            paused = false;
+            timebaseTick();
+            if (powerOn && MODES[currentMode].enterFunction) MODES[currentMode].enterFunction(renderFrame);
+            break;
+    }
+    pausedAck.store(paused, std::memory_order_release);
+}
+
+static void renderTask(void*) {
+    timebaseTick();
+    if (MODES[currentMode].enterFunction) MODES[currentMode].enterFunction(renderFrame);
+
+    uint32_t lastFrameCyc  = 0;
+    bool     haveLastFrame = false;   // cleared by a pause: a pause is not frame jitter
+    for (;;) {
+        // One clock sample per frame; commands and engines all see the same time.
+        // While paused the timebase belongs to the CLI.
+        if (!paused) timebaseTick();
+
+        RenderCmd cmd;
+        while (cmdQueue.pop(cmd)) applyCommand(cmd);
+
+        if (!paused) {
+            uint32_t start = perfNow();
+            if (PERF_COUNTERS && haveLastFrame) perfRecord(PERF_FRAME, start - lastFrameCyc);
+            lastFrameCyc  = start;
+            haveLastFrame = true;
+            if (powerOn && MODES[currentMode].updateFunction) {
+                MODES[currentMode].updateFunction(renderFrame);
+                if (PERF_COUNTERS) perfRecord((PerfStage)(PERF_MODE + currentMode), perfNow() - start);
+            }
+            frames.publish(renderFrame);
+        } else {
+            haveLastFrame = false;
+        }
+
+        // One tick: lets IDLE0 feed the task watchdog and caps the frame rate
+        // at the FreeRTOS tick (1 kHz). Engines take dt from the timebase, so
+        // the exact rate does not matter.
+        vTaskDelay(1);
+    }
+}
+
+// ─── Public API ───────────────────────────────────────────────────────────────
+
+void renderBegin() {
+    xTaskCreatePinnedToCore(renderTask, "render", RENDER_TASK_STACK, nullptr,
+                            RENDER_TASK_PRIORITY, nullptr, RENDER_CORE);
+}
+
+bool renderPost(RenderCmdType type, int8_t arg) {
+    return cmdQueue.push({type, arg});
+}
+
+bool renderSetPaused(bool p) {
+    if (!renderPost(p ? RenderCmdType::PAUSE : RenderCmdType::RESUME)) return false;
+    for (int i = 0; i < 100 && pausedAck.load(std::memory_order_acquire) != p; i++) {
+        vTaskDelay(1);
+    }
+    if (pausedAck.load(std::memory_order_acquire) == p) return true;
+
+    // Never acknowledged: queue a RESUME behind the PAUSE so a task that
+    // catches up later does not stop rendering under a caller that gave up.
+    if (p) renderPost(RenderCmdType::RESUME);
+    return false;
+}
+
+bool renderPollEvent(RenderEvent& ev) {
+    return eventQueue.pop(ev);
+}
+
+bool renderLatestFrame(Frame& out) {
+    return frames.read(out, lastFrameSeq);
+}
@@ -0,0 +1,59 @@
+#pragma once
+#include <Arduino.h>
+#include <FastLED.h>
+#include "config.h"
+#include "types.h"
+#include "frame.h"
+
+// ─── Render task ─────────────────────────────────────────────────────────────
+//
+// The mode engines run in a FreeRTOS task pinned to RENDER_CORE. Everything
+// else (CLI, button, serial logging, strip output) stays in loop() on the
+// other core. The two sides only talk through lock-free structures:
+//
+//   loop()  ──RenderCmd──▶  render task     SPSC queue, applied at frame start
+//   loop()  ◀─RenderEvent─  render task     SPSC queue, for [MODE]/[PWR] logs
+//   loop()  ◀────Frame───── render task     double buffer, newest frame wins
+//
+// The render task is the only writer of currentMode / powerOn / lastActiveMode
+// once started; other code may read them for display. Engines draw into the
+// task's own Frame (see frame.h), which is published whole after each update.
+
+enum class RenderCmdType : uint8_t {
+    SET_MODE,       // arg = CandleMode; also powers on
+    BUTTON_SHORT,   // next mode, or power on if off
+    POWER_OFF,
+    PAUSE,          // stop rendering (CLI test mode owns the outputs)
+    RESUME,         // re-enter the current mode and carry on
+};
+
+struct RenderCmd {
+    RenderCmdType type;
+    int8_t        arg;
+};
+
+enum class RenderEventType : uint8_t { MODE_CHANGED, POWER_ON, POWER_OFF };
+
+struct RenderEvent {
+    RenderEventType type;
+    CandleMode      from;
+    CandleMode      to;
+};
+
+// Start the render task. Enters the current mode on the render core.
+void renderBegin();
+
+// Queue a command for the next frame boundary. Returns false if the queue is full.
+bool renderPost(RenderCmdType type, int8_t arg = 0);
+
+// Pause/resume rendering and wait (up to ~100 ms) until the task acknowledges,
+// so the caller can safely drive the outputs directly afterwards. Returns
+// false if it never did; a pause that times out is withdrawn, and the caller
+// must not touch the outputs or the timebase.
+bool renderSetPaused(bool paused);
+
+// Pop one pending notification from the render task (loop() side).
+bool renderPollEvent(RenderEvent& ev);
+
+// Copy the newest published frame into out. Returns false if none is new.
+bool renderLatestFrame(Frame& out);
@@ -0,0 +1,202 @@
+#include <FastLED.h>
+#include "sim.h"
+#include "config.h"
+#include "timebase.h"
+#include "prng.h"
+
+// ─── Extern references to main.cpp globals ───────────────────────────────────
+
+extern const ModeConfig MODES[];
+
+// ─── Virtual clock ────────────────────────────────────────────────────────────
+
+static uint64_t simClockUs = 0;
+static uint64_t simClock() { return simClockUs; }
+
+// The simulated engine draws here, never into the render task's frame.
+static Frame simFrame;
+
+static const char* const CHANNEL_NAMES[4] = {"W1", "W2", "UV", "RED"};
+
+// ─── Arguments ────────────────────────────────────────────────────────────────
+
+// Parse "<n>[s|m|h|d]" (default seconds) at p. Advances p past it.
+static bool parseDuration(const char*& p, uint64_t& outMs) {
+    char* end = nullptr;
+    unsigned long n = strtoul(p, &end, 10);
+    if (end == p) return false;
+    uint64_t unitMs = 1000;
+    if      (*end == 'm') { unitMs = 60000;    end++; }
+    else if (*end == 'h') { unitMs = 3600000;  end++; }
+    else if (*end == 'd') { unitMs = 86400000; end++; }
+    else if (*end == 's') { end++; }
+    outMs = (uint64_t)n * unitMs;
+    p = end;
+    return true;
+}
+
+bool simParseArgs(const char* args, SimOptions& opt) {
+    char* end = nullptr;
+    long mode = strtol(args, &end, 10);
+    if (end == args || mode < 0 || mode >= NUM_MODES) return false;
+    opt.mode = (CandleMode)mode;
+
+    const char* p = end;
+    while (*p == ' ') p++;
+    if (!parseDuration(p, opt.durationMs) || opt.durationMs == 0) return false;
+
+    while (*p) {
+        while (*p == ' ') p++;
+        if (!*p) break;
+        if      (strncmp(p, "fps=", 4)  == 0) opt.fps        = strtoul(p + 4, &end, 10);
+        else if (strncmp(p, "csv=", 4)  == 0) opt.csvEveryMs = strtoul(p + 4, &end, 10);
+        else if (strncmp(p, "seed=", 5) == 0) opt.seed       = strtoul(p + 5, &end, 10);
+        else if (strncmp(p, "start=", 6) == 0) {
+            p += 6;
+            if (!parseDuration(p, opt.startMs)) return false;
+            continue;
+        }
+        else return false;
+        p = end;
+    }
+    return opt.fps >= SIM_FPS_MIN && opt.fps <= SIM_FPS_MAX;
+}
+
+// ─── Run ──────────────────────────────────────────────────────────────────────
+
+SimResult simExecute(const SimOptions& opt, SimFrameFn onFrame, void* ctx) {
+    const ModeConfig& mode   = MODES[opt.mode];
+    const uint64_t    frames = opt.durationMs * opt.fps / 1000;
+    SimResult         r;
+
+    if (opt.seed) prngSetRoot(opt.seed);
+
+    const uint64_t startUs = opt.startMs * 1000;
+    simClockUs = startUs;
+    timebaseSetClock(simClock);
+    timebaseTick();
+    if (mode.enterFunction) mode.enterFunction(simFrame);
+
+    CRGB     lastLeds[NUM_LEDS];
+    uint32_t stripRun = 0;
+    memcpy(lastLeds, simFrame.leds, sizeof(lastLeds));
+
+    uint32_t wallStart = millis();
+    uint32_t lastYield = wallStart;
+    uint64_t done      = 0;
+    while (done < frames) {
+        // Exact frame period on average: derive time from the frame index
+        simClockUs = startUs + (done + 1) * 1000000ULL / opt.fps;
+        timebaseTick();
+        if (mode.updateFunction) mode.updateFunction(simFrame);
+
+        for (int ch = 0; ch < 4; ch++) r.duty[ch].add(simFrame.duty[ch], done == 0);
+        if (memcmp(lastLeds, simFrame.leds, sizeof(lastLeds)) != 0) {
+            r.stripChanges++;
+            memcpy(lastLeds, simFrame.leds, sizeof(lastLeds));
+            stripRun = 0;
+        }
+        if (++stripRun > r.stripMaxRun) r.stripMaxRun = stripRun;
+        done++;
+
+        if (onFrame && !onFrame(simClockUs, simFrame, ctx)) {
+            r.aborted = true;
+            break;
+        }
+
+        // Let the idle task and serial driver breathe on the device
+        if ((done & 0x3FF) == 0 && millis() - lastYield >= 100) {
+            lastYield = millis();
+            delay(1);
+        }
+    }
+    r.wallMs = millis() - wallStart;
+
+    if (mode.exitFunction) mode.exitFunction(simFrame);
+    timebaseSetClock(nullptr);
+
+    r.frames = done;
+    r.simMs  = (simClockUs - startUs) / 1000;
+    return r;
+}
+
+// ─── Reporting ────────────────────────────────────────────────────────────────
+
+size_t simFormatCsvRow(char* out, size_t size, uint64_t tMs, const Frame& frame) {
+    int n = snprintf(out, size, "%llu,%u,%u,%u,%u,", (unsigned long long)tMs,
+                     frame.duty[WHITE_LED_1], frame.duty[WHITE_LED_2],
+                     frame.duty[UV_LED], frame.duty[RED_LED]);
+    size_t len = n < 0 ? 0 : ((size_t)n < size ? (size_t)n : size - 1);
+    for (int i = 0; i < NUM_LEDS && len + 7 <= size; i++) {
+        snprintf(out + len, size - len, "%02x%02x%02x",
+                 frame.leds[i].r, frame.leds[i].g, frame.leds[i].b);
+        len += 6;
+    }
+    return len;
+}
+
+void simPrintHeader(const SimOptions& opt) {
+    Serial.printf("[SIM] %s  %llus simulated  %lu fps  %llu frames%s\n", MODES[opt.mode].name,
+                  (unsigned long long)(opt.durationMs / 1000), (unsigned long)opt.fps,
+                  (unsigned long long)(opt.durationMs * opt.fps / 1000),
+                  opt.csvEveryMs ? "  (csv)" : "");
+    if (opt.startMs) {
+        Serial.printf("[SIM] starting at uptime %llu ms (nowMs wraps at 4294967296)\n",
+                      (unsigned long long)opt.startMs);
+    }
+}
+
+void simPrintSummary(const SimOptions& opt, const SimResult& r) {
+    Serial.printf("[SIM] %s%llu frames  %llu ms simulated in %lu ms  (x%.0f real time)\n",
+                  r.aborted ? "aborted after " : "", (unsigned long long)r.frames,
+                  (unsigned long long)r.simMs, (unsigned long)r.wallMs,
+                  (double)r.simMs / (double)(r.wallMs ? r.wallMs : 1));
+    if (r.frames == 0) return;
+    for (int ch = 0; ch < 4; ch++) {
+        const SimChannelStats& s = r.duty[ch];
+        Serial.printf("[SIM]   %-3s min=%4u max=%4u mean=%7.1f  moves=%5.1f%%  maxstep=%u  hold=%llums\n",
+                      CHANNEL_NAMES[ch], s.min, s.max, (double)s.sum / (double)r.frames,
+                      100.0 * s.moves / (double)r.frames, s.maxStep,
+                      (unsigned long long)simFramesToMs(s.maxRun, opt.fps));
+    }
+    Serial.printf("[SIM]   strip changed on %lu frames (%.1f%%)  hold=%llums\n",
+                  (unsigned long)r.stripChanges, 100.0 * r.stripChanges / (double)r.frames,
+                  (unsigned long long)simFramesToMs(r.stripMaxRun, opt.fps));
+}
+
+// ─── Device driver ────────────────────────────────────────────────────────────
+
+struct SerialTrace {
+    uint32_t everyMs;
+    uint64_t nextMs = 0;
+    uint32_t frames = 0;
+};
+
+static bool serialTraceFrame(uint64_t tUs, const Frame& frame, void* ctx) {
+    SerialTrace& t = *static_cast<SerialTrace*>(ctx);
+    uint64_t tMs = tUs / 1000;
+    if (t.everyMs && tMs >= t.nextMs) {
+        char row[32 + NUM_LEDS * 6];
+        simFormatCsvRow(row, sizeof(row), tMs, frame);
+        Serial.println(row);
+        t.nextMs = tMs + t.everyMs;
+    }
+    // Any key aborts; polling every 1024 frames keeps Serial off the hot path
+    if ((++t.frames & 0x3FF) == 0 && Serial.available()) {
+        while (Serial.available()) Serial.read();
+        return false;
+    }
+    return true;
+}
+
+void simRun(const SimOptions& opt) {
+    simPrintHeader(opt);
+    if (opt.csvEveryMs) {
+        Serial.println("[SIM] csv begin");
+        Serial.println(SIM_CSV_HEADER);
+    }
+    SerialTrace trace{opt.csvEveryMs};
+    SimResult   r = simExecute(opt, serialTraceFrame, &trace);
+    if (opt.csvEveryMs) Serial.println("[SIM] csv end");
+    simPrintSummary(opt, r);
+}
@@ -0,0 +1,100 @@
+#pragma once
+#include <Arduino.h>
+#include "types.h"
+#include "frame.h"
+#include "timebase.h"
+
+// ─── Virtual-clock simulation ────────────────────────────────────────────────
+//
+// Runs one mode's engine from a virtual clock as fast as the CPU allows, so a
+// config.h change can be judged over hours of animation in seconds. The real
+// engines run unmodified: the timebase is pointed at a counter that advances
+// one frame period per step, and the Frame the engine draws into is
+// summarised (and optionally traced as CSV) instead of sent to the LEDs.
+//
+// The main driver is the host one (bench/host_sim.cpp, env:native_sim), which
+// writes the trace to a file. The CLI `sim` command is a device-side extra for
+// checking a build on the board itself: it runs from test mode, where the
+// render task is paused and has handed the timebase over, and streams the
+// trace over Serial. The render task re-enters its mode on resume, so the
+// simulation leaves no state behind.
+//
+// `startMs` places the virtual clock anywhere in the uptime range, so a soak
+// across the 49.7-day nowMs rollover (start=1193h) takes seconds, not weeks.
+
+// The timebase clamps each engine step to TIMEBASE_MAX_DT_US, so below this
+// rate the engines would integrate less time than the clock reports.
+inline constexpr uint32_t SIM_FPS_MIN = (1000000 + TIMEBASE_MAX_DT_US - 1) / TIMEBASE_MAX_DT_US;
+inline constexpr uint32_t SIM_FPS_MAX = 10000;
+
+struct SimOptions {
+    CandleMode mode       = CANDLE_MODE;
+    uint64_t   durationMs = 0;
+    uint32_t   fps        = 60;
+    uint32_t   csvEveryMs = 0;   // 0 = summary only
+    uint32_t   seed       = 0;   // engine PRNG root seed (0 = keep hardware entropy)
+    uint64_t   startMs    = 0;   // virtual uptime at the first frame
+};
+
+// One output channel over a run.
+struct SimChannelStats {
+    uint16_t min     = 0xFFFF;
+    uint16_t max     = 0;
+    uint16_t last    = 0;
+    uint16_t maxStep = 0;
+    uint32_t moves   = 0;   // frames where the duty changed
+    uint32_t run     = 0;   // frames the current value has been held
+    uint32_t maxRun  = 0;   // longest hold — a stall shows up here
+    uint64_t sum     = 0;
+
+    void add(uint16_t v, bool first) {
+        if (v < min) min = v;
+        if (v > max) max = v;
+        if (!first && v != last) {
+            moves++;
+            uint16_t step = v > last ? v - last : last - v;
+            if (step > maxStep) maxStep = step;
+            run = 0;
+        }
+        if (++run > maxRun) maxRun = run;
+        sum += v;
+        last = v;
+    }
+};
+
+struct SimResult {
+    uint64_t        frames       = 0;   // frames rendered
+    uint64_t        simMs        = 0;   // virtual time covered
+    uint32_t        wallMs       = 0;
+    bool            aborted      = false;
+    SimChannelStats duty[4];            // indexed like Frame::duty
+    uint32_t        stripChanges = 0;   // frames where any pixel changed
+    uint32_t        stripMaxRun  = 0;   // longest unchanged stretch, frames
+};
+
+// Called after every frame with its virtual time and the frame just drawn.
+// Return false to stop the run early.
+typedef bool (*SimFrameFn)(uint64_t tUs, const Frame& frame, void* ctx);
+
+// Parse "<mode> <duration> [fps=N] [csv=ms] [seed=N] [start=<duration>]",
+// durations as "<n>[s|m|h|d]" (default seconds).
+bool simParseArgs(const char* args, SimOptions& opt);
+
+// Run a simulation without printing anything.
+SimResult simExecute(const SimOptions& opt, SimFrameFn onFrame = nullptr, void* ctx = nullptr);
+
+// Hold time in ms for a run length in frames.
+inline uint64_t simFramesToMs(uint32_t frames, uint32_t fps) { return (uint64_t)frames * 1000 / fps; }
+
+// One trace row, "t_ms,w1,w2,uv,red,strip" with the strip as rrggbb per
+// pixel. Returns the length written (always NUL-terminated).
+inline constexpr const char* SIM_CSV_HEADER = "t_ms,w1,w2,uv,red,strip";
+size_t simFormatCsvRow(char* out, size_t size, uint64_t tMs, const Frame& frame);
+
+// Print a run's header or summary as [SIM] lines on Serial.
+void simPrintHeader(const SimOptions& opt);
+void simPrintSummary(const SimOptions& opt, const SimResult& r);
+
+// Device: run from CLI test mode, stream the CSV trace over Serial if asked
+// and print the summary. Any byte on Serial aborts early.
+void simRun(const SimOptions& opt);
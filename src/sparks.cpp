@@ -0,0 +1,83 @@
+#include "sparks.h"
+#include "fixed_point.h"
+
+bool sparkSpawn(const SparkPoolView& p, int32_t posQ16, int32_t velQ16, uint8_t hue,
+                uint16_t level, uint32_t lifeMs) {
+    SparkPoolState& s = *p.state;
+    if (s.live >= p.capacity) {
+        s.dropped++;
+        return false;
+    }
+    uint32_t decay = level / (lifeMs ? lifeMs : 1);
+    int i = s.live++;
+    p.pos[i]   = posQ16;
+    p.vel[i]   = velQ16;
+    p.level[i] = level;
+    p.decay[i] = (uint16_t)(decay ? decay : 1);
+    p.hue[i]   = hue;
+    s.spawned++;
+    return true;
+}
+
+void sparkStep(const SparkPoolView& p, uint32_t dtQ16, int n) {
+    int32_t*  pos   = p.pos;
+    int32_t*  vel   = p.vel;
+    uint16_t* level = p.level;
+    uint16_t* decay = p.decay;
+    uint8_t*  hue   = p.hue;
+    int       live  = p.state->live;
+    const int32_t end = (int32_t)n << 16;
+
+    for (int i = 0; i < live;) {
+        uint32_t loss = (uint32_t)(((uint64_t)decay[i] * dtQ16) >> 16);
+        int32_t  x    = pos[i] + (int32_t)(((int64_t)vel[i] * dtQ16) >> 16);
+        if (loss >= level[i] || x <= -Q16_ONE || x >= end) {
+            // Swap-remove: the last live particle moves into slot i and is
+            // stepped on the next pass through the loop
+            live--;
+            pos[i]   = pos[live];
+            vel[i]   = vel[live];
+            level[i] = level[live];
+            decay[i] = decay[live];
+            hue[i]   = hue[live];
+            continue;
+        }
+        level[i] = (uint16_t)(level[i] - loss);
+        pos[i]   = x;
+        i++;
+    }
+    p.state->live = live;
+}
+
+void sparkRender(const SparkPoolView& p, const CRGB palette[256], CRGB* out, int n) {
+    const int live = p.state->live;
+    for (int i = 0; i < live; i++) {
+        int32_t x    = p.pos[i];
+        int     px   = x >> 16;                  // floor, also left of pixel 0
+        uint8_t frac = (uint8_t)(x >> 8);
+        uint8_t v    = (uint8_t)(p.level[i] >> 8);
+        const CRGB& c = palette[p.hue[i]];
+        if (px >= 0) {
+            CRGB a = c;
+            a.nscale8(scale8(v, 255 - frac));
+            out[px] += a;
+        }
+        if (px + 1 < n) {
+            CRGB b = c;
+            b.nscale8(scale8(v, frac));
+            out[px + 1] += b;
+        }
+    }
+}
+
+void sparkFadeBackground(CRGB* base, int n, const CRGB& rest, uint8_t fadePerMs, float dtMs) {
+    // One powf per frame; the pixels get a Q16 factor. Dividing (not
+    // shifting) rounds towards rest, so the background lands on it exactly.
+    int32_t keep = (int32_t)(powf((fadePerMs + 1) / 256.0f, dtMs) * 65536.0f + 0.5f);
+    for (int i = 0; i < n; i++) {
+        for (int c = 0; c < 3; c++) {
+            int32_t d  = (int32_t)base[i][c] - rest[c];
+            base[i][c] = (uint8_t)(rest[c] + d * keep / 65536);
+        }
+    }
+}
@@ -0,0 +1,70 @@
+#pragma once
+#include <Arduino.h>
+#include <FastLED.h>
+
+// ─── Spark particles ─────────────────────────────────────────────────────────
+//
+// A fixed-capacity pool of particles in struct-of-arrays layout — the sparks
+// of Magic mode's SPARK phase, thousands in `bench spark`. Each particle has
+// a sub-pixel position and velocity along the strip, a hue, a brightness
+// level and a linear decay. Storage is the pool itself (static or owned by
+// the caller); nothing here allocates, so a frame costs no heap whatever
+// the spawn rate. A spawn into a full pool is dropped and counted.
+//
+// Live particles are packed at the front of the arrays. sparkStep() moves
+// and fades them in one pass and removes the dead by swapping the last live
+// particle into the hole, so the pass never compacts or scans dead slots.
+//
+// sparkRender() splats each particle over the two pixels it straddles,
+// weighted by its fractional position, and adds it to what is already there:
+// a spark glides between pixels instead of hopping.
+
+// Counters shared by every view of one pool.
+struct SparkPoolState {
+    int      live    = 0;   // particles [0, live) are alive
+    uint32_t spawned = 0;
+    uint32_t dropped = 0;   // spawns refused because the pool was full
+};
+
+// Non-owning view of a pool; what the kernels operate on.
+struct SparkPoolView {
+    int             capacity;
+    int32_t*        pos;     // Q16 pixels from the strip start
+    int32_t*        vel;     // Q16 pixels per ms
+    uint16_t*       level;   // brightness, 65535 = full
+    uint16_t*       decay;   // level lost per ms
+    uint8_t*        hue;
+    SparkPoolState* state;
+};
+
+template <int N>
+struct SparkPool {
+    int32_t        pos[N];
+    int32_t        vel[N];
+    uint16_t       level[N];
+    uint16_t       decay[N];
+    uint8_t        hue[N];
+    SparkPoolState state;
+
+    SparkPoolView view() { return {N, pos, vel, level, decay, hue, &state}; }
+};
+
+// Start a particle at posQ16 moving at velQ16 (pixels/ms), fading from level
+// to zero over lifeMs. False when the pool is full.
+bool sparkSpawn(const SparkPoolView& p, int32_t posQ16, int32_t velQ16, uint8_t hue,
+                uint16_t level, uint32_t lifeMs);
+
+// Advance every particle by dtQ16 ms. Particles that fade out or leave the
+// n-pixel strip are removed.
+void sparkStep(const SparkPoolView& p, uint32_t dtQ16, int n);
+
+// Add every particle to out[n], colour from palette[hue] scaled by level.
+void sparkRender(const SparkPoolView& p, const CRGB palette[256], CRGB* out, int n);
+
+// The SPARK phase background: pull base[n] towards `rest`, keeping
+// ((fadePerMs + 1) / 256)^dtMs of the distance — nscale8(fadePerMs) once per
+// ms, at any frame rate.
+void sparkFadeBackground(CRGB* base, int n, const CRGB& rest, uint8_t fadePerMs, float dtMs);
+
+// Remove every particle.
+inline void sparkClear(const SparkPoolView& p) { p.state->live = 0; }
@@ -0,0 +1,47 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+
+// ─── Single-producer / single-consumer ring ──────────────────────────────────
+//
+// Lock-free FIFO for handing small POD messages between exactly one producer
+// and one consumer thread (here: the I/O core and the render task). No
+// FreeRTOS or Arduino dependencies, so it builds and runs on a Linux host
+// with std::thread as well.
+//
+// N must be a power of two. Indices run freely and wrap through the mask, so
+// the ring holds all N slots (no "one empty slot" sentinel needed).
+
+template <typename T, size_t N>
+class SpscQueue {
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "SpscQueue size must be a power of two");
+
+public:
+    // Producer side. Returns false (and drops v) when the ring is full.
+    bool push(const T& v) {
+        uint32_t head = head_.load(std::memory_order_relaxed);
+        if (head - tail_.load(std::memory_order_acquire) >= N) return false;
+        buf_[head & (N - 1)] = v;
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side. Returns false when the ring is empty.
+    bool pop(T& out) {
+        uint32_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail == head_.load(std::memory_order_acquire)) return false;
+        out = buf_[tail & (N - 1)];
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool empty() const {
+        return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire);
+    }
+
+private:
+    T buf_[N];
+    std::atomic<uint32_t> head_{0};   // written by producer only
+    std::atomic<uint32_t> tail_{0};   // written by consumer only
+};
@@ -0,0 +1,203 @@
+#include "stream.h"
+#include "led_sink.h"
+
+// ─── Encoder ──────────────────────────────────────────────────────────────────
+
+size_t streamEncode(uint8_t type, uint16_t seq, const void* body, size_t len, uint8_t* out) {
+    size_t  codeAt = 0;   // where the current block's code byte goes
+    size_t  o      = 1;
+    uint8_t code   = 1;
+    uint16_t crc   = 0xFFFF;
+
+    auto put = [&](uint8_t b) {
+        if (b == 0) {
+            out[codeAt] = code;
+            codeAt = o++;
+            code = 1;
+            return;
+        }
+        out[o++] = b;
+        if (++code == 0xFF) {
+            out[codeAt] = code;
+            codeAt = o++;
+            code = 1;
+        }
+    };
+    auto putCrc = [&](uint8_t b) { crc = streamCrcByte(crc, b); put(b); };
+
+    putCrc(type);
+    putCrc((uint8_t)seq);
+    putCrc((uint8_t)(seq >> 8));
+    const uint8_t* p = (const uint8_t*)body;
+    for (size_t i = 0; i < len; i++) putCrc(p[i]);
+    put((uint8_t)(crc >> 8));
+    put((uint8_t)crc);
+
+    out[codeAt] = code;
+    out[o++] = 0;
+    return o;
+}
+
+// ─── Decoder ──────────────────────────────────────────────────────────────────
+
+void StreamDecoder::reset() {
+    n_           = 0;
+    crc_         = 0xFFFF;
+    block_       = 0;
+    zeroPending_ = false;
+    overrun_     = false;
+}
+
+// One decoded packet byte: header, then the body straight to its destination.
+void StreamDecoder::emit(uint8_t b) {
+    if (overrun_) return;
+    crc_ = streamCrcByte(crc_, b);
+    if (n_ < STREAM_HEADER_BYTES) {
+        head_[n_++] = b;
+        return;
+    }
+    uint16_t k = n_ - STREAM_HEADER_BYTES;
+    if (head_[0] == STREAM_FRAME) {
+        if (k < sizeof(Frame)) ((uint8_t*)&frames_[front_ ^ 1])[k] = b;
+        else if (k >= sizeof(Frame) + STREAM_CRC_BYTES) { overrun_ = true; return; }
+    } else {
+        if (k < sizeof(ctrl_)) ctrl_[k] = b;
+        else { overrun_ = true; return; }
+    }
+    n_++;
+}
+
+uint8_t StreamDecoder::push(uint8_t b) {
+    if (b == 0) return finish();
+    if (block_ == 0) {
+        // Code byte: the previous block's implied zero, then `b − 1` data bytes
+        if (zeroPending_) emit(0);
+        block_       = b - 1;
+        zeroPending_ = b != 0xFF;
+    } else {
+        emit(b);
+        block_--;
+    }
+    return STREAM_NONE;
+}
+
+uint8_t StreamDecoder::finish() {
+    uint8_t type = STREAM_NONE;
+    if (block_ != 0 || overrun_) {
+        stats.badPackets++;                                  // cut short, or longer than any packet
+    } else if (n_ == 0) {
+        // Bare delimiter: a sender resynchronising, not an error
+    } else if (n_ < STREAM_HEADER_BYTES + STREAM_CRC_BYTES) {
+        stats.badPackets++;
+    } else if (crc_ != 0) {
+        stats.crcErrors++;
+    } else {
+        uint16_t len  = n_ - STREAM_HEADER_BYTES - STREAM_CRC_BYTES;
+        bool     known = head_[0] == STREAM_FRAME ? len == sizeof(Frame)
+                       : head_[0] == STREAM_BRIGHTNESS || head_[0] == STREAM_PING || head_[0] == STREAM_STOP;
+        if (!known) {
+            stats.badPackets++;
+        } else {
+            seq_ = (uint16_t)(head_[1] | head_[2] << 8);
+            if (haveSeq_) {
+                // A backwards or repeated seq (sender restarted) is not a loss
+                uint16_t gap = (uint16_t)(seq_ - lastSeq_ - 1);
+                if (gap < 0x8000) stats.dropped += gap;
+            }
+            lastSeq_ = seq_;
+            haveSeq_ = true;
+            stats.packets++;
+            type = head_[0];
+            if (type == STREAM_FRAME) {
+                front_ ^= 1;
+                stats.frames++;
+            } else {
+                ctrlLen_ = (uint8_t)len;
+            }
+        }
+    }
+    reset();
+    return type;
+}
+
+// ─── Device link ──────────────────────────────────────────────────────────────
+
+static StreamDecoder streamLink;
+static bool          streamActive     = false;
+static uint32_t      streamLastPacket = 0;   // millis() of the last verified packet
+static uint8_t       streamBrightness = WS2812_BRIGHTNESS;
+
+static void streamReplyStats(uint16_t seq) {
+    // Leading delimiter: ends any log text the host has been reading
+    uint8_t out[1 + streamWireBytes(sizeof(StreamStats))];
+    out[0] = 0;
+    size_t n = streamEncode(STREAM_STATS, seq, &streamLink.stats, sizeof(StreamStats), out + 1);
+    Serial.write(out, n + 1);
+}
+
+static void streamLinkEnd(const char* why) {
+    streamActive = false;
+    const StreamStats& s = streamLink.stats;
+    Serial.printf("[STREAM] ended (%s)  frames=%lu  shown=%lu  superseded=%lu  dropped=%lu  "
+                  "crc=%lu  bad=%lu\n", why,
+        (unsigned long)s.frames, (unsigned long)s.shown, (unsigned long)s.superseded,
+        (unsigned long)s.dropped, (unsigned long)s.crcErrors, (unsigned long)s.badPackets);
+}
+
+void streamLinkBegin() {
+    streamLink       = StreamDecoder{};   // fresh counters and seq tracking
+    streamActive     = true;
+    streamLastPacket = millis();
+    streamBrightness = WS2812_BRIGHTNESS;
+    Serial.printf("[STREAM] binary frame mode  (STOP packet or %lu ms idle returns to the CLI)\n",
+        (unsigned long)STREAM_IDLE_MS);
+}
+
+bool streamLinkUpdate() {
+    if (!streamActive) return false;
+
+    static uint8_t buf[STREAM_READ_BUF];
+    bool gotFrame = false;
+    // Only what is already here, so a flood cannot keep loop() from its other work
+    int  avail    = Serial.available();
+    while (streamActive && avail > 0) {
+        size_t n = Serial.read(buf, avail < (int)sizeof(buf) ? (size_t)avail : sizeof(buf));
+        if (n == 0) break;
+        avail -= (int)n;
+        for (size_t i = 0; i < n && streamActive; i++) {
+            uint8_t type = streamLink.push(buf[i]);
+            if (type == STREAM_NONE) continue;
+            streamLastPacket = millis();
+            switch (type) {
+                case STREAM_FRAME:
+                    // Only the newest frame in this batch reaches the outputs
+                    if (gotFrame) streamLink.stats.superseded++;
+                    gotFrame = true;
+                    break;
+                case STREAM_BRIGHTNESS:
+                    if (streamLink.bodyLen() >= 1) streamBrightness = streamLink.body()[0];
+                    break;
+                case STREAM_PING:
+                    streamReplyStats(streamLink.seq());
+                    break;
+                case STREAM_STOP:
+                    streamLinkEnd("stop");
+                    break;
+            }
+        }
+    }
+
+    if (gotFrame) {
+        const Frame& f = streamLink.frame();
+        ledSink().writeDuties(f.duty);
+        ledSink().show(f.leds, streamBrightness);
+        streamLink.stats.shown++;
+    }
+
+    if (streamActive && millis() - streamLastPacket >= STREAM_IDLE_MS) streamLinkEnd("idle");
+    return streamActive;
+}
+
+bool streamLinkActive() {
+    return streamActive;
+}
@@ -0,0 +1,126 @@
+#pragma once
+#include <Arduino.h>
+#include "config.h"
+#include "frame.h"
+
+// ─── Frame stream ─────────────────────────────────────────────────────────────
+//
+// Binary packets on the CLI's USB serial port, so a PC can drive every output
+// at full frame rate instead of one text command at a time. Each packet is
+//
+//   type     uint8_t    StreamType
+//   seq      uint16_t   little-endian; the sender increments it per packet,
+//                       so a gap counts the packets lost on the way
+//   body     type-specific, see StreamType
+//   crc      uint16_t   big-endian CRC-16/CCITT-FALSE of type, seq and body
+//
+// COBS-encoded and terminated by a 0x00 byte. COBS output never contains
+// 0x00, so a receiver resynchronises at the next delimiter after any loss or
+// corruption, and a text command (which never contains 0x00 either) cannot
+// be mistaken for a packet. The CLI switches the port into stream mode the
+// first time it reads a 0x00.
+//
+// StreamDecoder undoes COBS and checks the CRC byte by byte as the wire
+// bytes arrive. A FRAME body is written straight into the back half of a
+// double-buffered Frame — the wire order is the Frame's own memory layout —
+// and the halves swap once the CRC verifies, so a frame is never copied and
+// a corrupt one is never seen.
+
+enum StreamType : uint8_t {
+    STREAM_NONE       = 0x00,
+    STREAM_FRAME      = 0x01,   // host → device: Frame (NUM_LEDS × r,g,b, then duty[4] LE)
+    STREAM_BRIGHTNESS = 0x02,   // host → device: uint8_t strip brightness
+    STREAM_PING       = 0x03,   // host → device: no body; answered by STATS with the same seq
+    STREAM_STOP       = 0x04,   // host → device: no body; back to the text CLI
+    STREAM_STATS      = 0x81,   // device → host: StreamStats
+};
+
+inline constexpr uint8_t STREAM_HEADER_BYTES = 3;   // type + seq
+inline constexpr uint8_t STREAM_CRC_BYTES    = 2;
+inline constexpr uint8_t STREAM_CTRL_MAX     = 32;  // longest non-frame body accepted
+
+static_assert(sizeof(Frame) == NUM_LEDS * 3 + 4 * sizeof(uint16_t),
+              "Frame is the FRAME packet body and must have no padding");
+
+// Counters reported in a STATS packet. All little-endian uint32_t on the wire.
+struct StreamStats {
+    uint32_t packets;      // packets that verified
+    uint32_t frames;       // FRAME packets that verified
+    uint32_t dropped;      // packets missing from the seq sequence
+    uint32_t crcErrors;
+    uint32_t badPackets;   // truncated, overlong, wrong length or unknown type
+    uint32_t shown;        // frames committed to the outputs (device link)
+    uint32_t superseded;   // frames replaced by a newer one before being shown
+};
+static_assert(sizeof(StreamStats) == 7 * sizeof(uint32_t), "StreamStats is a wire format");
+
+// CRC-16/CCITT-FALSE: poly 0x1021, init 0xFFFF. Running the CRC over a
+// packet with its big-endian CRC appended leaves 0.
+inline uint16_t streamCrcByte(uint16_t crc, uint8_t b) {
+    crc ^= (uint16_t)b << 8;
+    for (int i = 0; i < 8; i++) crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+    return crc;
+}
+
+// Worst-case wire size of a packet with an n-byte body, delimiter included.
+constexpr size_t streamWireBytes(size_t n) {
+    return n + STREAM_HEADER_BYTES + STREAM_CRC_BYTES + (n + STREAM_HEADER_BYTES + STREAM_CRC_BYTES) / 254 + 2;
+}
+
+// Build one packet into out[streamWireBytes(len)]; returns the bytes used.
+size_t streamEncode(uint8_t type, uint16_t seq, const void* body, size_t len, uint8_t* out);
+
+class StreamDecoder {
+public:
+    // Feed one wire byte. Returns the type of a packet this byte completed
+    // and verified, STREAM_NONE otherwise.
+    uint8_t push(uint8_t b);
+
+    // Discard any partial packet; the next byte starts a new one.
+    void reset();
+
+    // The newest verified frame. Stays valid until the next FRAME completes.
+    const Frame& frame() const { return frames_[front_]; }
+
+    // seq and body of the packet push() just returned.
+    uint16_t       seq()     const { return seq_; }
+    const uint8_t* body()    const { return ctrl_; }
+    uint8_t        bodyLen() const { return ctrlLen_; }
+
+    StreamStats stats = {};
+
+private:
+    void emit(uint8_t b);
+    uint8_t finish();
+
+    Frame    frames_[2];
+    uint8_t  front_       = 0;
+    uint8_t  head_[STREAM_HEADER_BYTES];
+    uint8_t  ctrl_[STREAM_CTRL_MAX + STREAM_CRC_BYTES];
+    uint8_t  ctrlLen_     = 0;
+    uint16_t seq_         = 0;
+    uint16_t lastSeq_     = 0;       // of the last verified packet
+    bool     haveSeq_     = false;
+
+    // Packet being decoded
+    uint16_t n_           = 0;       // decoded bytes so far
+    uint16_t crc_         = 0xFFFF;
+    uint8_t  block_       = 0;       // COBS data bytes left in the current block
+    bool     zeroPending_ = false;   // the current block ends in an encoded 0x00
+    bool     overrun_     = false;
+};
+
+// ── Device link ───────────────────────────────────────────────────────────────
+//
+// Owned by the CLI. While active it reads the serial port, commits each
+// newest verified frame to the sink (loop() stops showing leds[]) and answers
+// PINGs. The caller pauses the render task around it.
+
+// Switch the port into stream mode with fresh counters.
+void streamLinkBegin();
+
+// Read and apply whatever has arrived. False once the link has ended (STOP
+// or STREAM_IDLE_MS without a valid packet).
+bool streamLinkUpdate();
+
+bool streamLinkActive();
@@ -0,0 +1,16 @@
+#include "strip_segments.h"
+
+void stripScatter(const StripLayout& l, const CRGB* logical, CRGB* wire) {
+    const CRGB* src = logical;
+    CRGB*       dst = wire;
+    for (int s = 0; s < l.count; s++) {
+        uint16_t n = l.lengths[s];
+        if (l.reversed[s]) {
+            for (uint16_t i = 0; i < n; i++) dst[i] = src[n - 1 - i];
+        } else {
+            memcpy(dst, src, n * sizeof(CRGB));
+        }
+        src += n;
+        dst += n;
+    }
+}
@@ -0,0 +1,96 @@
+#pragma once
+#include <Arduino.h>
+#include <FastLED.h>
+#include "config.h"
+
+// ─── Strip segments ───────────────────────────────────────────────────────────
+//
+// Mode engines draw one logical strip of NUM_LEDS pixels. On the wire it is
+// split into the consecutive runs described by STRIP_SEGMENT_* in config.h,
+// each driven by its own RMT channel. The output sink keeps a wire buffer
+// with the same size and segment order as the logical strip; each segment's
+// controller is registered on its slice of that buffer, and stripScatter()
+// copies a logical frame into it, flipping reversed runs.
+//
+// Everything here takes the layout as a parameter and is constexpr or plain
+// memory work, so other layouts can be checked on a host build.
+
+struct StripLayout {
+    const int*      pins;
+    const uint16_t* lengths;
+    const bool*     reversed;
+    int             count;
+};
+
+enum StripLayoutError : uint8_t {
+    STRIP_LAYOUT_OK,
+    STRIP_LAYOUT_EMPTY,            // no segments, or more than there are RMT channels
+    STRIP_LAYOUT_ZERO_LENGTH,      // a segment with no pixels
+    STRIP_LAYOUT_LENGTH_SUM,       // lengths do not add up to the strip
+    STRIP_LAYOUT_DUPLICATE_PIN,    // two segments on one pin
+};
+
+inline constexpr int STRIP_SEGMENTS = sizeof(STRIP_SEGMENT_PINS) / sizeof(STRIP_SEGMENT_PINS[0]);
+
+inline constexpr StripLayout STRIP_LAYOUT = {
+    STRIP_SEGMENT_PINS, STRIP_SEGMENT_LEDS, STRIP_SEGMENT_REVERSED, STRIP_SEGMENTS
+};
+
+constexpr StripLayoutError stripLayoutCheck(const StripLayout& l, int numLeds, int maxChannels) {
+    if (l.count <= 0 || l.count > maxChannels) return STRIP_LAYOUT_EMPTY;
+    int sum = 0;
+    for (int s = 0; s < l.count; s++) {
+        if (l.lengths[s] == 0) return STRIP_LAYOUT_ZERO_LENGTH;
+        sum += l.lengths[s];
+        for (int t = 0; t < s; t++) {
+            if (l.pins[t] == l.pins[s]) return STRIP_LAYOUT_DUPLICATE_PIN;
+        }
+    }
+    return sum == numLeds ? STRIP_LAYOUT_OK : STRIP_LAYOUT_LENGTH_SUM;
+}
+
+// Logical index of a segment's first pixel — also its offset in the wire buffer.
+constexpr uint16_t stripSegmentFirst(const StripLayout& l, int seg) {
+    uint16_t first = 0;
+    for (int s = 0; s < seg; s++) first += l.lengths[s];
+    return first;
+}
+
+constexpr uint16_t stripLongestSegment(const StripLayout& l) {
+    uint16_t longest = 0;
+    for (int s = 0; s < l.count; s++) {
+        if (l.lengths[s] > longest) longest = l.lengths[s];
+    }
+    return longest;
+}
+
+// Modelled time for one refresh: the longest segment plus the latch.
+constexpr uint32_t stripWireUs(const StripLayout& l) {
+    return stripLongestSegment(l) * WS2812_US_PER_PIXEL + WS2812_RESET_US;
+}
+
+// Which segment drives logical pixel `led`, and its position along that run
+// counted from the data pin. Returns -1 for pixels outside the layout. The
+// per-pixel form of what stripScatter() does a run at a time; the native
+// test checks one against the other.
+constexpr int stripSegmentOf(const StripLayout& l, int led, uint16_t* along = nullptr) {
+    int first = 0;
+    for (int s = 0; s < l.count; s++) {
+        if (led >= first && led < first + l.lengths[s]) {
+            if (along) *along = (uint16_t)(l.reversed[s] ? first + l.lengths[s] - 1 - led : led - first);
+            return s;
+        }
+        first += l.lengths[s];
+    }
+    return -1;
+}
+
+// Copy a logical frame into the wire buffer; both hold every pixel of the layout.
+void stripScatter(const StripLayout& l, const CRGB* logical, CRGB* wire);
+
+static_assert(sizeof(STRIP_SEGMENT_LEDS) / sizeof(STRIP_SEGMENT_LEDS[0]) == STRIP_SEGMENTS &&
+              sizeof(STRIP_SEGMENT_REVERSED) / sizeof(STRIP_SEGMENT_REVERSED[0]) == STRIP_SEGMENTS,
+              "STRIP_SEGMENT_PINS, _LEDS and _REVERSED need one entry per segment");
+static_assert(stripLayoutCheck(STRIP_LAYOUT, NUM_LEDS, STRIP_RMT_CHANNELS) == STRIP_LAYOUT_OK,
+              "STRIP_SEGMENT_* must cover NUM_LEDS exactly, one pin per segment, "
+              "at most STRIP_RMT_CHANNELS segments");
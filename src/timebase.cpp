@@ -0,0 +1,38 @@
+#include "timebase.h"
+
+#if defined(ESP32)
+#include <esp_timer.h>
+static uint64_t hardwareClockUs() { return (uint64_t)esp_timer_get_time(); }
+#else
+#include <chrono>
+static uint64_t hardwareClockUs() {
+    using namespace std::chrono;
+    return (uint64_t)duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
+#endif
+
+static uint64_t (*clockFn)() = hardwareClockUs;
+static FrameTime current     = {};
+static bool      primed      = false;   // false → next tick has no previous sample
+
+void timebaseTick() {
+    uint64_t now = clockFn();
+    uint64_t dt  = primed ? now - current.nowUs : 0;
+    if (dt > TIMEBASE_MAX_DT_US) dt = TIMEBASE_MAX_DT_US;
+    primed = true;
+
+    current.nowUs = now;
+    current.nowMs = (uint32_t)(now / 1000);
+    current.dtUs  = (uint32_t)dt;
+    current.dtQ16 = (uint32_t)((dt << 16) / 1000);
+    current.simulated = clockFn != hardwareClockUs;
+}
+
+const FrameTime& frameTime() {
+    return current;
+}
+
+void timebaseSetClock(uint64_t (*clockUs)()) {
+    clockFn = clockUs ? clockUs : hardwareClockUs;
+    primed  = false;
+}
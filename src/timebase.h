@@ -0,0 +1,43 @@
+#pragma once
+#include <stdint.h>
+
+// ─── Frame timebase ──────────────────────────────────────────────────────────
+//
+// The render task samples the clock once per frame with timebaseTick(); every
+// engine then reads the same frameTime() instead of calling millis() itself.
+// dt is carried in microseconds and as Q16.16 milliseconds, so engines see
+// sub-millisecond steps at any frame rate instead of 0/1/2 ms jitter.
+//
+// The clock source is swappable (timebaseSetClock) so host builds and
+// simulated runs can drive the engines from a virtual clock.
+
+// Largest dt handed to engines. A paused render task or a long stall resumes
+// with one bounded step instead of a jump that would slam every smoother.
+inline constexpr uint32_t TIMEBASE_MAX_DT_US = 100000;
+
+struct FrameTime {
+    uint64_t nowUs;   // monotonic µs since boot (or since the virtual clock's epoch)
+    uint32_t nowMs;   // nowUs / 1000, wraps like millis()
+    uint32_t dtUs;    // since the previous tick, clamped to TIMEBASE_MAX_DT_US
+    uint32_t dtQ16;   // dt in milliseconds, Q16.16 (65536 = 1 ms)
+    bool simulated;   // driven by a virtual clock — engines skip wall-clock logging
+
+    float dtMs() const { return (float)dtQ16 * (1.0f / 65536.0f); }
+};
+
+// True once `now` has reached `deadline` (both nowMs values), correct across
+// the 49.7-day nowMs wrap as long as deadlines are set less than ~24 days out.
+// Never compare nowMs stamps with >= directly.
+inline bool timeReached(uint32_t now, uint32_t deadline) {
+    return (int32_t)(now - deadline) >= 0;
+}
+
+// Sample the clock and advance frameTime(). Call once per frame, render task only.
+void timebaseTick();
+
+// The current frame's time. Stable for the whole frame.
+const FrameTime& frameTime();
+
+// Replace the clock (µs). nullptr restores the hardware clock. The next tick
+// reports dt = 0 so switching clocks never produces a bogus step.
+void timebaseSetClock(uint64_t (*clockUs)());
@@ -0,0 +1,171 @@
+#include "trace.h"
+
+// ─── Reader ───────────────────────────────────────────────────────────────────
+
+bool TraceReader::open(TraceSource& src) {
+    src_ = &src;
+    if (!src.read(0, &hdr_, sizeof(hdr_))) return false;
+
+    uint32_t indexEnd = sizeof(TraceHeader) + hdr_.blockCount * sizeof(uint32_t);
+    if (hdr_.magic != TRACE_MAGIC || hdr_.version != TRACE_VERSION ||
+        hdr_.channels != TRACE_CHANNELS || hdr_.rateHz == 0 || hdr_.frames == 0 ||
+        hdr_.blockFrames == 0 || hdr_.shift > 15 ||
+        hdr_.blockCount != (hdr_.frames + hdr_.blockFrames - 1) / hdr_.blockFrames ||
+        indexEnd > src.size()) {
+        return false;
+    }
+    return seek(0);
+}
+
+bool TraceReader::fill() {
+    bufBase_ += bufLen_;
+    uint32_t avail = src_->size() > bufBase_ ? src_->size() - bufBase_ : 0;
+    uint16_t len   = avail < TRACE_READ_BUF ? (uint16_t)avail : TRACE_READ_BUF;
+    if (len == 0 || !src_->read(bufBase_, buf_, len)) return false;
+    bufLen_ = len;
+    bufPos_ = 0;
+    return true;
+}
+
+bool TraceReader::readByte(uint8_t& b) {
+    if (bufPos_ == bufLen_ && !fill()) return false;
+    b = buf_[bufPos_++];
+    return true;
+}
+
+bool TraceReader::readNibble(uint8_t& n) {
+    if (nibble_ != NO_NIBBLE) {
+        n       = nibble_;
+        nibble_ = NO_NIBBLE;
+        return true;
+    }
+    uint8_t b;
+    if (!readByte(b)) return false;
+    n       = b & 0x0F;
+    nibble_ = b >> 4;
+    return true;
+}
+
+bool TraceReader::seek(uint32_t frame) {
+    if (frame >= hdr_.frames) return false;
+    uint32_t block  = frame / hdr_.blockFrames;
+    uint32_t offset = 0;
+    if (!src_->read(sizeof(TraceHeader) + block * sizeof(uint32_t), &offset, sizeof(offset)) ||
+        offset >= src_->size()) {
+        return false;
+    }
+
+    // Empty window at the block start; the first readByte() refills it.
+    bufBase_ = offset;
+    bufLen_  = 0;
+    bufPos_  = 0;
+    frame_   = block * hdr_.blockFrames;
+    inBlock_ = 0;
+
+    uint16_t skip[TRACE_CHANNELS];
+    while (frame_ < frame) {
+        if (!next(skip)) return false;
+    }
+    return true;
+}
+
+bool TraceReader::next(uint16_t out[TRACE_CHANNELS]) {
+    if (frame_ >= hdr_.frames && !seek(0)) return false;
+
+    // Blocks start on a byte: drop the previous block's pad nibble
+    if (inBlock_ == 0) nibble_ = NO_NIBBLE;
+
+    for (int ch = 0; ch < TRACE_CHANNELS; ch++) {
+        if (inBlock_ == 0) {
+            // Block keyframe: absolute little-endian uint16
+            uint8_t lo, hi;
+            if (!readByte(lo) || !readByte(hi)) return false;
+            last_[ch] = (uint16_t)(lo | (hi << 8));
+        } else {
+            // Zigzag nibble-varint delta from the previous frame
+            uint32_t v = 0;
+            uint8_t  n;
+            for (int shift = 0;; shift += 3) {
+                if (shift > 15 || !readNibble(n)) return false;
+                v |= (uint32_t)(n & 0x7) << shift;
+                if (!(n & 0x8)) break;
+            }
+            int32_t delta = (int32_t)(v >> 1) ^ -(int32_t)(v & 1);
+            last_[ch] = (uint16_t)(last_[ch] + delta);
+        }
+        uint32_t sample = (uint32_t)last_[ch] << hdr_.shift;
+        out[ch] = (uint16_t)(sample > (uint32_t)MAX_DUTY ? MAX_DUTY : sample);
+    }
+
+    frame_++;
+    if (++inBlock_ == hdr_.blockFrames) inBlock_ = 0;
+    return true;
+}
+
+// ─── Player ───────────────────────────────────────────────────────────────────
+
+bool tracePlayerBegin(TracePlayer& p, TraceSource* src) {
+    p.ready = false;
+    p.accUs = 0;
+    if (!src || !p.reader.open(*src)) return false;
+    p.periodUs = 1000000UL / p.reader.header().rateHz;
+    if (!p.reader.next(p.from) || !p.reader.next(p.to)) return false;
+    p.ready = true;
+    return true;
+}
+
+void tracePlayerStep(TracePlayer& p, uint32_t dtUs, uint16_t out[TRACE_CHANNELS]) {
+    if (p.ready) {
+        p.accUs += dtUs;
+        while (p.accUs >= p.periodUs) {
+            p.accUs -= p.periodUs;
+            memcpy(p.from, p.to, sizeof(p.from));
+            if (!p.reader.next(p.to)) { p.ready = false; break; }
+        }
+    }
+    if (!p.ready) {
+        memset(out, 0, TRACE_CHANNELS * sizeof(uint16_t));
+        return;
+    }
+    for (int ch = 0; ch < TRACE_CHANNELS; ch++) {
+        int32_t span = (int32_t)p.to[ch] - (int32_t)p.from[ch];
+        out[ch] = (uint16_t)(p.from[ch] + (int64_t)span * p.accUs / p.periodUs);
+    }
+}
+
+// ─── Flash storage ────────────────────────────────────────────────────────────
+
+#if defined(ESP32)
+
+#include <esp_partition.h>
+
+// The partition is memory-mapped through the flash cache, so the reader's
+// window refills are plain memcpy()s and never disable the cache under the
+// other core the way esp_partition_read() does.
+TraceSource* traceFlashSource() {
+    static MemoryTraceSource* source = nullptr;
+    static bool               probed = false;
+    if (probed) return source;
+    probed = true;
+
+    const esp_partition_t* part = esp_partition_find_first(
+        ESP_PARTITION_TYPE_DATA, (esp_partition_subtype_t)TRACE_PARTITION_SUBTYPE, TRACE_PARTITION);
+    if (!part) return nullptr;
+
+    const void*                 mapped = nullptr;
+    esp_partition_mmap_handle_t handle;
+    if (esp_partition_mmap(part, 0, part->size, ESP_PARTITION_MMAP_DATA, &mapped, &handle) != ESP_OK) {
+        return nullptr;
+    }
+    static MemoryTraceSource mappedSource(static_cast<const uint8_t*>(mapped), part->size);
+    source = &mappedSource;
+    return source;
+}
+
+#else
+
+TraceSource* traceFlashSource() {
+    return nullptr;
+}
+
+#endif
@@ -0,0 +1,138 @@
+#pragma once
+#include <Arduino.h>
+#include "config.h"
+
+// ─── Flame traces ─────────────────────────────────────────────────────────────
+//
+// Recorded luminance traces — captured from a real candle or generated
+// offline with tools/trace_encode.py — played back in Trace mode instead of
+// the procedural engine. A trace is a fixed-rate series of frames, one sample
+// per channel, stored as deltas in nibble varints: 5–7 bits per sample, so
+// ten minutes at 100 Hz is 145–195 KB of flash, and a frame decodes in a
+// few dozen cycles.
+//
+// Layout (little-endian):
+//
+//   header   TraceHeader
+//   index    blockCount × uint32_t — byte offset of each block from the start
+//   blocks   back to back, each starting on a byte; each is
+//              channels × uint16_t        absolute samples (first frame)
+//              (blockFrames − 1) frames × channels × zigzag deltas
+//
+// A delta is a nibble varint: 3 value bits per nibble, least significant
+// group first, bit 3 set while more follow. Nibbles fill each byte low half
+// first; a block's odd last nibble is padded with zero. Most flame steps take
+// one or two nibbles.
+//
+// Samples are stored >> shift (the encoder rounds) and restored << shift; at
+// shift 2 the deltas mostly fit one nibble, which is where the 145 KB figure
+// comes from. Only the first frame of a block is absolute, so the index gives
+// random access to any block without decoding what comes before it.
+
+enum TraceChannel : uint8_t { TRACE_W1, TRACE_W2, TRACE_RED, TRACE_STRIP, TRACE_CHANNELS };
+
+inline constexpr uint32_t TRACE_MAGIC   = 0x43525446;   // "FTRC"
+inline constexpr uint8_t  TRACE_VERSION = 2;   // 1 had byte-wide LEB128 deltas
+
+struct TraceHeader {
+    uint32_t magic;
+    uint8_t  version;
+    uint8_t  channels;      // TRACE_CHANNELS: W1, W2, RED duty, strip level (all 0–MAX_DUTY)
+    uint16_t rateHz;        // frames per second of trace time
+    uint32_t frames;
+    uint16_t blockFrames;   // frames per seek block
+    uint8_t  shift;         // sample quantisation, bits dropped by the encoder
+    uint8_t  reserved;
+    uint32_t blockCount;
+};
+static_assert(sizeof(TraceHeader) == 20, "TraceHeader is an on-flash format");
+
+// ── Storage ───────────────────────────────────────────────────────────────────
+
+// Random-access byte storage holding one trace.
+class TraceSource {
+public:
+    virtual ~TraceSource() = default;
+    virtual uint32_t size() const = 0;
+    virtual bool     read(uint32_t offset, void* dst, uint32_t len) = 0;
+};
+
+// A trace already in memory (host tools, tests, benchmarks).
+class MemoryTraceSource : public TraceSource {
+public:
+    MemoryTraceSource(const uint8_t* data, uint32_t size) : data_(data), size_(size) {}
+    uint32_t size() const override { return size_; }
+    bool read(uint32_t offset, void* dst, uint32_t len) override {
+        if (offset > size_ || len > size_ - offset) return false;
+        memcpy(dst, data_ + offset, len);
+        return true;
+    }
+
+private:
+    const uint8_t* data_;
+    uint32_t       size_;
+};
+
+// The TRACE_PARTITION flash partition, or nullptr if this build has none.
+TraceSource* traceFlashSource();
+
+// ── Streaming decoder ─────────────────────────────────────────────────────────
+//
+// Reads through a TRACE_READ_BUF window — the trace is never decompressed as
+// a whole. next() runs off the end back to frame 0, so playback loops.
+
+class TraceReader {
+public:
+    // Validate the header and index against the source; positions at frame 0.
+    bool open(TraceSource& src);
+
+    // Jump to any frame via the block index.
+    bool seek(uint32_t frame);
+
+    // Decode the next frame into out[TRACE_CHANNELS]. False on a read error
+    // or corrupt data; the reader must be re-opened.
+    bool next(uint16_t out[TRACE_CHANNELS]);
+
+    const TraceHeader& header() const { return hdr_; }
+    uint32_t           frame()  const { return frame_; }
+
+private:
+    static constexpr uint8_t NO_NIBBLE = 0x10;
+
+    bool readByte(uint8_t& b);
+    bool readNibble(uint8_t& n);
+    bool fill();
+
+    TraceSource* src_     = nullptr;
+    TraceHeader  hdr_     = {};
+    uint32_t     bufBase_ = 0;   // source offset of buf_[0]
+    uint16_t     bufLen_  = 0;
+    uint16_t     bufPos_  = 0;
+    uint32_t     frame_   = 0;   // index of the frame next() returns
+    uint16_t     inBlock_ = 0;   // position of that frame within its block
+    uint8_t      nibble_  = NO_NIBBLE;   // unread high half of the last byte
+    uint16_t     last_[TRACE_CHANNELS] = {};
+    uint8_t      buf_[TRACE_READ_BUF];
+};
+
+// ── Player ────────────────────────────────────────────────────────────────────
+//
+// Runs the reader at the trace's own rate and interpolates between frames at
+// the render rate. Per render frame this is one lerp per channel; a trace
+// frame is decoded only every 1/rateHz.
+
+struct TracePlayer {
+    TraceReader reader;
+    uint16_t    from[TRACE_CHANNELS] = {};
+    uint16_t    to[TRACE_CHANNELS]   = {};
+    uint32_t    periodUs = 0;
+    uint32_t    accUs    = 0;   // time into the from → to interval
+    bool        ready    = false;
+};
+
+// Open src (may be nullptr) and prime the first interval. False if there is
+// no valid trace; the player then outputs zeros.
+bool tracePlayerBegin(TracePlayer& p, TraceSource* src);
+
+// Advance by dtUs and write the interpolated samples to out[TRACE_CHANNELS].
+void tracePlayerStep(TracePlayer& p, uint32_t dtUs, uint16_t out[TRACE_CHANNELS]);
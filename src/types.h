@@ -5,12 +5,17 @@ enum CandleMode {
     COLOR_MODE,
     MAGIC_MODE,
     AUTO_MODE,
+    TRACE_MODE,
     NUM_MODES
 };
 
+struct Frame;
+
+// Engines draw into the frame they are handed (see frame.h). enter sets up
+// the outputs the mode holds steady, exit leaves the frame black.
 struct ModeConfig {
     const char* name;
-    void (*updateFunction)();
-    void (*enterFunction)();
-    void (*exitFunction)();
+    void (*updateFunction)(Frame& out);
+    void (*enterFunction)(Frame& out);
+    void (*exitFunction)(Frame& out);
 };
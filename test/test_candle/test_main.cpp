@@ -0,0 +1,96 @@
+#include <unity.h>
+#include "config.h"
+#include "candle.h"
+#include "candle_bank.h"
+#include "flame_profile.h"
+#include "noise_table.h"
+#include "prng.h"
+
+// ─── Candle engine ───────────────────────────────────────────────────────────
+//
+// The Q16 engine against the float reference it replaced (as `bench candle`
+// does on the device): both fed the same scheduler decisions and noise
+// positions at uneven frame intervals, through sub-mode crossfades and
+// snuffs, must agree to within one duty count on every channel. A fresh
+// CandleBank starts with its sub-modes mixed by the profiles' PCT weights.
+
+void setUp() {}
+void tearDown() {}
+
+static void test_fixed_point_matches_float_reference() {
+    static constexpr int      FRAMES   = 60000;
+    static constexpr uint32_t DT_US[]  = {300, 1000, 1000, 1000, 2500, 5000};
+    static constexpr int      DT_COUNT = sizeof(DT_US) / sizeof(DT_US[0]);
+
+    noiseTableBegin();
+    Prng dtRng;
+    dtRng.seed(6);
+
+    CandleSchedule sched;
+    CandleRefState ref;
+    CandleState    fix;
+    uint64_t       nowUs = 0;
+    candleScheduleBegin(sched, 0);
+    candleRefBegin(ref);
+    candleSyncFromRef(fix, ref);
+
+    int maxErr[3]   = {0, 0, 0};
+    int xfadeFrames = 0, snuffFrames = 0;
+    for (int i = 0; i < FRAMES; i++) {
+        uint32_t dtUs = DT_US[dtRng.below(DT_COUNT)];
+        nowUs += dtUs;
+        CandleControl ctl = candleScheduleStep(sched, nowUs);
+        if (ctl.xfading) xfadeFrames++;
+
+        // The float axes accumulate rounding the phases do not; resync them
+        // each frame so only the per-frame arithmetic is compared
+        for (int k = 0; k < FLAME_OCTAVES; k++) fix.phOctave[k] = noisePhaseFromUnits(ref.tOctave[k]);
+        fix.phGust = noisePhaseFromUnits(ref.tGust);
+        fix.phW1   = noisePhaseFromUnits(ref.tW1);
+        fix.phW2   = noisePhaseFromUnits(ref.tW2);
+
+        CandleDuty r = candleRefStep(ref, ctl, dtUs / 1000.0f);
+        CandleDuty f = candleStep(fix, ctl, (uint32_t)(((uint64_t)dtUs << 16) / 1000));
+        if (ref.snuffW1 < 1.0f || ref.snuffW2 < 1.0f) snuffFrames++;
+
+        int err[3] = {abs((int)r.w1 - (int)f.w1), abs((int)r.w2 - (int)f.w2), abs((int)r.red - (int)f.red)};
+        for (int ch = 0; ch < 3; ch++) {
+            if (err[ch] > maxErr[ch]) maxErr[ch] = err[ch];
+        }
+    }
+
+    char msg[96];
+    snprintf(msg, sizeof(msg), "max duty error W1=%d W2=%d red=%d  xfade=%d snuffed=%d frames",
+             maxErr[0], maxErr[1], maxErr[2], xfadeFrames, snuffFrames);
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_LESS_OR_EQUAL_INT(1, maxErr[0]);
+    TEST_ASSERT_LESS_OR_EQUAL_INT(1, maxErr[1]);
+    TEST_ASSERT_LESS_OR_EQUAL_INT(1, maxErr[2]);
+    TEST_ASSERT_GREATER_THAN(0, xfadeFrames);   // the comparison covered crossfades
+    TEST_ASSERT_GREATER_THAN(0, snuffFrames);   // and snuffs
+}
+
+static void test_bank_starts_with_weighted_sub_modes() {
+    static CandleBank<20000> bank;
+    CandleBankView v = bank.view();
+    prngSetRoot(11);
+    candleBankBegin(v, 0);
+
+    int count[FLAME_SUBMODES] = {};
+    for (int i = 0; i < v.n; i++) count[v.subMode[i]]++;
+    for (int m = 0; m < FLAME_SUBMODES; m++) {
+        float pct = 100.0f * count[m] / v.n;
+        char  msg[64];
+        snprintf(msg, sizeof(msg), "%-8s %5.1f%%  (configured %d%%)", FLAME_PROFILES[m].name, pct,
+                 FLAME_PROFILES[m].pct);
+        TEST_MESSAGE(msg);
+        TEST_ASSERT_FLOAT_WITHIN(1.5f, (float)FLAME_PROFILES[m].pct, pct);
+    }
+}
+
+int main(int, char**) {
+    UNITY_BEGIN();
+    RUN_TEST(test_fixed_point_matches_float_reference);
+    RUN_TEST(test_bank_starts_with_weighted_sub_modes);
+    return UNITY_END();
+}
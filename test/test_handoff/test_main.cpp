@@ -0,0 +1,127 @@
+#include <unity.h>
+#include <atomic>
+#include <thread>
+#include "spsc_queue.h"
+#include "frame_buffer.h"
+
+// ─── Render handoff stress ───────────────────────────────────────────────────
+//
+// The queues between loop() and the render task, hammered from two
+// std::threads: every message arrives once, in order and untorn, and the
+// frame double buffer never hands the reader a half-written frame. Both
+// sides yield when they cannot make progress so the test also completes on a
+// single-core host.
+
+void setUp() {}
+void tearDown() {}
+
+static constexpr uint32_t MESSAGES = 1000000;
+
+struct Msg {
+    uint32_t seq;
+    uint32_t inv;    // ~seq: a torn copy shows up as a mismatch
+    uint64_t pad[2];
+};
+
+static void test_spsc_delivers_every_message_in_order() {
+    static SpscQueue<Msg, 64> q;
+    std::atomic<bool> producerDone{false};
+
+    std::thread producer([&] {
+        for (uint32_t i = 0; i < MESSAGES; i++) {
+            Msg m = {i, ~i, {i, i}};
+            while (!q.push(m)) std::this_thread::yield();
+        }
+        producerDone.store(true);
+    });
+
+    uint32_t expected = 0;
+    uint32_t bad      = 0;
+    Msg      m;
+    while (expected < MESSAGES) {
+        if (!q.pop(m)) {
+            std::this_thread::yield();
+            continue;
+        }
+        if (m.seq != expected || m.inv != ~expected || m.pad[0] != expected || m.pad[1] != expected) bad++;
+        expected = m.seq + 1;
+    }
+    producer.join();
+
+    TEST_ASSERT_EQUAL_UINT32(0, bad);
+    TEST_ASSERT_EQUAL_UINT32(MESSAGES, expected);
+    TEST_ASSERT_TRUE(producerDone.load());
+    TEST_ASSERT_FALSE(q.pop(m));
+    TEST_ASSERT_TRUE(q.empty());
+}
+
+static void test_spsc_full_ring_drops_new_messages() {
+    SpscQueue<uint32_t, 8> q;
+    for (uint32_t i = 0; i < 8; i++) TEST_ASSERT_TRUE(q.push(i));
+    TEST_ASSERT_FALSE(q.push(99));
+    uint32_t v;
+    for (uint32_t i = 0; i < 8; i++) {
+        TEST_ASSERT_TRUE(q.pop(v));
+        TEST_ASSERT_EQUAL_UINT32(i, v);
+    }
+    TEST_ASSERT_FALSE(q.pop(v));
+}
+
+struct BigFrame {
+    uint32_t seq;
+    uint8_t  fill[508];   // every byte (seq & 0xFF)
+};
+
+static void test_frame_buffer_never_tears() {
+    static FrameBuffer<BigFrame> fb;
+    static constexpr uint32_t FRAMES = 200000;
+    std::atomic<bool> writerDone{false};
+
+    std::thread writer([&] {
+        static BigFrame f;
+        for (uint32_t i = 1; i <= FRAMES; i++) {
+            f.seq = i;
+            memset(f.fill, (int)(i & 0xFF), sizeof(f.fill));
+            fb.publish(f);
+            if ((i & 63) == 0) std::this_thread::yield();
+        }
+        writerDone.store(true);
+    });
+
+    static BigFrame got;
+    uint32_t lastSeq   = 0;
+    uint32_t lastFrame = 0;
+    uint32_t reads     = 0;
+    uint32_t torn      = 0;
+    uint32_t backwards = 0;
+    for (;;) {
+        bool done = writerDone.load();
+        if (fb.read(got, lastSeq)) {
+            reads++;
+            for (size_t k = 0; k < sizeof(got.fill); k++) {
+                if (got.fill[k] != (uint8_t)got.seq) { torn++; break; }
+            }
+            if (got.seq <= lastFrame) backwards++;
+            lastFrame = got.seq;
+        } else if (done) {
+            break;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    writer.join();
+
+    TEST_ASSERT_EQUAL_UINT32(0, torn);
+    TEST_ASSERT_EQUAL_UINT32(0, backwards);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, reads);
+    TEST_ASSERT_EQUAL_UINT32(FRAMES, lastFrame);   // the newest frame always wins in the end
+    TEST_ASSERT_EQUAL_UINT32(FRAMES, fb.sequence());
+}
+
+int main(int, char**) {
+    UNITY_BEGIN();
+    RUN_TEST(test_spsc_delivers_every_message_in_order);
+    RUN_TEST(test_spsc_full_ring_drops_new_messages);
+    RUN_TEST(test_frame_buffer_never_tears);
+    return UNITY_END();
+}
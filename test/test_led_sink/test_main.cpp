@@ -0,0 +1,122 @@
+#include <unity.h>
+#include "led_sink.h"
+#include "strip_segments.h"
+#include "frame.h"
+#include "timebase.h"
+#include "types.h"
+
+// ─── Output latency ──────────────────────────────────────────────────────────
+//
+// RecordingLedSink on a virtual clock: how long after the render task hands
+// over a frame the last strip pixel latches, for single frames, frames that
+// queue behind a busy wire, and a mode engine at the render task's rate.
+
+void setup();
+extern const ModeConfig MODES[];
+
+static uint64_t clockUs = 0;
+static uint64_t clock64() { return clockUs; }
+static uint32_t clock32() { return (uint32_t)clockUs; }
+
+static constexpr uint32_t WIRE_US = stripWireUs(STRIP_LAYOUT);
+
+static LedRecord records[512];
+
+void setUp() { clockUs = 1000000; }
+void tearDown() {}
+
+static void fillLeds(CRGB* leds, uint8_t v) {
+    for (int i = 0; i < NUM_LEDS; i++) leds[i] = CRGB(v, (uint8_t)i, 0);
+}
+
+static void test_idle_wire_latency_is_wire_time() {
+    RecordingLedSink sink(records, 512, clock32);
+    CRGB leds[NUM_LEDS];
+    fillLeds(leds, 1);
+    sink.show(leds, 255);
+
+    TEST_ASSERT_EQUAL_UINT32(1, sink.count());
+    TEST_ASSERT_EQUAL_UINT32(WIRE_US, sink.at(0).doneUs - sink.at(0).startUs);
+    TEST_ASSERT_TRUE(sink.stripBusy());
+    clockUs += WIRE_US;
+    TEST_ASSERT_FALSE(sink.stripBusy());
+}
+
+static void test_frame_queues_behind_busy_wire() {
+    RecordingLedSink sink(records, 512, clock32);
+    CRGB leds[NUM_LEDS];
+    fillLeds(leds, 1);
+    sink.show(leds, 255);
+    clockUs += 100;
+    fillLeds(leds, 2);
+    sink.show(leds, 255);
+
+    TEST_ASSERT_EQUAL_UINT32(2, sink.count());
+    TEST_ASSERT_EQUAL_UINT32(2 * WIRE_US - 100, sink.at(1).doneUs - sink.at(1).startUs);
+}
+
+static void test_unchanged_frame_is_skipped() {
+    RecordingLedSink sink(records, 512, clock32);
+    CRGB leds[NUM_LEDS];
+    fillLeds(leds, 3);
+    sink.show(leds, 255);
+    clockUs += 5000;
+    sink.show(leds, 255);
+    sink.show(leds, 128);   // brightness alone is a change
+
+    TEST_ASSERT_EQUAL_UINT32(2, sink.count());
+    TEST_ASSERT_EQUAL_UINT32(2, sink.showsSent);
+    TEST_ASSERT_EQUAL_UINT32(1, sink.showsSkipped);
+}
+
+// Colour mode at the render task's 1 kHz, committed the way loop() does:
+// every frame that changed reaches the latch one wire time after handover.
+static void test_color_mode_latency_at_render_rate() {
+    setup();   // palettes and noise table, as at boot
+    RecordingLedSink sink(records, 512, clock32);
+    timebaseSetClock(clock64);
+    timebaseTick();
+    static Frame frame;
+    frameClear(frame);
+    MODES[COLOR_MODE].enterFunction(frame);
+
+    uint32_t maxLatency = 0;
+    uint64_t sumLatency = 0;
+    size_t   shown      = 0;
+    auto     drain      = [&] {
+        for (size_t i = 0; i < sink.count(); i++) {
+            uint32_t lat = sink.at(i).doneUs - sink.at(i).startUs;
+            if (lat > maxLatency) maxLatency = lat;
+            sumLatency += lat;
+        }
+        shown += sink.count();
+        sink.clear();
+    };
+    for (int f = 0; f < 60000; f++) {
+        clockUs += 1000;
+        timebaseTick();
+        MODES[COLOR_MODE].updateFunction(frame);
+        sink.writeDuties(frame.duty);
+        sink.show(frame.leds, 255);
+        if (sink.count() == 512) drain();
+    }
+    drain();
+    timebaseSetClock(nullptr);
+
+    char msg[96];
+    snprintf(msg, sizeof(msg), "colour mode: %u frames shown, latency mean %.0f us, max %u us",
+             (unsigned)shown, shown ? (double)sumLatency / shown : 0.0, (unsigned)maxLatency);
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, shown);
+    TEST_ASSERT_EQUAL_UINT32(0, sink.dropped());
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(WIRE_US, maxLatency);
+}
+
+int main(int, char**) {
+    UNITY_BEGIN();
+    RUN_TEST(test_idle_wire_latency_is_wire_time);
+    RUN_TEST(test_frame_queues_behind_busy_wire);
+    RUN_TEST(test_unchanged_frame_is_skipped);
+    RUN_TEST(test_color_mode_latency_at_render_rate);
+    return UNITY_END();
+}
@@ -0,0 +1,70 @@
+#include <unity.h>
+#include "config.h"
+#include "poisson.h"
+#include "candle.h"
+#include "prng.h"
+
+// ─── Poisson event timing ────────────────────────────────────────────────────
+//
+// Event rates must not depend on the frame rate: over a simulated hour the
+// timer, and the candle scheduler's FLICKER snuffs built on it, fire at the
+// configured rate from 30 fps to 5 kHz.
+
+void setUp() {}
+void tearDown() {}
+
+static constexpr uint32_t FPS[]     = {30, 60, 1000, 5000};
+static constexpr uint64_t HOUR_US   = 3600ULL * 1000000;
+
+static void test_timer_rate_is_frame_rate_independent() {
+    for (uint32_t fps : FPS) {
+        Prng rng;
+        rng.seed(fps);
+        PoissonEvent ev;
+        ev.begin(rng, 2.0f, 0);
+
+        uint32_t events = 0;
+        uint64_t frames = HOUR_US * fps / 1000000;
+        for (uint64_t f = 1; f <= frames; f++) {
+            uint64_t nowUs = f * 1000000 / fps;
+            while (ev.poll(rng, nowUs)) events++;   // drain bursts, as the spark spawner does
+        }
+        float rate = events / 3600.0f;
+        char  msg[64];
+        snprintf(msg, sizeof(msg), "%5u fps: %.3f events/s", (unsigned)fps, rate);
+        TEST_MESSAGE(msg);
+        TEST_ASSERT_FLOAT_WITHIN(0.08f, 2.0f, rate);
+    }
+}
+
+static void test_flicker_snuff_rate_is_frame_rate_independent() {
+    for (uint32_t fps : FPS) {
+        prngSetRoot(fps);
+        CandleSchedule s;
+        candleScheduleBegin(s, 0);
+
+        uint32_t snuffs        = 0;
+        uint64_t flickerFrames = 0;
+        uint64_t frames        = HOUR_US * fps / 1000000;
+        for (uint64_t f = 1; f <= frames; f++) {
+            CandleControl c = candleScheduleStep(s, f * 1000000 / fps);
+            if (c.subMode != FlameSubMode::FLICKER) continue;
+            flickerFrames++;
+            snuffs += c.snuffW1;
+        }
+        float seconds = (float)flickerFrames / fps;
+        float rate    = snuffs / seconds;
+        char  msg[80];
+        snprintf(msg, sizeof(msg), "%5u fps: %.3f snuffs/s over %.0f s of FLICKER", (unsigned)fps, rate, seconds);
+        TEST_MESSAGE(msg);
+        TEST_ASSERT_TRUE(seconds > 600.0f);
+        TEST_ASSERT_FLOAT_WITHIN(0.1f * CANDLE_SNUFF_RATE, CANDLE_SNUFF_RATE, rate);
+    }
+}
+
+int main(int, char**) {
+    UNITY_BEGIN();
+    RUN_TEST(test_timer_rate_is_frame_rate_independent);
+    RUN_TEST(test_flicker_snuff_rate_is_frame_rate_independent);
+    return UNITY_END();
+}
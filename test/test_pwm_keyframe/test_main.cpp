@@ -0,0 +1,144 @@
+#include <unity.h>
+#include "config.h"
+#include "frame.h"
+#include "led_sink.h"
+#include "pwm_keyframe.h"
+#include "prng.h"
+#include "timebase.h"
+#include "types.h"
+
+// ─── PWM keyframes ───────────────────────────────────────────────────────────
+//
+// PwmKeyframer against the LEDC model in RecordingLedSink, on a virtual
+// clock: Candle mode rendered at the render task's 1 kHz, sampled into
+// keyframes every PWM_KEYFRAME_MS. The modelled output must only ever move
+// between consecutive keyframes, land on each one before the next is due,
+// and cost well under half the per-frame PWM writes.
+
+void setup();
+extern const ModeConfig MODES[];
+
+static uint64_t clockUs = 0;
+static uint64_t clock64() { return clockUs; }
+static uint32_t clock32() { return (uint32_t)clockUs; }
+
+static constexpr uint32_t FRAMES      = 60000;   // one minute at 1 kHz
+static constexpr uint32_t KEYFRAME_US = PWM_KEYFRAME_MS * 1000;
+static constexpr uint32_t SEED        = 13;
+
+static LedRecord records[4];
+static Frame     frame;
+
+static uint16_t capped(uint8_t ch, uint16_t duty) {
+    return duty > dutyCap(ch) ? (uint16_t)dutyCap(ch) : duty;
+}
+
+void setUp() { clockUs = 1000000; }
+void tearDown() {}
+
+static void test_candle_output_follows_keyframes() {
+    static_assert(PWM_KEYFRAME_MS > 1, "keyframes disabled in config.h");
+    setup();   // palettes and noise table, as at boot
+    prngSetRoot(SEED);
+    timebaseSetClock(clock64);
+    timebaseTick();
+    MODES[CANDLE_MODE].enterFunction(frame);
+
+    RecordingLedSink keyed(records, 4, clock32);
+    RecordingLedSink direct(records, 4, clock32);
+    PwmKeyframer     kf;
+
+    uint16_t prevKey[4] = {}, key[4] = {};
+    uint32_t lastKeyUs  = 0;
+    uint32_t outOfRange = 0, missed = 0, moving = 0;
+    for (uint32_t f = 0; f < FRAMES; f++) {
+        clockUs += 1000;
+        timebaseTick();
+        MODES[CANDLE_MODE].updateFunction(frame);
+        direct.writeDuties(frame.duty);
+
+        uint32_t before = kf.keyframes;
+        if (f > 0 && (uint32_t)clockUs - lastKeyUs >= KEYFRAME_US) {
+            // A keyframe is due: the previous fade must have landed
+            for (uint8_t ch = 0; ch < 4; ch++) missed += keyed.duty(ch) != key[ch];
+        }
+        kf.update(keyed, frame.duty, (uint32_t)clockUs);
+        if (kf.keyframes != before) {
+            lastKeyUs = (uint32_t)clockUs;
+            for (uint8_t ch = 0; ch < 4; ch++) {
+                prevKey[ch] = f == 0 ? capped(ch, frame.duty[ch]) : key[ch];
+                key[ch]     = capped(ch, frame.duty[ch]);
+            }
+        }
+
+        // Mid-fade output lies between the two keyframes it joins
+        for (uint8_t ch = 0; ch < 4; ch++) {
+            uint16_t out = keyed.duty(ch);
+            uint16_t lo  = prevKey[ch] < key[ch] ? prevKey[ch] : key[ch];
+            uint16_t hi  = prevKey[ch] < key[ch] ? key[ch] : prevKey[ch];
+            outOfRange += out < lo || out > hi;
+            moving     += out != key[ch];
+        }
+    }
+    MODES[CANDLE_MODE].exitFunction(frame);
+    timebaseSetClock(nullptr);
+
+    char msg[128];
+    snprintf(msg, sizeof(msg), "%lu keyframes, %lu fades, %lu PWM writes vs %lu per-frame",
+             (unsigned long)kf.keyframes, (unsigned long)kf.fades,
+             (unsigned long)keyed.dutyWrites, (unsigned long)direct.dutyWrites);
+    TEST_MESSAGE(msg);
+
+    TEST_ASSERT_EQUAL_UINT32(FRAMES / PWM_KEYFRAME_MS, kf.keyframes);
+    TEST_ASSERT_EQUAL_UINT32(4, kf.jumps);   // only the first keyframe
+    TEST_ASSERT_EQUAL_UINT32(0, outOfRange);
+    TEST_ASSERT_EQUAL_UINT32(0, missed);
+    TEST_ASSERT_TRUE(moving > 0);             // the fades really interpolate
+    TEST_ASSERT_TRUE(kf.fades > kf.keyframes); // and Candle moves several channels
+    TEST_ASSERT_TRUE(keyed.dutyWrites * 2 < direct.dutyWrites);
+}
+
+static void test_invalidate_jumps_to_the_next_keyframe() {
+    RecordingLedSink sink(records, 4, clock32);
+    PwmKeyframer     kf;
+    uint16_t a[4] = {100, 200, 300, 400};
+    uint16_t b[4] = {500, 200, 0, 40};
+
+    kf.update(sink, a, (uint32_t)clockUs);
+    clockUs += KEYFRAME_US;
+    kf.update(sink, b, (uint32_t)clockUs);
+    TEST_ASSERT_EQUAL_UINT32(3, kf.fades);          // W2 did not move
+    TEST_ASSERT_EQUAL_UINT16(capped(0, 100), sink.duty(0));   // fade just started
+
+    kf.invalidate();
+    clockUs += 1000;                                // not due, but invalid: emits now
+    kf.update(sink, a, (uint32_t)clockUs);
+    TEST_ASSERT_EQUAL_UINT32(8, kf.jumps);
+    for (uint8_t ch = 0; ch < 4; ch++) TEST_ASSERT_EQUAL_UINT16(capped(ch, a[ch]), sink.duty(ch));
+}
+
+static void test_stall_restarts_cadence_without_a_burst() {
+    RecordingLedSink sink(records, 4, clock32);
+    PwmKeyframer     kf;
+    uint16_t d[4] = {10, 20, 30, 40};
+
+    kf.update(sink, d, (uint32_t)clockUs);
+    clockUs += 25 * KEYFRAME_US;   // loop() stalled for 25 intervals
+    for (int i = 0; i < 5; i++) {
+        kf.update(sink, d, (uint32_t)clockUs);
+        clockUs += 1000;
+    }
+    TEST_ASSERT_EQUAL_UINT32(2, kf.keyframes);
+
+    clockUs += KEYFRAME_US - 5000;   // one interval after the catch-up keyframe
+    kf.update(sink, d, (uint32_t)clockUs);
+    TEST_ASSERT_EQUAL_UINT32(3, kf.keyframes);
+}
+
+int main(int, char**) {
+    UNITY_BEGIN();
+    RUN_TEST(test_candle_output_follows_keyframes);
+    RUN_TEST(test_invalidate_jumps_to_the_next_keyframe);
+    RUN_TEST(test_stall_restarts_cadence_without_a_burst);
+    return UNITY_END();
+}
@@ -0,0 +1,81 @@
+#include <unity.h>
+#include "config.h"
+#include "frame.h"
+#include "sim.h"
+
+// ─── 60-day soak ─────────────────────────────────────────────────────────────
+//
+// Candle mode run through the simulator for 60 virtual days at 60 fps —
+// past the 49.7-day nowMs rollover and far past the point where float phase
+// axes used to freeze. The flame must never stall: no channel holds one
+// value for longer than a couple of seconds, before or after the wrap.
+// About two minutes of CPU.
+
+void setup();
+
+void setUp() {}
+void tearDown() {}
+
+static constexpr uint64_t DAY_MS      = 86400000ULL;
+static constexpr uint64_t WRAP_MS     = 1ULL << 32;
+static constexpr uint32_t MAX_HOLD_MS = 2000;   // longest hold seen is ~1.5 s
+
+static const int   CHANNELS[]      = {WHITE_LED_1, WHITE_LED_2, RED_LED};
+static const char* CHANNEL_NAMES[] = {"W1", "W2", "RED"};
+
+// Per-channel longest hold after the rollover, tracked alongside the run's own
+struct AfterWrap {
+    uint16_t last[4]   = {};
+    uint32_t run[4]    = {};
+    uint32_t maxRun[4] = {};
+    uint64_t frames    = 0;
+};
+
+static bool trackAfterWrap(uint64_t tUs, const Frame& frame, void* ctx) {
+    AfterWrap& a = *static_cast<AfterWrap*>(ctx);
+    if (tUs / 1000 < WRAP_MS) return true;
+    for (int ch = 0; ch < 4; ch++) {
+        if (a.frames && frame.duty[ch] == a.last[ch]) a.run[ch]++;
+        else a.run[ch] = 1;
+        if (a.run[ch] > a.maxRun[ch]) a.maxRun[ch] = a.run[ch];
+        a.last[ch] = frame.duty[ch];
+    }
+    a.frames++;
+    return true;
+}
+
+static void test_candle_never_stalls_over_60_days() {
+    setup();   // palettes and noise table, as at boot
+
+    SimOptions opt;
+    opt.mode       = CANDLE_MODE;
+    opt.durationMs = 60 * DAY_MS;
+    opt.fps        = 60;
+    opt.seed       = 12;
+
+    AfterWrap after;
+    SimResult r = simExecute(opt, trackAfterWrap, &after);
+    TEST_ASSERT_FALSE(r.aborted);
+    TEST_ASSERT_TRUE(r.simMs == opt.durationMs);
+    TEST_ASSERT_TRUE(after.frames > 10 * DAY_MS * opt.fps / 1000);
+
+    for (int i = 0; i < 3; i++) {
+        int      ch      = CHANNELS[i];
+        uint64_t holdMs  = simFramesToMs(r.duty[ch].maxRun, opt.fps);
+        uint64_t afterMs = simFramesToMs(after.maxRun[ch], opt.fps);
+        char     msg[96];
+        snprintf(msg, sizeof(msg), "%-3s max hold %llu ms (%llu ms after the wrap), moved on %.1f%% of frames",
+                 CHANNEL_NAMES[i], (unsigned long long)holdMs, (unsigned long long)afterMs,
+                 100.0 * r.duty[ch].moves / (double)r.frames);
+        TEST_MESSAGE(msg);
+        TEST_ASSERT_TRUE(holdMs <= MAX_HOLD_MS);
+        TEST_ASSERT_TRUE(afterMs <= MAX_HOLD_MS);
+    }
+    TEST_ASSERT_TRUE(simFramesToMs(r.stripMaxRun, opt.fps) <= MAX_HOLD_MS);
+}
+
+int main(int, char**) {
+    UNITY_BEGIN();
+    RUN_TEST(test_candle_never_stalls_over_60_days);
+    return UNITY_END();
+}
@@ -0,0 +1,154 @@
+#include <unity.h>
+#include <new>
+#include "config.h"
+#include "frame.h"
+#include "prng.h"
+#include "sparks.h"
+#include "color_strip.h"
+#include "timebase.h"
+#include "types.h"
+
+// ─── Spark particles ─────────────────────────────────────────────────────────
+//
+// The pool's no-heap promise, checked with a counting global operator new
+// (ESP.getFreeHeap() is a constant in the host shim): a full 4000-particle
+// pool stepped, rendered and respawned, and every mode engine's frames.
+// Also the SPARK background fade, which must not depend on the frame rate.
+
+void setup();
+void magicHoldPhase(Frame& out, bool spark);
+extern const ModeConfig MODES[];
+
+// ── Allocation counter ────────────────────────────────────────────────────────
+
+static bool     counting    = false;
+static uint32_t allocations = 0;
+
+void* operator new(size_t n) {
+    if (counting) allocations++;
+    void* p = malloc(n ? n : 1);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+void* operator new[](size_t n) { return operator new(n); }
+void* operator new(size_t n, const std::nothrow_t&) noexcept {
+    if (counting) allocations++;
+    return malloc(n ? n : 1);
+}
+void* operator new[](size_t n, const std::nothrow_t& t) noexcept { return operator new(n, t); }
+void  operator delete(void* p) noexcept { free(p); }
+void  operator delete[](void* p) noexcept { free(p); }
+void  operator delete(void* p, size_t) noexcept { free(p); }
+void  operator delete[](void* p, size_t) noexcept { free(p); }
+
+static void countFrom() { allocations = 0; counting = true; }
+static uint32_t countEnd() { counting = false; return allocations; }
+
+// ── Virtual clock ─────────────────────────────────────────────────────────────
+
+static uint64_t clockUs = 0;
+static uint64_t clock64() { return clockUs; }
+
+static Frame frame;
+
+void setUp() {}
+void tearDown() {}
+
+static void test_counter_sees_allocations() {
+    countFrom();
+    int* p = new int(3);
+    delete p;
+    TEST_ASSERT_EQUAL_UINT32(1, countEnd());
+}
+
+static void test_full_pool_frames_do_not_allocate() {
+    static constexpr int N     = 4000;
+    static constexpr int STRIP = 1000;
+    static SparkPool<N> pool;
+    static CRGB         palette[256];
+    static CRGB         leds[STRIP];
+    hsvPaletteBuild(palette, MAGIC_SPARK_SATURATION, 255);
+    SparkPoolView v = pool.view();
+    Prng rng;
+    rng.seed(1);
+
+    countFrom();
+    for (int f = 0; f < 500; f++) {
+        while (pool.state.live < N) {
+            int32_t vel = rng.range(-(30 << 16), 30 << 16) / 1000;
+            sparkSpawn(v, (int32_t)rng.below(STRIP << 16), vel, (uint8_t)rng.next(),
+                       (uint16_t)rng.range(0x8000, 0xFFFF), (uint32_t)rng.range(100, 1000));
+        }
+        sparkStep(v, 1 << 16, STRIP);
+        fill_solid(leds, STRIP, CRGB::Black);
+        sparkRender(v, palette, leds, STRIP);
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, countEnd());
+    TEST_ASSERT_TRUE(pool.state.spawned > (uint32_t)N);   // the pool really churned
+}
+
+static void test_mode_frames_do_not_allocate() {
+    setup();   // palettes and noise table, as at boot
+    timebaseSetClock(clock64);
+    for (int mode = 0; mode < NUM_MODES; mode++) {
+        prngSetRoot(7);
+        timebaseTick();
+        if (MODES[mode].enterFunction) MODES[mode].enterFunction(frame);
+        if (mode == MAGIC_MODE) magicHoldPhase(frame, true);
+
+        countFrom();
+        for (int f = 0; f < 5000; f++) {
+            clockUs += 1000;
+            timebaseTick();
+            MODES[mode].updateFunction(frame);
+        }
+        uint32_t n = countEnd();
+        if (MODES[mode].exitFunction) MODES[mode].exitFunction(frame);
+
+        char msg[64];
+        snprintf(msg, sizeof(msg), "%s: %lu allocations in 5000 frames", MODES[mode].name, (unsigned long)n);
+        TEST_MESSAGE(msg);
+        TEST_ASSERT_EQUAL_UINT32(0, n);
+    }
+    timebaseSetClock(nullptr);
+}
+
+static void test_background_fade_is_frame_rate_independent() {
+    static constexpr int FADE = MAGIC_SPARK_FADE;
+    const CRGB rest(6, 2, 11);
+    CRGB a[1], b[1], c[1];
+    a[0] = b[0] = c[0] = CRGB(240, 120, 200);
+
+    // 20 ms as twenty 1 ms frames (the render task), one 20 ms frame (a
+    // 50 fps sim) and four 5 ms frames
+    for (int i = 0; i < 20; i++) sparkFadeBackground(a, 1, rest, FADE, 1.0f);
+    sparkFadeBackground(b, 1, rest, FADE, 20.0f);
+    for (int i = 0; i < 4; i++) sparkFadeBackground(c, 1, rest, FADE, 5.0f);
+    for (int ch = 0; ch < 3; ch++) {
+        TEST_ASSERT_INT_WITHIN(3, a[0][ch], b[0][ch]);
+        TEST_ASSERT_INT_WITHIN(3, a[0][ch], c[0][ch]);
+        TEST_ASSERT_TRUE(a[0][ch] < 30);   // most of the way down after 20 ms
+    }
+
+    // A 1 ms frame is exactly the old per-frame nscale8 towards a black rest
+    CRGB d[1] = {CRGB(200, 100, 50)};
+    CRGB e    = d[0];
+    sparkFadeBackground(d, 1, CRGB::Black, FADE, 1.0f);
+    e.nscale8(FADE);
+    for (int ch = 0; ch < 3; ch++) TEST_ASSERT_INT_WITHIN(1, e[ch], d[0][ch]);
+
+    // And it settles on rest from either side
+    CRGB lo[1] = {CRGB::Black};
+    for (int i = 0; i < 200; i++) { sparkFadeBackground(a, 1, rest, FADE, 16.7f); sparkFadeBackground(lo, 1, rest, FADE, 16.7f); }
+    TEST_ASSERT_TRUE(a[0] == rest);
+    TEST_ASSERT_TRUE(lo[0] == rest);
+}
+
+int main(int, char**) {
+    UNITY_BEGIN();
+    RUN_TEST(test_counter_sees_allocations);
+    RUN_TEST(test_full_pool_frames_do_not_allocate);
+    RUN_TEST(test_mode_frames_do_not_allocate);
+    RUN_TEST(test_background_fade_is_frame_rate_independent);
+    return UNITY_END();
+}
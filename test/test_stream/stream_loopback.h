@@ -0,0 +1,555 @@
+// Generated by tools/stream_send.py; do not edit. Regenerate with
+//   tools/stream_send.py --loopback --frames 120 --loss 0.05 --corrupt 0.15 --first-seq 0xffc0 --seed 1 --c-header test/test_stream/stream_loopback.h
+#pragma once
+#include <stdint.h>
+
+// Wire bytes as received: withheld packets left out, damaged ones included
+static const uint8_t STREAM_LOOPBACK_WIRE[8400] = {
+    0x05, 0x01, 0xc0, 0xff, 0xff, 0x01, 0x03, 0x4c, 0x15, 0x03, 0x4c, 0x2b, 0x03, 0x4c, 0x40, 0x03,
+    0x42, 0x4c, 0x03, 0x2d, 0x4c, 0x03, 0x17, 0x4c, 0x03, 0x02, 0x4c, 0x01, 0x03, 0x4c, 0x13, 0x03,
+    0x4c, 0x28, 0x03, 0x4c, 0x3e, 0x03, 0x45, 0x4c, 0x03, 0x2f, 0x4c, 0x03, 0x1a, 0x4c, 0x04, 0x04,
+    0x4c, 0x10, 0x03, 0x4c, 0x26, 0x03, 0x4c, 0x3b, 0x03, 0x4c, 0x4c, 0x03, 0x47, 0x4c, 0x09, 0x32,
+    0xff, 0x03, 0xff, 0x03, 0xff, 0x01, 0xff, 0x03, 0x53, 0xa0, 0x00, 0x06, 0x01, 0xc1, 0xff, 0x4c,
+    0x01, 0x03, 0xff, 0x4d, 0x03, 0x4c, 0x2c, 0x03, 0x4c, 0x42, 0x03, 0x41, 0x4c, 0x03, 0x2b, 0x4c,
+    0x03, 0x16, 0x4c, 0x01, 0x02, 0x4c, 0x01, 0x03, 0x4c, 0x14, 0x03, 0x4c, 0x2a, 0x03, 0x4c, 0x3f,
+    0x03, 0x43, 0x4c, 0x03, 0x2e, 0x4c, 0x03, 0x18, 0x4c, 0x04, 0x02, 0x4c, 0x12, 0x03, 0x4c, 0x28,
+    0x03, 0x4c, 0x3d, 0x03, 0x4c, 0x4c, 0x03, 0x45, 0x4c, 0x09, 0x30, 0xf5, 0x03, 0xf5, 0x03, 0xfa,
+    0x01, 0xfd, 0x03, 0x53, 0xb9, 0x00, 0x06, 0x01, 0xc2, 0xff, 0x4c, 0x03, 0x03, 0x4c, 0x19, 0x03,
+    0xff, 0x9b, 0x03, 0x4c, 0x44, 0x03, 0x3f, 0x4c, 0x03, 0x29, 0x4c, 0x03, 0x14, 0x4c, 0x01, 0x03,
+    0x4c, 0x01, 0x03, 0x4c, 0x16, 0x03, 0x4c, 0x2c, 0x03, 0x4c, 0x41, 0x03, 0x41, 0x4c, 0x03, 0x2c,
+    0x4c, 0x03, 0x16, 0x4c, 0x04, 0x01, 0x4c, 0x14, 0x03, 0x4c, 0x29, 0x03, 0x4c, 0x3f, 0x03, 0x4c,
+    0x4c, 0x03, 0x44, 0x4c, 0x09, 0x2e, 0xeb, 0x03, 0xeb, 0x03, 0xf5, 0x01, 0xfa, 0x03, 0x08, 0xba,
+    0x00, 0x06, 0x01, 0xc3, 0xff, 0x4c, 0x05, 0x03, 0x4c, 0x1a, 0x03, 0x4c, 0x30, 0x03, 0xff, 0xe9,
+    0x03, 0x3d, 0x4c, 0x03, 0x28, 0x4c, 0x03, 0x12, 0x4c, 0x01, 0x03, 0x4c, 0x02, 0x03, 0x4c, 0x18,
+    0x03, 0x4c, 0x2e, 0x03, 0x4c, 0x43, 0x03, 0x3f, 0x4c, 0x03, 0x2a, 0x4c, 0x03, 0x14, 0x4c, 0x01,
+    0x03, 0x4c, 0x16, 0x03, 0x4c, 0x2b, 0x03, 0x4c, 0x41, 0x03, 0x4c, 0x4c, 0x03, 0x42, 0x4c, 0x09,
+    0x2c, 0xe1, 0x03, 0xe1, 0x03, 0xf0, 0x01, 0xf8, 0x03, 0x3d, 0xae, 0x00, 0x06, 0x01, 0xc4, 0xff,
+    0x4c, 0x07, 0x03, 0x4c, 0x1c, 0x03, 0x4c, 0x32, 0x03, 0x4c, 0x47, 0x03, 0xc7, 0xff, 0x03, 0x26,
+    0x4c, 0x03, 0x10, 0x4c, 0x01, 0x03, 0x4c, 0x04, 0x03, 0x4c, 0x1a, 0x03, 0x4c, 0x2f, 0x03, 0x4c,
+    0x45, 0x03, 0x3e, 0x4c, 0x03, 0x28, 0x4c, 0x04, 0x13, 0x4c, 0x02, 0x03, 0x4c, 0x18, 0x03, 0x4c,
+    0x2d, 0x03, 0x4c, 0x42, 0x03, 0x4c, 0x4c, 0x03, 0x40, 0x4c, 0x09, 0x2b, 0xd7, 0x03, 0xd7, 0x03,
+    0xeb, 0x01, 0xf5, 0x03, 0x44, 0x17, 0x00, 0x06, 0x01, 0xc5, 0xff, 0x4c, 0x08, 0x03, 0x4c, 0x1e,
+    0x03, 0x4c, 0x33, 0x03, 0x4c, 0x49, 0x03, 0x39, 0x4c, 0x03, 0x79, 0xff, 0x03, 0x0e, 0x4c, 0x01,
+    0x03, 0x4c, 0x06, 0x03, 0x4c, 0x1c, 0x03, 0x4c, 0x31, 0x03, 0x4c, 0x47, 0x03, 0x3c, 0x4c, 0x03,
+    0x26, 0x4c, 0x04, 0x11, 0x4c, 0x04, 0x03, 0x4c, 0x19, 0x03, 0x4c, 0x2f, 0x03, 0x4c, 0x44, 0x03,
+    0x4c, 0x4c, 0x03, 0x3e, 0x4c, 0x09, 0x29, 0xcd, 0x03, 0xcd, 0x03, 0xe6, 0x01, 0xf3, 0x03, 0xb9,
+    0x32, 0x00, 0x06, 0x01, 0xc7, 0xff, 0x4c, 0x0c, 0x03, 0x4c, 0x22, 0x03, 0x4c, 0x37, 0x03, 0x4b,
+    0x4c, 0x03, 0x36, 0x4c, 0x03, 0x20, 0x4c, 0x03, 0x0b, 0x4c, 0x01, 0x03, 0xff, 0x21, 0x03, 0x4c,
+    0x1f, 0x03, 0x4c, 0x35, 0x03, 0x4c, 0x4a, 0x03, 0x38, 0x4c, 0x03, 0x23, 0x4c, 0x04, 0x0d, 0x4c,
+    0x07, 0x03, 0x4c, 0x1d, 0x03, 0x4c, 0x32, 0x03, 0x4c, 0x48, 0x03, 0x4c, 0x4c, 0x03, 0x3b, 0x4c,
+    0x09, 0x25, 0xba, 0x03, 0xba, 0x03, 0xdd, 0x01, 0xee, 0x03, 0x07, 0x5b, 0x00, 0x06, 0x01, 0xc8,
+    0xff, 0x4c, 0x0e, 0x03, 0x4c, 0x23, 0x03, 0x4c, 0x39, 0x03, 0x4a, 0x4c, 0x03, 0x34, 0x4c, 0x03,
+    0x1f, 0x4c, 0x03, 0x09, 0x4c, 0x01, 0x03, 0x4c, 0x0b, 0x03, 0xff, 0x6f, 0x03, 0x4c, 0x36, 0x03,
+    0x4c, 0x4c, 0x03, 0x36, 0x4c, 0x03, 0x21, 0x4c, 0x04, 0x0b, 0x4c, 0x09, 0x03, 0x4c, 0x1f, 0x03,
+    0x4c, 0x34, 0x03, 0x4c, 0x4a, 0x03, 0x4c, 0x4c, 0x03, 0x39, 0x4c, 0x09, 0x23, 0xb1, 0x03, 0xb1,
+    0x03, 0xd8, 0x01, 0xec, 0x03, 0x95, 0x34, 0x00, 0x06, 0x01, 0xc9, 0x01, 0x4c, 0x10, 0x03, 0x4c,
+    0x25, 0x03, 0x4c, 0x3b, 0x03, 0x48, 0x4c, 0x03, 0x32, 0x4c, 0x03, 0x1d, 0x4c, 0x03, 0x07, 0x4c,
+    0x01, 0x03, 0x4c, 0x0d, 0x03, 0x4c, 0x23, 0x03, 0xff, 0xbd, 0x03, 0x4a, 0x4c, 0x03, 0x35, 0x4c,
+    0x03, 0x1f, 0x4c, 0x04, 0x0a, 0x4c, 0x0b, 0x03, 0x4c, 0x20, 0x03, 0x4c, 0x36, 0x03, 0x4c, 0x4b,
+    0x03, 0x4c, 0x4c, 0x03, 0x37, 0x4c, 0x09, 0x22, 0xa7, 0x03, 0xa7, 0x03, 0xd3, 0x01, 0xe9, 0x03,
+    0xeb, 0x64, 0x00, 0x06, 0x01, 0xca, 0xff, 0x4c, 0x11, 0x03, 0x4c, 0x27, 0x03, 0x4c, 0x3c, 0x03,
+    0x46, 0x4c, 0x03, 0x31, 0x4c, 0x03, 0x1b, 0x4c, 0x03, 0x05, 0x4c, 0x01, 0x03, 0x4c, 0x0f, 0x03,
+    0x4c, 0x25, 0x03, 0x4c, 0x3a, 0x03, 0xf3, 0xff, 0x03, 0x33, 0x4c, 0x03, 0x1d, 0x4c, 0x04, 0x08,
+    0x4c, 0x0d, 0x03, 0x4d, 0x22, 0x03, 0x4c, 0x38, 0x03, 0x4c, 0x4c, 0x03, 0x4b, 0x4c, 0x03, 0x35,
+    0x4c, 0x09, 0x20, 0x9e, 0x03, 0x9e, 0x03, 0xcf, 0x01, 0xe7, 0x03, 0x66, 0xb1, 0x00, 0x06, 0x01,
+    0xcb, 0xff, 0x4c, 0x13, 0x03, 0x4c, 0x29, 0x03, 0x4c, 0x3e, 0x03, 0x44, 0x4c, 0x03, 0x2f, 0x4c,
+    0x03, 0x19, 0x4c, 0x03, 0x04, 0x4c, 0x01, 0x03, 0x4c, 0x11, 0x03, 0x4c, 0x26, 0x03, 0x4c, 0x3c,
+    0x03, 0x47, 0x4c, 0x03, 0xa5, 0xff, 0x03, 0x1c, 0x4c, 0x04, 0x06, 0x4c, 0x0e, 0x03, 0x4c, 0x24,
+    0x03, 0x4c, 0x39, 0x03, 0x4c, 0x4c, 0x03, 0x49, 0x4c, 0x03, 0x33, 0x4c, 0x09, 0x1e, 0x95, 0x03,
+    0x95, 0x03, 0xca, 0x01, 0xe5, 0x03, 0x08, 0x93, 0x00, 0x06, 0x01, 0xcc, 0xff, 0x4c, 0x15, 0x03,
+    0x4c, 0x2b, 0x03, 0x4c, 0x40, 0x03, 0x42, 0x4c, 0x03, 0x2d, 0x4c, 0x03, 0x17, 0x4c, 0x03, 0x02,
+    0x4c, 0x01, 0x03, 0x4c, 0x13, 0x03, 0x4c, 0x28, 0x03, 0x4c, 0x3e, 0x03, 0x45, 0x4c, 0x03, 0x2f,
+    0x4c, 0x03, 0x57, 0xff, 0x04, 0x04, 0x4c, 0x10, 0x03, 0x4c, 0x26, 0x03, 0x4c, 0x3b, 0x03, 0x4c,
+    0x4c, 0x03, 0x47, 0x4c, 0x03, 0x32, 0x4c, 0x09, 0x1c, 0x8c, 0x03, 0x8c, 0x03, 0xc6, 0x01, 0xe3,
+    0x03, 0x7e, 0x87, 0x00, 0x06, 0x01, 0xcd, 0xff, 0x4c, 0x17, 0x03, 0x4c, 0x2c, 0x03, 0x4c, 0x42,
+    0x03, 0x41, 0x4c, 0x03, 0x2b, 0x4c, 0x03, 0x16, 0x4c, 0x01, 0x02, 0x4c, 0x01, 0x03, 0x4c, 0x14,
+    0x03, 0x4c, 0x2a, 0x03, 0x4c, 0x3f, 0x03, 0x43, 0x4c, 0x03, 0x2e, 0x4c, 0x03, 0x18, 0x4c, 0x04,
+    0x09, 0xff, 0x12, 0x03, 0x4c, 0x28, 0x03, 0x4c, 0x3d, 0x03, 0x4c, 0x4c, 0x03, 0x45, 0x4c, 0x03,
+    0x30, 0x4c, 0x09, 0x1a, 0x83, 0x03, 0x83, 0x03, 0xc1, 0x01, 0xe0, 0x03, 0xd1, 0x38, 0x00, 0x06,
+    0x01, 0xce, 0xff, 0x4c, 0x19, 0x03, 0x4c, 0x2e, 0x03, 0x4c, 0x44, 0x03, 0x3f, 0x4c, 0x03, 0x29,
+    0x4c, 0x03, 0x14, 0x4c, 0x01, 0x03, 0x4c, 0x01, 0x03, 0x4c, 0x16, 0x03, 0x4c, 0x2c, 0x03, 0x4c,
+    0x41, 0x03, 0x41, 0x4c, 0x03, 0x2c, 0x4c, 0x03, 0x16, 0x4c, 0x04, 0x01, 0x4c, 0x43, 0x03, 0xff,
+    0x29, 0x03, 0x4c, 0x3f, 0x03, 0x4c, 0x4c, 0x03, 0x44, 0x4c, 0x03, 0x2e, 0x4c, 0x09, 0x19, 0x7a,
+    0x03, 0x7a, 0x03, 0xbd, 0x01, 0xde, 0x03, 0x72, 0xd0, 0x00, 0x06, 0x01, 0xcf, 0xff, 0x4c, 0x1a,
+    0x03, 0x4c, 0x30, 0x03, 0x4c, 0x45, 0x03, 0x3d, 0x4c, 0x03, 0x28, 0x4c, 0x03, 0x12, 0x4c, 0x01,
+    0x03, 0x4c, 0x02, 0x03, 0x4c, 0x18, 0x03, 0x4c, 0x2e, 0x03, 0x4c, 0x43, 0x03, 0x3f, 0x4c, 0x03,
+    0x2a, 0x4c, 0x03, 0x14, 0x4c, 0x01, 0x03, 0x4c, 0x16, 0x03, 0x4c, 0x91, 0x03, 0xff, 0x41, 0x03,
+    0x4c, 0x4c, 0x03, 0x42, 0x4c, 0x03, 0x2c, 0x4c, 0x09, 0x17, 0x71, 0x03, 0x71, 0x03, 0xb8, 0x01,
+    0xdc, 0x03, 0x6b, 0x66, 0x00, 0x06, 0x01, 0xd0, 0xff, 0x4c, 0x1c, 0x03, 0x4c, 0x32, 0x03, 0x4c,
+    0x47, 0x03, 0x3b, 0x4c, 0x03, 0x26, 0x4c, 0x03, 0x10, 0x4c, 0x01, 0x03, 0x4c, 0x04, 0x03, 0x4c,
+    0x1a, 0x03, 0x4c, 0x2f, 0x03, 0x4c, 0x45, 0x03, 0x3e, 0x4c, 0x03, 0x28, 0x4c, 0x04, 0x13, 0x4c,
+    0x02, 0x03, 0x4c, 0x17, 0x03, 0x4c, 0x2d, 0x03, 0x4c, 0xdf, 0x03, 0xff, 0x4c, 0x03, 0x40, 0x4c,
+    0x03, 0x2b, 0x4c, 0x09, 0x15, 0x69, 0x03, 0x69, 0x03, 0xb4, 0x01, 0xda, 0x03, 0x6f, 0xfc, 0x00,
+    0x06, 0x01, 0xd1, 0xff, 0x4c, 0x1e, 0x03, 0x4c, 0x33, 0x03, 0x4c, 0x49, 0x03, 0x39, 0x4c, 0x03,
+    0x24, 0x4c, 0x03, 0x0e, 0x4c, 0x01, 0x03, 0x4c, 0x06, 0x03, 0x4c, 0x1c, 0x03, 0x4c, 0x31, 0x03,
+    0x4c, 0x47, 0x03, 0x3c, 0x4c, 0x03, 0x26, 0x4c, 0x04, 0x11, 0x4c, 0x04, 0x03, 0x4c, 0x19, 0x03,
+    0x4c, 0x2f, 0x03, 0x4c, 0x44, 0x03, 0x4c, 0xff, 0x03, 0xd1, 0x4c, 0x03, 0x29, 0x4c, 0x09, 0x13,
+    0x60, 0x03, 0x60, 0x03, 0xb0, 0x01, 0xd8, 0x03, 0xef, 0xfd, 0x00, 0x06, 0x01, 0xd2, 0xff, 0x4c,
+    0x20, 0x03, 0x4c, 0x35, 0x03, 0x4c, 0x4b, 0x03, 0x38, 0x4c, 0x03, 0x22, 0x4c, 0x03, 0x0d, 0x4c,
+    0x01, 0x03, 0x4c, 0x08, 0x03, 0x4c, 0x1d, 0x03, 0x4c, 0x33, 0x03, 0x4c, 0x48, 0x03, 0x3a, 0x4c,
+    0x04, 0x25, 0x4c, 0x04, 0x0f, 0x4c, 0x05, 0x03, 0x4c, 0x1b, 0x03, 0x4c, 0x31, 0x03, 0x4c, 0x46,
+    0x03, 0x4c, 0x4c, 0x03, 0x3c, 0xff, 0x03, 0x83, 0x4c, 0x09, 0x11, 0x58, 0x03, 0x58, 0x03, 0xac,
+    0x01, 0xd6, 0x03, 0xf7, 0x92, 0x00, 0x06, 0x01, 0xd3, 0xff, 0x4c, 0x22, 0x03, 0x4c, 0x37, 0x03,
+    0x4b, 0x4c, 0x03, 0x36, 0x4c, 0x03, 0x20, 0x4c, 0x03, 0x0b, 0x4c, 0x01, 0x03, 0x4c, 0x0a, 0x03,
+    0x4c, 0x1f, 0x03, 0x4c, 0x35, 0x03, 0x4c, 0x4a, 0x03, 0x38, 0x4c, 0x03, 0x23, 0x4c, 0x04, 0x0d,
+    0x4c, 0x07, 0x03, 0x4c, 0x1d, 0x03, 0x4c, 0x32, 0x03, 0x4c, 0x48, 0x03, 0x4c, 0x4c, 0x03, 0x3b,
+    0x4c, 0x03, 0x25, 0xff, 0x09, 0x35, 0x4f, 0x03, 0x4f, 0x03, 0xa7, 0x01, 0xd3, 0x03, 0xac, 0x3f,
+    0x00, 0x06, 0x01, 0xd4, 0xff, 0xff, 0x77, 0x03, 0x4c, 0x39, 0x03, 0x4a, 0x4c, 0x03, 0x34, 0x4c,
+    0x03, 0x1f, 0x4c, 0x03, 0x09, 0x4c, 0x01, 0x03, 0x4c, 0x0b, 0x03, 0x4c, 0x21, 0x03, 0x4c, 0x36,
+    0x03, 0x4c, 0x4c, 0x03, 0x36, 0x4c, 0x03, 0x21, 0x4c, 0x04, 0x0b, 0x4c, 0x09, 0x03, 0x4c, 0x1f,
+    0x03, 0x4c, 0x34, 0x03, 0x4c, 0x4a, 0x03, 0x4c, 0x4c, 0x03, 0x39, 0x4c, 0x03, 0x23, 0x4c, 0x09,
+    0x0e, 0x47, 0x03, 0x47, 0x03, 0xa3, 0x01, 0xd1, 0x03, 0xbf, 0x5e, 0x00, 0x06, 0x01, 0xd5, 0xff,
+    0x4c, 0x25, 0x03, 0xff, 0xc5, 0x03, 0x48, 0x4c, 0x03, 0x32, 0x4c, 0x03, 0x1d, 0x4c, 0x03, 0x07,
+    0x4c, 0x01, 0x03, 0x4c, 0x0d, 0x03, 0x4c, 0x23, 0x03, 0x4c, 0x38, 0x03, 0x4a, 0x4c, 0x03, 0x35,
+    0x4c, 0x03, 0x1f, 0x4c, 0x04, 0x0a, 0x4c, 0x0b, 0x03, 0x4c, 0x20, 0x03, 0x4c, 0x36, 0x03, 0x4c,
+    0x4b, 0x03, 0x4c, 0x4c, 0x03, 0x37, 0x4c, 0x03, 0x22, 0x4c, 0x09, 0x0c, 0x3f, 0x03, 0x3f, 0x03,
+    0x9f, 0x01, 0xcf, 0x03, 0xe6, 0x3a, 0x00, 0x06, 0x01, 0xd6, 0xff, 0x4c, 0x27, 0x03, 0x4c, 0x3c,
+    0x03, 0xeb, 0xff, 0x03, 0x31, 0x4c, 0x03, 0x1b, 0x4c, 0x03, 0x05, 0x4c, 0x01, 0x03, 0x4c, 0x0f,
+    0x03, 0x4c, 0x25, 0x03, 0x4c, 0x3a, 0x03, 0x48, 0x4c, 0x03, 0x33, 0x4c, 0x03, 0x1d, 0x4c, 0x04,
+    0x08, 0x4c, 0x0d, 0x03, 0x4c, 0x22, 0x03, 0x4c, 0x38, 0x03, 0x4c, 0x4c, 0x03, 0x4b, 0x4c, 0x03,
+    0x35, 0x4c, 0x03, 0x20, 0x4c, 0x09, 0x0a, 0x37, 0x03, 0x37, 0x03, 0x9b, 0x01, 0xcd, 0x03, 0x52,
+    0x1c, 0x00, 0x06, 0x01, 0xd7, 0xff, 0x4c, 0x29, 0x03, 0x4c, 0x3e, 0x03, 0x44, 0x4c, 0x03, 0x9d,
+    0xff, 0x03, 0x19, 0x4c, 0x03, 0x04, 0x4c, 0x01, 0x03, 0x4c, 0x11, 0x03, 0x4c, 0x26, 0x03, 0x4c,
+    0x3c, 0x03, 0x47, 0x4c, 0x03, 0x31, 0x4c, 0x03, 0x1c, 0x4c, 0x04, 0x06, 0x4c, 0x0e, 0x03, 0x4c,
+    0x24, 0x03, 0x4c, 0x39, 0x03, 0x4c, 0x4c, 0x03, 0x49, 0x4c, 0x03, 0x33, 0x4c, 0x03, 0x1e, 0x4c,
+    0x09, 0x08, 0x2f, 0x03, 0x2f, 0x03, 0x97, 0x01, 0xcb, 0x03, 0x25, 0x92, 0x00, 0x06, 0x01, 0xd8,
+    0xff, 0x4c, 0x2b, 0x03, 0x4c, 0x40, 0x03, 0x42, 0x4c, 0x03, 0x2d, 0x4c, 0x03, 0x4f, 0xff, 0x03,
+    0x02, 0x4c, 0x01, 0x03, 0x4c, 0x13, 0x03, 0x4c, 0x28, 0x03, 0x4c, 0x3e, 0x03, 0x45, 0x4c, 0x03,
+    0x2f, 0x4c, 0x03, 0x1a, 0x4c, 0x04, 0x04, 0x4c, 0x10, 0x03, 0x4c, 0x26, 0x03, 0x4c, 0x3b, 0x03,
+    0x4c, 0x4c, 0x03, 0x47, 0x4c, 0x03, 0x32, 0x4c, 0x03, 0x1c, 0x4c, 0x09, 0x07, 0x27, 0x03, 0x27,
+    0x03, 0x93, 0x01, 0xc9, 0x03, 0xba, 0xe5, 0x00, 0x06, 0x01, 0xd9, 0xff, 0x4c, 0x2c, 0x03, 0x4c,
+    0x42, 0x03, 0x41, 0x4c, 0x03, 0x2b, 0x4c, 0x03, 0x16, 0x4c, 0x03, 0x01, 0xff, 0x01, 0x03, 0x4c,
+    0x14, 0x03, 0x4c, 0x2a, 0x03, 0x4c, 0x3f, 0x03, 0x43, 0x4c, 0x03, 0x2e, 0x4c, 0x03, 0x18, 0x4c,
+    0x04, 0x02, 0x4c, 0x12, 0x03, 0x4c, 0x28, 0x03, 0x4c, 0x3d, 0x03, 0x4c, 0x4c, 0x03, 0x45, 0x4c,
+    0x03, 0x30, 0x4c, 0x03, 0x1a, 0x4c, 0x09, 0x05, 0x1f, 0x03, 0x1f, 0x03, 0x8f, 0x01, 0xc7, 0x03,
+    0x1b, 0x5d, 0x00, 0x06, 0x01, 0xdb, 0xff, 0x4c, 0x30, 0x03, 0x4c, 0x45, 0x03, 0x3d, 0x4c, 0x03,
+    0x28, 0x4c, 0x03, 0x12, 0x4c, 0x01, 0x03, 0x4c, 0x02, 0x03, 0x4c, 0x18, 0x03, 0xff, 0x99, 0x03,
+    0x4c, 0x43, 0x03, 0x3f, 0x4c, 0x03, 0x2a, 0x4c, 0x03, 0x14, 0x4c, 0x01, 0x03, 0x4c, 0x16, 0x03,
+    0x4c, 0x2b, 0x03, 0x4c, 0x41, 0x03, 0x4c, 0x4c, 0x03, 0x42, 0x4c, 0x03, 0x2c, 0x4c, 0x03, 0x17,
+    0x4c, 0x09, 0x01, 0x10, 0x03, 0x10, 0x03, 0x88, 0x01, 0xc4, 0x03, 0x08, 0x8a, 0x00, 0x06, 0x01,
+    0xdc, 0xff, 0x4c, 0x32, 0x03, 0x4c, 0x47, 0x03, 0x3b, 0x4c, 0x03, 0x26, 0x4c, 0x03, 0x10, 0x4c,
+    0x01, 0x03, 0x4c, 0x04, 0x03, 0x4c, 0x1a, 0x03, 0x4c, 0x2f, 0x03, 0xff, 0xe7, 0x03, 0x3e, 0x4c,
+    0x03, 0x28, 0x4c, 0x04, 0x13, 0x4c, 0x02, 0x03, 0x4c, 0x17, 0x03, 0x4c, 0x2d, 0x03, 0x4c, 0x42,
+    0x03, 0x4c, 0x4c, 0x03, 0x40, 0x4c, 0x03, 0x2b, 0x4c, 0x03, 0x15, 0x4c, 0x01, 0x08, 0x09, 0x03,
+    0x09, 0x03, 0x84, 0x01, 0xc2, 0x03, 0x2d, 0x3d, 0x00, 0x06, 0x01, 0xdd, 0xff, 0x4c, 0x33, 0x03,
+    0x4c, 0x49, 0x03, 0x39, 0x4c, 0x03, 0x24, 0x4c, 0x03, 0x0e, 0x4c, 0x01, 0x03, 0x4c, 0x06, 0x03,
+    0x4c, 0x1c, 0x03, 0x4c, 0x31, 0x03, 0x4c, 0x47, 0x03, 0xc9, 0xff, 0x03, 0x26, 0x4c, 0x04, 0x11,
+    0x4c, 0x04, 0x03, 0x4c, 0x19, 0x03, 0x4c, 0x2f, 0x03, 0x4c, 0x44, 0x03, 0x4c, 0x4c, 0x03, 0x3e,
+    0x4c, 0x03, 0x29, 0x4c, 0x04, 0x13, 0x4c, 0x01, 0x08, 0x01, 0x03, 0x01, 0x03, 0x80, 0x01, 0xc0,
+    0x03, 0xce, 0xb6, 0x00, 0x06, 0x01, 0xde, 0xff, 0x4c, 0x35, 0x03, 0x4c, 0x4b, 0x03, 0x38, 0x4c,
+    0x03, 0x22, 0x4c, 0x03, 0x0d, 0x4c, 0x01, 0x03, 0x4c, 0x08, 0x03, 0x4c, 0x1d, 0x03, 0x4c, 0x33,
+    0x03, 0x4c, 0x48, 0x03, 0x3a, 0x4c, 0x03, 0x7b, 0xff, 0x04, 0x0f, 0x4c, 0x05, 0x03, 0x4c, 0x1b,
+    0x03, 0x4c, 0x31, 0x03, 0x4c, 0x46, 0x03, 0x4c, 0x4c, 0x03, 0x3c, 0x4c, 0x03, 0x27, 0x4c, 0x04,
+    0x11, 0x4c, 0x03, 0x08, 0xfa, 0x02, 0xfa, 0x02, 0x7d, 0x01, 0xbe, 0x03, 0x87, 0xd4, 0x00, 0x06,
+    0x01, 0xdf, 0xff, 0x4c, 0x37, 0x03, 0x4b, 0x4c, 0x03, 0x36, 0x4c, 0x03, 0x20, 0x4c, 0x03, 0x0b,
+    0x4c, 0x01, 0x03, 0x4c, 0x0a, 0x03, 0x4c, 0x1f, 0x03, 0x4c, 0x35, 0x03, 0x4c, 0x4a, 0x03, 0x38,
+    0x4c, 0x03, 0x23, 0x4c, 0x04, 0x2d, 0xff, 0x07, 0x03, 0x4c, 0x1d, 0x03, 0x4c, 0x32, 0x03, 0x4c,
+    0x48, 0x03, 0x4c, 0x4c, 0x03, 0x3b, 0x4c, 0x03, 0x25, 0x4c, 0x04, 0x10, 0x4c, 0x05, 0x08, 0xf3,
+    0x02, 0xf3, 0x02, 0x79, 0x01, 0xbc, 0x03, 0xfd, 0xfe, 0x00, 0x06, 0x01, 0xe0, 0xff, 0x4c, 0x39,
+    0x03, 0x4a, 0x4c, 0x03, 0x34, 0x4c, 0x03, 0x1f, 0x4c, 0x03, 0x09, 0x4c, 0x01, 0x03, 0x4c, 0x0b,
+    0x03, 0x4c, 0x21, 0x03, 0x4c, 0x36, 0x03, 0x4c, 0x4c, 0x03, 0x36, 0x4c, 0x03, 0x21, 0x4c, 0x04,
+    0x0b, 0x4c, 0x1f, 0x03, 0xff, 0x1f, 0x03, 0x4c, 0x34, 0x03, 0x4c, 0x4a, 0x03, 0x4c, 0x4c, 0x03,
+    0x39, 0x4c, 0x03, 0x23, 0x4c, 0x04, 0x0e, 0x4c, 0x07, 0x08, 0xec, 0x02, 0xec, 0x02, 0x76, 0x01,
+    0xbb, 0x03, 0x54, 0x4c, 0x00, 0x06, 0x01, 0xe1, 0xff, 0x4c, 0x3b, 0x03, 0x48, 0x4c, 0x03, 0x32,
+    0x4c, 0x03, 0x1d, 0x4c, 0x03, 0x07, 0x4c, 0x01, 0x03, 0x4c, 0x0d, 0x03, 0x4c, 0x23, 0x03, 0x4c,
+    0x38, 0x03, 0x4a, 0x4c, 0x03, 0x35, 0x4c, 0x03, 0x1f, 0x4c, 0x04, 0x0a, 0x4c, 0x0b, 0x03, 0x4c,
+    0x6d, 0x03, 0xff, 0x36, 0x03, 0x4c, 0x4b, 0x03, 0x4c, 0x4c, 0x03, 0x37, 0x4c, 0x03, 0x22, 0x4c,
+    0x04, 0x0c, 0x4c, 0x08, 0x08, 0xe5, 0x02, 0xe5, 0x02, 0x72, 0x01, 0xb9, 0x03, 0x05, 0x18, 0x00,
+    0x06, 0x01, 0xe4, 0xff, 0x4c, 0x40, 0x03, 0x42, 0x4c, 0x03, 0x2d, 0x4c, 0x03, 0x17, 0x4c, 0x03,
+    0x02, 0x4c, 0x01, 0x03, 0x4c, 0x13, 0x03, 0x4c, 0x28, 0x03, 0x4c, 0x3e, 0x03, 0x45, 0x4c, 0x03,
+    0x2f, 0x4c, 0x03, 0x1a, 0x4c, 0x04, 0x04, 0x4c, 0x10, 0x03, 0x4c, 0x26, 0x03, 0x4c, 0x3b, 0x03,
+    0x4c, 0x4c, 0x03, 0x47, 0xff, 0x03, 0xa7, 0x4c, 0x03, 0x1c, 0x4c, 0x04, 0x07, 0x4c, 0x0e, 0x08,
+    0xd1, 0x02, 0xd1, 0x02, 0x68, 0x01, 0xb4, 0x03, 0x58, 0x33, 0x00, 0x06, 0x01, 0xe5, 0xff, 0x4c,
+    0x42, 0x03, 0x41, 0x4c, 0x03, 0x2b, 0x4c, 0x03, 0x16, 0x4c, 0x01, 0x02, 0x4c, 0x01, 0x03, 0x4c,
+    0x14, 0x03, 0x4c, 0x2a, 0x03, 0x4c, 0x3f, 0x03, 0x43, 0x4c, 0x03, 0x2e, 0x4c, 0x03, 0x18, 0x4c,
+    0x04, 0x02, 0x4c, 0x12, 0x03, 0x4c, 0x28, 0x03, 0x4c, 0x3d, 0x03, 0x4c, 0x4c, 0x03, 0x45, 0x4c,
+    0x03, 0x30, 0xff, 0x03, 0x59, 0x4c, 0x04, 0x05, 0x4c, 0x10, 0x08, 0xcb, 0x02, 0xcb, 0x02, 0x65,
+    0x01, 0xb2, 0x03, 0xc6, 0x25, 0x00, 0x06, 0x01, 0xe6, 0xff, 0x4c, 0x44, 0x03, 0x3f, 0x4c, 0x03,
+    0x29, 0x4c, 0x03, 0x14, 0x4c, 0x01, 0x03, 0x4c, 0x01, 0x03, 0x4c, 0x16, 0x03, 0x4c, 0x2c, 0x03,
+    0x4c, 0x41, 0x03, 0x41, 0x4c, 0x03, 0x2c, 0x4c, 0x03, 0x16, 0x4c, 0x04, 0x01, 0x4c, 0x14, 0x03,
+    0x4c, 0x29, 0x03, 0x4c, 0x3f, 0x03, 0x4c, 0x4c, 0x03, 0x44, 0x4c, 0x03, 0x2e, 0x4c, 0x03, 0x19,
+    0xff, 0x04, 0x0b, 0x4c, 0x11, 0x08, 0xc4, 0x02, 0xc4, 0x02, 0x62, 0x01, 0xb1, 0x03, 0xcd, 0xc5,
+    0x00, 0x06, 0x01, 0xe7, 0xff, 0x4c, 0x45, 0x03, 0x3d, 0x4c, 0x03, 0x28, 0x4c, 0x03, 0x12, 0x4c,
+    0x01, 0x03, 0x4c, 0x02, 0x03, 0x4c, 0x18, 0x03, 0x4c, 0x2e, 0x03, 0x4c, 0x43, 0x03, 0x3f, 0x4c,
+    0x03, 0x2a, 0x4c, 0x03, 0x14, 0x4c, 0x01, 0x03, 0x4c, 0x16, 0x03, 0x4c, 0x2b, 0x03, 0x4c, 0x41,
+    0x03, 0x4c, 0x4c, 0x03, 0x42, 0x4c, 0x03, 0x2c, 0x4c, 0x03, 0x17, 0x4c, 0x04, 0x01, 0xff, 0x41,
+    0x08, 0xbe, 0x02, 0xbe, 0x02, 0x5f, 0x01, 0xaf, 0x03, 0x0a, 0x29, 0x00, 0x06, 0x01, 0xe8, 0xff,
+    0xff, 0xef, 0x03, 0x3b, 0x4c, 0x03, 0x26, 0x4c, 0x03, 0x10, 0x4c, 0x01, 0x03, 0x4c, 0x04, 0x03,
+    0x4c, 0x1a, 0x03, 0x4c, 0x2f, 0x03, 0x4c, 0x45, 0x03, 0x3e, 0x4c, 0x03, 0x28, 0x4c, 0x04, 0x13,
+    0x4c, 0x02, 0x03, 0x4c, 0x17, 0x03, 0x4c, 0x2d, 0x03, 0x4c, 0x42, 0x03, 0x4c, 0x4c, 0x03, 0x40,
+    0x4c, 0x03, 0x2b, 0x4c, 0x03, 0x15, 0x4c, 0x01, 0x03, 0x4c, 0x15, 0x08, 0xb8, 0x02, 0xb8, 0x02,
+    0x5c, 0x01, 0xae, 0x03, 0xc9, 0x36, 0x00, 0x06, 0x01, 0xe9, 0xff, 0x4c, 0x49, 0x03, 0xc1, 0xff,
+    0x03, 0x24, 0x4c, 0x03, 0x0e, 0x4c, 0x01, 0x03, 0x4c, 0x06, 0x03, 0x4c, 0x1c, 0x03, 0x4c, 0x31,
+    0x03, 0x4c, 0x47, 0x03, 0x3c, 0x4c, 0x03, 0x26, 0x4c, 0x04, 0x11, 0x4c, 0x04, 0x03, 0x4c, 0x19,
+    0x03, 0x4c, 0x2f, 0x03, 0x4c, 0x44, 0x03, 0x4c, 0x4c, 0x03, 0x3e, 0x4c, 0x03, 0x29, 0x4c, 0x04,
+    0x13, 0x4c, 0x01, 0x03, 0x4c, 0x17, 0x08, 0xb2, 0x02, 0xb2, 0x02, 0x59, 0x01, 0xac, 0x03, 0x6b,
+    0x14, 0x00, 0x06, 0x01, 0xea, 0xff, 0x4c, 0x4b, 0x03, 0x38, 0x4c, 0x03, 0x73, 0xff, 0x03, 0x0d,
+    0x4c, 0x01, 0x03, 0x4c, 0x08, 0x03, 0x4c, 0x1d, 0x03, 0x4c, 0x33, 0x03, 0x4c, 0x48, 0x03, 0x3a,
+    0x4c, 0x03, 0x25, 0x4c, 0x04, 0x0f, 0x4c, 0x05, 0x03, 0x4c, 0x1b, 0x03, 0x4c, 0x31, 0x03, 0x4c,
+    0x46, 0x03, 0x4c, 0x4c, 0x03, 0x3c, 0x4c, 0x03, 0x27, 0x4c, 0x04, 0x11, 0x4c, 0x03, 0x03, 0x4c,
+    0x19, 0x08, 0xac, 0x02, 0xac, 0x02, 0x56, 0x01, 0xab, 0x03, 0x8f, 0x2b, 0x00, 0x06, 0x01, 0xeb,
+    0xff, 0x4b, 0x4c, 0x03, 0x36, 0x4c, 0x03, 0x20, 0x4c, 0x03, 0x25, 0xff, 0x01, 0x03, 0x4c, 0x0a,
+    0x03, 0x4c, 0x1f, 0x03, 0x4c, 0x35, 0x03, 0x4c, 0x4a, 0x03, 0x38, 0x4c, 0x03, 0x23, 0x4c, 0x04,
+    0x0d, 0x4c, 0x07, 0x03, 0x4c, 0x1d, 0x03, 0x4c, 0x32, 0x03, 0x4c, 0x48, 0x03, 0x4c, 0x4c, 0x03,
+    0x3b, 0x4c, 0x03, 0x25, 0x4c, 0x04, 0x10, 0x4c, 0x05, 0x03, 0x4c, 0x1a, 0x08, 0xa6, 0x02, 0xa6,
+    0x02, 0x53, 0x01, 0xa9, 0x03, 0x3b, 0xef, 0x00, 0x06, 0x01, 0xec, 0xff, 0x4a, 0x4c, 0x03, 0x34,
+    0x4c, 0x03, 0x1f, 0x4c, 0x03, 0x09, 0x4c, 0x01, 0x03, 0xff, 0x27, 0x03, 0x4c, 0x21, 0x03, 0x4c,
+    0x36, 0x03, 0x4c, 0x4c, 0x03, 0x36, 0x4c, 0x03, 0x21, 0x4c, 0x04, 0x0b, 0x4c, 0x09, 0x03, 0x4c,
+    0x1f, 0x03, 0x4c, 0x34, 0x03, 0x4c, 0x4a, 0x03, 0x4c, 0x4c, 0x03, 0x39, 0x4c, 0x03, 0x23, 0x4c,
+    0x04, 0x0e, 0x4c, 0x07, 0x03, 0x4c, 0x1c, 0x08, 0xa0, 0x02, 0xa0, 0x02, 0x50, 0x01, 0xa8, 0x03,
+    0x50, 0x4c, 0x00, 0x06, 0x01, 0xee, 0xff, 0x46, 0x4c, 0x03, 0x31, 0x4c, 0x03, 0x1b, 0x4c, 0x03,
+    0x05, 0x4c, 0x01, 0x03, 0x4c, 0x0f, 0x03, 0x4c, 0x25, 0x03, 0xff, 0xc3, 0x03, 0x48, 0x4c, 0x03,
+    0x33, 0x4c, 0x03, 0x1d, 0x4c, 0x04, 0x08, 0x4c, 0x0d, 0x03, 0x4c, 0x22, 0x03, 0x4c, 0x38, 0x03,
+    0x4c, 0x4c, 0x03, 0x4b, 0x4c, 0x03, 0x35, 0x4c, 0x03, 0x20, 0x4c, 0x04, 0x0a, 0x4c, 0x0a, 0x03,
+    0x4c, 0x20, 0x08, 0x95, 0x02, 0x95, 0x02, 0x4a, 0x01, 0xa5, 0x03, 0x02, 0x32, 0x00, 0x06, 0x01,
+    0xef, 0xff, 0x44, 0x4c, 0x03, 0x2f, 0x4c, 0x03, 0x19, 0x4c, 0x03, 0x04, 0x4c, 0x01, 0x03, 0x4c,
+    0x11, 0x03, 0x4c, 0x26, 0x03, 0x4c, 0x3c, 0x03, 0xed, 0xff, 0x03, 0x31, 0x4c, 0x03, 0x1c, 0x4c,
+    0x04, 0x06, 0x4c, 0x0e, 0x03, 0x4c, 0x24, 0x03, 0x4c, 0x39, 0x03, 0x4c, 0x4c, 0x03, 0x49, 0x4c,
+    0x03, 0x33, 0x4c, 0x03, 0x1e, 0x4c, 0x04, 0x08, 0x4c, 0x0c, 0x03, 0x4c, 0x22, 0x08, 0x8f, 0x02,
+    0x8f, 0x02, 0x47, 0x01, 0xa3, 0x03, 0xc8, 0xf0, 0x00, 0x06, 0x01, 0xf0, 0xff, 0x42, 0x4c, 0x03,
+    0x2d, 0x4c, 0x03, 0x17, 0x4c, 0x03, 0x02, 0x4c, 0x01, 0x03, 0x4c, 0x13, 0x03, 0x4c, 0x28, 0x03,
+    0x4c, 0x3e, 0x03, 0x45, 0x4c, 0x03, 0x9f, 0xff, 0x03, 0x1a, 0x4c, 0x04, 0x04, 0x4c, 0x10, 0x03,
+    0x4c, 0x26, 0x03, 0x4c, 0x3b, 0x03, 0x4c, 0x4c, 0x03, 0x47, 0x4c, 0x03, 0x32, 0x4c, 0x03, 0x1c,
+    0x4c, 0x04, 0x07, 0x4c, 0x0e, 0x03, 0x4c, 0x23, 0x08, 0x8a, 0x02, 0x8a, 0x02, 0x45, 0x01, 0xa2,
+    0x03, 0xc9, 0xcb, 0x00, 0x06, 0x01, 0xf1, 0xff, 0x41, 0x4c, 0x03, 0x2b, 0x4c, 0x03, 0x16, 0x4c,
+    0x01, 0x02, 0x4c, 0x01, 0x03, 0x4c, 0x14, 0x03, 0x4c, 0x2a, 0x03, 0x4c, 0x3f, 0x03, 0x43, 0x4c,
+    0x03, 0x2e, 0x4c, 0x03, 0x51, 0xff, 0x04, 0x02, 0x4c, 0x12, 0x03, 0x4c, 0x28, 0x03, 0x4c, 0x3d,
+    0x03, 0x4c, 0x4c, 0x03, 0x45, 0x4c, 0x03, 0x30, 0x4c, 0x03, 0x1a, 0x4c, 0x04, 0x05, 0x4c, 0x10,
+    0x03, 0x4c, 0x25, 0x08, 0x85, 0x02, 0x85, 0x02, 0x42, 0x01, 0xa1, 0x03, 0x4c, 0x11, 0x00, 0x06,
+    0x01, 0xf2, 0xff, 0x3f, 0x4c, 0x03, 0x29, 0x4c, 0x03, 0x14, 0x4c, 0x01, 0x03, 0x4c, 0x01, 0x03,
+    0x4c, 0x16, 0x03, 0x4c, 0x2c, 0x03, 0x4c, 0x41, 0x03, 0x41, 0x4c, 0x03, 0x2c, 0x4c, 0x03, 0x16,
+    0x4c, 0x04, 0x03, 0xff, 0x14, 0x03, 0x4c, 0x29, 0x03, 0x4c, 0x3f, 0x03, 0x4c, 0x4c, 0x03, 0x44,
+    0x4c, 0x03, 0x2e, 0x4c, 0x03, 0x19, 0x4c, 0x04, 0x03, 0x4c, 0x11, 0x03, 0x4c, 0x27, 0x08, 0x7f,
+    0x02, 0x7f, 0x02, 0x3f, 0x01, 0x9f, 0x03, 0x22, 0x48, 0x00, 0x06, 0x01, 0xf3, 0xff, 0x3d, 0x4c,
+    0x03, 0x28, 0x4c, 0x03, 0x12, 0x4c, 0x01, 0x03, 0x4c, 0x02, 0x03, 0x4c, 0x18, 0x03, 0x4c, 0x2e,
+    0x03, 0x4c, 0x43, 0x03, 0x3f, 0x4c, 0x03, 0x2a, 0x4c, 0x03, 0x14, 0x4c, 0x01, 0x03, 0x4c, 0x49,
+    0x03, 0xff, 0x2b, 0x03, 0x4c, 0x41, 0x03, 0x4c, 0x4c, 0x03, 0x42, 0x4c, 0x03, 0x2c, 0x4c, 0x03,
+    0x17, 0x4c, 0x04, 0x01, 0x4c, 0x13, 0x03, 0x4c, 0x29, 0x08, 0x7a, 0x02, 0x7a, 0x02, 0x3d, 0x01,
+    0x9e, 0x03, 0xd3, 0x52, 0x00, 0x06, 0x01, 0xf4, 0xff, 0x3b, 0x4c, 0x03, 0x26, 0x4c, 0x03, 0x10,
+    0x4c, 0x01, 0x03, 0x4c, 0x04, 0x03, 0x4c, 0x1a, 0x03, 0x4c, 0x2f, 0x03, 0x4c, 0x45, 0x03, 0x3e,
+    0x4c, 0x03, 0x28, 0x4c, 0x04, 0x13, 0x4c, 0x02, 0x03, 0x4c, 0x17, 0x03, 0x4c, 0x97, 0x03, 0xff,
+    0x42, 0x03, 0x4c, 0x4c, 0x03, 0x40, 0x4c, 0x03, 0x2b, 0x4c, 0x03, 0x15, 0x4c, 0x01, 0x03, 0x4c,
+    0x15, 0x03, 0x4c, 0x2b, 0x08, 0x75, 0x02, 0x75, 0x02, 0x3a, 0x01, 0x9d, 0x03, 0x6b, 0xac, 0x00,
+    0x06, 0x01, 0xf5, 0xff, 0x39, 0x4c, 0x03, 0x24, 0x4c, 0x03, 0x0e, 0x4c, 0x01, 0x03, 0x4c, 0x06,
+    0x03, 0x4c, 0x1c, 0x03, 0x4c, 0x31, 0x03, 0x4c, 0x47, 0x03, 0x3c, 0x4c, 0x03, 0x26, 0x4c, 0x04,
+    0x11, 0x4c, 0x04, 0x03, 0x4c, 0x19, 0x03, 0x4c, 0x2f, 0x03, 0x4c, 0xe5, 0x03, 0xff, 0x4c, 0x03,
+    0x3e, 0x4c, 0x03, 0x29, 0x4c, 0x04, 0x13, 0x4c, 0x01, 0x03, 0x4c, 0x17, 0x03, 0x4c, 0x2c, 0x08,
+    0x70, 0x02, 0x70, 0x02, 0x38, 0x01, 0x9c, 0x03, 0x72, 0xa2, 0x00, 0x06, 0x01, 0xf6, 0xff, 0x38,
+    0x4c, 0x03, 0x22, 0x4c, 0x03, 0x0d, 0x4c, 0x01, 0x03, 0x4c, 0x08, 0x03, 0x4c, 0x1d, 0x03, 0x4c,
+    0x33, 0x03, 0x4c, 0x48, 0x03, 0x3a, 0x4c, 0x03, 0x25, 0x4c, 0x04, 0x0f, 0x4c, 0x05, 0x03, 0x4c,
+    0x1b, 0x03, 0x4c, 0x31, 0x03, 0x4c, 0x46, 0x03, 0x4c, 0xff, 0x03, 0xcb, 0x4c, 0x03, 0x27, 0x4c,
+    0x04, 0x11, 0x4c, 0x03, 0x03, 0x4c, 0x19, 0x03, 0x4c, 0x2e, 0x08, 0x6c, 0x02, 0x6c, 0x02, 0x36,
+    0x01, 0x9b, 0x03, 0xc3, 0xa3, 0x00, 0x06, 0x01, 0xf7, 0xff, 0x36, 0x4c, 0x03, 0x20, 0x4c, 0x03,
+    0x0b, 0x4c, 0x01, 0x03, 0x4c, 0x0a, 0x03, 0x4c, 0x1f, 0x03, 0x4c, 0x35, 0x03, 0x4c, 0x4a, 0x03,
+    0x38, 0x4c, 0x03, 0x23, 0x4c, 0x04, 0x0d, 0x4c, 0x07, 0x03, 0x4c, 0x1d, 0x03, 0x4c, 0x32, 0x03,
+    0x4c, 0x48, 0x03, 0x4c, 0x4c, 0x03, 0x3b, 0xff, 0x03, 0x7d, 0x4c, 0x04, 0x10, 0x4c, 0x05, 0x03,
+    0x4c, 0x1a, 0x03, 0x4c, 0x30, 0x08, 0x67, 0x02, 0x67, 0x02, 0x33, 0x01, 0x99, 0x03, 0x9f, 0x05,
+    0x00, 0x06, 0x01, 0xf9, 0xff, 0x32, 0x4c, 0x03, 0x1d, 0x4c, 0x03, 0x07, 0x4c, 0x01, 0x03, 0x4c,
+    0x0d, 0x03, 0x4c, 0x23, 0x03, 0x4c, 0x38, 0x03, 0x4a, 0x4c, 0x03, 0x35, 0x4c, 0x03, 0x1f, 0x4c,
+    0x04, 0x0a, 0x4c, 0x0b, 0x03, 0x4c, 0x20, 0x03, 0x4c, 0x36, 0x03, 0x4c, 0x4b, 0x03, 0x4c, 0x4c,
+    0x03, 0x37, 0x4c, 0x03, 0x22, 0x4c, 0x04, 0x0c, 0xff, 0x1d, 0x03, 0x4c, 0x1e, 0x03, 0x4c, 0x33,
+    0x08, 0x5e, 0x02, 0x5e, 0x02, 0x2f, 0x01, 0x97, 0x03, 0x70, 0xcc, 0x00, 0x06, 0x01, 0xfa, 0xff,
+    0x31, 0x4c, 0x03, 0x1b, 0x4c, 0x03, 0x05, 0x4c, 0x01, 0x03, 0x4c, 0x0f, 0x03, 0x4c, 0x25, 0x03,
+    0x4c, 0x3a, 0x03, 0x48, 0x4c, 0x03, 0x33, 0x4c, 0x03, 0x1d, 0x4c, 0x04, 0x08, 0x4c, 0x0d, 0x03,
+    0x4c, 0x22, 0x03, 0x4c, 0x38, 0x03, 0x4c, 0x4c, 0x03, 0x4b, 0x4c, 0x03, 0x35, 0x4c, 0x03, 0x20,
+    0x4c, 0x04, 0x0a, 0x4c, 0x0a, 0x03, 0xff, 0x6b, 0x03, 0x4c, 0x35, 0x08, 0x5a, 0x02, 0x5a, 0x02,
+    0x2d, 0x01, 0x96, 0x03, 0x42, 0x3c, 0x00, 0x06, 0x01, 0xfb, 0xff, 0x2f, 0x4c, 0x03, 0x19, 0x4c,
+    0x03, 0x04, 0x4c, 0x01, 0x03, 0x4c, 0x11, 0x03, 0x4c, 0x26, 0x03, 0x4c, 0x3c, 0x03, 0x47, 0x4c,
+    0x03, 0x31, 0x4c, 0x03, 0x1c, 0x4c, 0x04, 0x06, 0x4c, 0x0e, 0x03, 0x4c, 0x24, 0x03, 0x4c, 0x39,
+    0x03, 0x4c, 0x4c, 0x03, 0x49, 0x4c, 0x03, 0x33, 0x4c, 0x03, 0x1e, 0x4c, 0x04, 0x08, 0x4c, 0x0c,
+    0x03, 0x4c, 0x22, 0x03, 0xff, 0xb9, 0x08, 0x55, 0x02, 0x55, 0x02, 0x2a, 0x01, 0x95, 0x03, 0xa8,
+    0xde, 0x00, 0x06, 0x01, 0xfc, 0xff, 0x97, 0xff, 0x03, 0x17, 0x4c, 0x03, 0x02, 0x4c, 0x01, 0x03,
+    0x4c, 0x13, 0x03, 0x4c, 0x28, 0x03, 0x4c, 0x3e, 0x03, 0x45, 0x4c, 0x03, 0x2f, 0x4c, 0x03, 0x1a,
+    0x4c, 0x04, 0x04, 0x4c, 0x10, 0x03, 0x4c, 0x26, 0x03, 0x4c, 0x3b, 0x03, 0x4c, 0x4c, 0x03, 0x47,
+    0x4c, 0x03, 0x32, 0x4c, 0x03, 0x1c, 0x4c, 0x04, 0x07, 0x4c, 0x0e, 0x03, 0x4c, 0x23, 0x03, 0x4c,
+    0x39, 0x08, 0x51, 0x02, 0x51, 0x02, 0x28, 0x01, 0x94, 0x03, 0x26, 0x19, 0x00, 0x06, 0x01, 0xfd,
+    0xff, 0x2b, 0x4c, 0x03, 0x49, 0xff, 0x01, 0x02, 0x4c, 0x01, 0x03, 0x4c, 0x14, 0x03, 0x4c, 0x2a,
+    0x03, 0x4c, 0x3f, 0x03, 0x43, 0x4c, 0x03, 0x2e, 0x4c, 0x03, 0x18, 0x4c, 0x04, 0x02, 0x4c, 0x12,
+    0x03, 0x4c, 0x28, 0x03, 0x4c, 0x3d, 0x03, 0x4c, 0x4c, 0x03, 0x45, 0x4c, 0x03, 0x30, 0x4c, 0x03,
+    0x1a, 0x4c, 0x04, 0x05, 0x4c, 0x10, 0x03, 0x4c, 0x25, 0x03, 0x4c, 0x3b, 0x08, 0x4d, 0x02, 0x4d,
+    0x02, 0x26, 0x01, 0x93, 0x03, 0x64, 0xf6, 0x00, 0x06, 0x02, 0xfe, 0xff, 0x29, 0x4c, 0x03, 0x14,
+    0x4c, 0x01, 0x03, 0xff, 0x03, 0x03, 0x4c, 0x16, 0x03, 0x4c, 0x2c, 0x03, 0x4c, 0x41, 0x03, 0x41,
+    0x4c, 0x03, 0x2c, 0x4c, 0x03, 0x16, 0x4c, 0x04, 0x01, 0x4c, 0x14, 0x03, 0x4c, 0x29, 0x03, 0x4c,
+    0x3f, 0x03, 0x4c, 0x4c, 0x03, 0x44, 0x4c, 0x03, 0x2e, 0x4c, 0x03, 0x19, 0x4c, 0x04, 0x03, 0x4c,
+    0x11, 0x03, 0x4c, 0x27, 0x03, 0x4c, 0x3c, 0x08, 0x49, 0x02, 0x49, 0x02, 0x24, 0x01, 0x92, 0x03,
+    0xa6, 0x9d, 0x00, 0x06, 0x01, 0xff, 0xff, 0x28, 0x4c, 0x03, 0x12, 0x4c, 0x01, 0x03, 0x4c, 0x02,
+    0x03, 0xff, 0x51, 0x03, 0x4c, 0x2e, 0x03, 0x4c, 0x43, 0x03, 0x3f, 0x4c, 0x03, 0x2a, 0x4c, 0x03,
+    0x14, 0x4c, 0x01, 0x03, 0x4c, 0x16, 0x03, 0x4c, 0x2b, 0x03, 0x4c, 0x41, 0x03, 0x4c, 0x4c, 0x03,
+    0x42, 0x4c, 0x03, 0x2c, 0x4c, 0x03, 0x17, 0x4c, 0x04, 0x01, 0x4c, 0x13, 0x03, 0x4c, 0x29, 0x03,
+    0x4c, 0x3e, 0x08, 0x45, 0x02, 0x45, 0x02, 0x22, 0x01, 0x91, 0x03, 0xf3, 0x17, 0x00, 0x02, 0x01,
+    0x01, 0x03, 0x26, 0x4c, 0x03, 0x10, 0x4c, 0x01, 0x03, 0x4c, 0x04, 0x03, 0x4c, 0x1a, 0x03, 0xff,
+    0x9f, 0x03, 0x4c, 0x45, 0x03, 0x3e, 0x4c, 0x03, 0x28, 0x4c, 0x04, 0x13, 0x4c, 0x02, 0x03, 0x4c,
+    0x17, 0x03, 0x4c, 0x2d, 0x03, 0x4c, 0x42, 0x03, 0x4c, 0x4c, 0x03, 0x40, 0x4c, 0x03, 0x2b, 0x4c,
+    0x03, 0x15, 0x4c, 0x01, 0x03, 0x4c, 0x15, 0x03, 0x4c, 0x2b, 0x03, 0x4c, 0x40, 0x08, 0x42, 0x02,
+    0x42, 0x02, 0x21, 0x01, 0x90, 0x03, 0xd3, 0xf6, 0x00, 0x03, 0x01, 0x01, 0x03, 0x24, 0x4c, 0x03,
+    0x0e, 0x4c, 0x01, 0x03, 0x4c, 0x06, 0x03, 0x4c, 0x1c, 0x03, 0x4c, 0x31, 0x03, 0xff, 0xed, 0x03,
+    0x3c, 0x4c, 0x03, 0x26, 0x4c, 0x04, 0x11, 0x4c, 0x04, 0x03, 0x4c, 0x19, 0x03, 0x4c, 0x2f, 0x03,
+    0x4c, 0x44, 0x03, 0x4c, 0x4c, 0x03, 0x3e, 0x4c, 0x03, 0x29, 0x4c, 0x04, 0x13, 0x4c, 0x01, 0x03,
+    0x4c, 0x17, 0x03, 0x4c, 0x2c, 0x03, 0x4c, 0x42, 0x08, 0x3e, 0x02, 0x3e, 0x02, 0x1f, 0x01, 0x8f,
+    0x03, 0x61, 0x92, 0x00, 0x03, 0x01, 0x02, 0x03, 0x22, 0x4c, 0x03, 0x0d, 0x4c, 0x01, 0x03, 0x4c,
+    0x08, 0x03, 0x4c, 0x1d, 0x03, 0x4c, 0x33, 0x03, 0x4c, 0x48, 0x03, 0xc3, 0xff, 0x03, 0x25, 0x4c,
+    0x04, 0x0f, 0x4c, 0x05, 0x03, 0x4c, 0x1b, 0x03, 0x4c, 0x31, 0x03, 0x4c, 0x46, 0x03, 0x4c, 0x4c,
+    0x03, 0x3c, 0x4c, 0x03, 0x27, 0x4c, 0x04, 0x11, 0x4c, 0x03, 0x03, 0x4c, 0x19, 0x03, 0x4c, 0x2e,
+    0x03, 0x4c, 0x44, 0x08, 0x3b, 0x02, 0x3b, 0x02, 0x1d, 0x01, 0x8e, 0x03, 0xd1, 0x7d, 0x00, 0x03,
+    0x01, 0x03, 0x03, 0x20, 0x4c, 0x03, 0x0b, 0x4c, 0x01, 0x03, 0x4c, 0x0a, 0x03, 0x4c, 0x1f, 0x03,
+    0x4c, 0x35, 0x03, 0x4c, 0x4a, 0x03, 0x38, 0x4c, 0x03, 0x75, 0xff, 0x04, 0x0d, 0x4c, 0x07, 0x03,
+    0x4c, 0x1d, 0x03, 0x4c, 0x32, 0x03, 0x4c, 0x48, 0x03, 0x4c, 0x4c, 0x03, 0x3b, 0x4c, 0x03, 0x25,
+    0x4c, 0x04, 0x10, 0x4c, 0x05, 0x03, 0x4c, 0x1a, 0x03, 0x4c, 0x30, 0x03, 0x4c, 0x45, 0x08, 0x37,
+    0x02, 0x37, 0x02, 0x1b, 0x01, 0x8d, 0x03, 0x09, 0x94, 0x00, 0x03, 0x01, 0x04, 0x03, 0x1f, 0x4c,
+    0x03, 0x09, 0x4c, 0x01, 0x03, 0x4c, 0x0b, 0x03, 0x4c, 0x21, 0x03, 0x4c, 0x36, 0x03, 0x4c, 0x4c,
+    0x03, 0x36, 0x4c, 0x03, 0x21, 0x4c, 0x04, 0x27, 0xff, 0x09, 0x03, 0x4c, 0x1f, 0x03, 0x4c, 0x34,
+    0x03, 0x4c, 0x4a, 0x03, 0x4c, 0x4c, 0x03, 0x39, 0x4c, 0x03, 0x23, 0x4c, 0x04, 0x0e, 0x4c, 0x07,
+    0x03, 0x4c, 0x1c, 0x03, 0x4c, 0x32, 0x03, 0x4c, 0x47, 0x08, 0x34, 0x02, 0x34, 0x02, 0x1a, 0x01,
+    0x8d, 0x03, 0x67, 0x45, 0x00, 0x03, 0x01, 0x05, 0x03, 0x1d, 0x4c, 0x03, 0x07, 0x4c, 0x01, 0x03,
+    0x4c, 0x0d, 0x03, 0x4c, 0x23, 0x03, 0x4c, 0x38, 0x03, 0x4a, 0x4c, 0x03, 0x35, 0x4c, 0x03, 0x1f,
+    0x4c, 0x04, 0x0a, 0x4c, 0x25, 0x03, 0xff, 0x20, 0x03, 0x4c, 0x36, 0x03, 0x4c, 0x4b, 0x03, 0x4c,
+    0x4c, 0x03, 0x37, 0x4c, 0x03, 0x22, 0x4c, 0x04, 0x0c, 0x4c, 0x08, 0x03, 0x4c, 0x1e, 0x03, 0x4c,
+    0x33, 0x03, 0x4c, 0x49, 0x08, 0x31, 0x02, 0x31, 0x02, 0x18, 0x01, 0x8c, 0x03, 0x4c, 0xb2, 0x00,
+    0x03, 0x01, 0x06, 0x03, 0x1b, 0x4c, 0x03, 0x05, 0x4c, 0x01, 0x03, 0x4c, 0x0f, 0x03, 0x4c, 0x25,
+    0x03, 0x4c, 0x3a, 0x03, 0x48, 0x4c, 0x03, 0x33, 0x4c, 0x03, 0x1d, 0x4c, 0x04, 0x08, 0x4c, 0x0d,
+    0x03, 0x4c, 0x73, 0x03, 0xff, 0x38, 0x03, 0x4c, 0x4c, 0x03, 0x4b, 0x4c, 0x03, 0x35, 0x4c, 0x03,
+    0x20, 0x4c, 0x04, 0x0a, 0x4c, 0x0a, 0x03, 0x4c, 0x20, 0x03, 0x4c, 0x35, 0x03, 0x4c, 0x4b, 0x08,
+    0x2d, 0x02, 0x2d, 0x02, 0x16, 0x01, 0x8b, 0x03, 0x18, 0xbc, 0x00, 0x03, 0x01, 0x07, 0x03, 0x19,
+    0x4c, 0x03, 0x04, 0x4c, 0x01, 0x03, 0x4c, 0x11, 0x03, 0x4c, 0x26, 0x03, 0x4c, 0x3c, 0x03, 0x47,
+    0x4c, 0x03, 0x31, 0x4c, 0x03, 0x1c, 0x4c, 0x04, 0x06, 0x4c, 0x0e, 0x03, 0x4c, 0x24, 0x03, 0x4c,
+    0xc1, 0x03, 0xff, 0x4c, 0x03, 0x49, 0x4c, 0x03, 0x33, 0x4c, 0x03, 0x1e, 0x4c, 0x04, 0x08, 0x4c,
+    0x0c, 0x03, 0x4c, 0x22, 0x03, 0x4c, 0x37, 0x03, 0x4b, 0x4c, 0x08, 0x2a, 0x02, 0x2a, 0x02, 0x15,
+    0x01, 0x8a, 0x03, 0x69, 0xaa, 0x00, 0x03, 0x01, 0x08, 0x03, 0x17, 0x4c, 0x03, 0x02, 0x4c, 0x01,
+    0x03, 0x4c, 0x13, 0x03, 0x4c, 0x28, 0x03, 0x4c, 0x3e, 0x03, 0x45, 0x4c, 0x03, 0x2f, 0x4c, 0x03,
+    0x1a, 0x4c, 0x04, 0x04, 0x4c, 0x10, 0x03, 0x4c, 0x26, 0x03, 0x4c, 0x3b, 0x03, 0x4c, 0xff, 0x03,
+    0xef, 0x4c, 0x03, 0x32, 0x4c, 0x03, 0x1c, 0x4c, 0x04, 0x07, 0x4c, 0x0e, 0x03, 0x4c, 0x23, 0x03,
+    0x4c, 0x39, 0x03, 0x4a, 0x4c, 0x08, 0x28, 0x02, 0x28, 0x02, 0x14, 0x01, 0x8a, 0x03, 0x0f, 0x63,
+    0x00, 0x03, 0x01, 0x09, 0x03, 0x16, 0x4c, 0x01, 0x02, 0x4c, 0x01, 0x03, 0x4c, 0x14, 0x03, 0x4c,
+    0x2a, 0x03, 0x4c, 0x3f, 0x03, 0x43, 0x4c, 0x03, 0x2e, 0x4c, 0x03, 0x18, 0x4c, 0x04, 0x02, 0x4c,
+    0x12, 0x03, 0x4c, 0x28, 0x03, 0x4c, 0x3d, 0x03, 0x4c, 0x4c, 0x03, 0x45, 0xff, 0x03, 0xa1, 0x4c,
+    0x03, 0x1a, 0x4c, 0x04, 0x05, 0x4c, 0x10, 0x03, 0x4c, 0x25, 0x03, 0x4c, 0x3b, 0x03, 0x48, 0x4c,
+    0x08, 0x25, 0x02, 0x25, 0x02, 0x12, 0x01, 0x89, 0x03, 0xeb, 0x4f, 0x00, 0x03, 0x01, 0x0a, 0x03,
+    0x14, 0x4c, 0x01, 0x03, 0x4c, 0x01, 0x03, 0x4c, 0x16, 0x03, 0x4c, 0x2c, 0x03, 0x4c, 0x41, 0x03,
+    0x41, 0x4c, 0x03, 0x2c, 0x4c, 0x03, 0x16, 0x4c, 0x04, 0x01, 0x4c, 0x14, 0x03, 0x4c, 0x29, 0x03,
+    0x4c, 0x3f, 0x03, 0x4c, 0x4c, 0x03, 0x44, 0x4c, 0x03, 0x2e, 0xff, 0x03, 0x53, 0x4c, 0x04, 0x03,
+    0x4c, 0x11, 0x03, 0x4c, 0x27, 0x03, 0x4c, 0x3c, 0x03, 0x46, 0x4c, 0x08, 0x22, 0x02, 0x22, 0x02,
+    0x11, 0x01, 0x88, 0x03, 0xe7, 0x16, 0x00, 0x03, 0x01, 0x0b, 0x03, 0x12, 0x4c, 0x01, 0x03, 0x4c,
+    0x02, 0x03, 0x4c, 0x18, 0x03, 0x4c, 0x2e, 0x03, 0x4c, 0x43, 0x03, 0x3f, 0x4c, 0x03, 0x2a, 0x4c,
+    0x03, 0x14, 0x4c, 0x01, 0x03, 0x4c, 0x16, 0x03, 0x4c, 0x2b, 0x03, 0x4c, 0x41, 0x03, 0x4c, 0x4c,
+    0x03, 0x42, 0x4c, 0x03, 0x2c, 0x4c, 0x03, 0x17, 0xff, 0x04, 0x05, 0x4c, 0x13, 0x03, 0x4c, 0x29,
+    0x03, 0x4c, 0x3e, 0x03, 0x44, 0x4c, 0x08, 0x1f, 0x02, 0x1f, 0x02, 0x0f, 0x01, 0x87, 0x03, 0x35,
+    0x39, 0x00, 0x03, 0x01, 0x0c, 0x03, 0x10, 0x4c, 0x01, 0x03, 0x4c, 0x04, 0x03, 0x4c, 0x1a, 0x03,
+    0x4c, 0x2f, 0x03, 0x4c, 0x45, 0x03, 0x3f, 0x4c, 0x03, 0x28, 0x4c, 0x04, 0x13, 0x4c, 0x02, 0x03,
+    0x4c, 0x17, 0x03, 0x4c, 0x2d, 0x03, 0x4c, 0x42, 0x03, 0x4c, 0x4c, 0x03, 0x40, 0x4c, 0x03, 0x2b,
+    0x4c, 0x03, 0x15, 0x4c, 0x01, 0x03, 0xff, 0x47, 0x03, 0x4c, 0x2b, 0x03, 0x4c, 0x40, 0x03, 0x42,
+    0x4c, 0x08, 0x1d, 0x02, 0x1d, 0x02, 0x0e, 0x01, 0x87, 0x03, 0xb0, 0xf3, 0x00, 0x03, 0x01, 0x0d,
+    0x03, 0x0e, 0x4c, 0x01, 0x03, 0x4c, 0x06, 0x03, 0x4c, 0x1c, 0x03, 0x4c, 0x31, 0x03, 0x4c, 0x47,
+    0x03, 0x3c, 0x4c, 0x03, 0x26, 0x4c, 0x04, 0x11, 0x4c, 0x04, 0x03, 0x4c, 0x19, 0x03, 0x4c, 0x2f,
+    0x03, 0x4c, 0x44, 0x03, 0x4c, 0x4c, 0x03, 0x3e, 0x4c, 0x03, 0x29, 0x4c, 0x04, 0x13, 0x4c, 0x01,
+    0x03, 0x4c, 0x17, 0x03, 0xff, 0x95, 0x03, 0x4c, 0x42, 0x03, 0x41, 0x4c, 0x08, 0x1a, 0x02, 0x1a,
+    0x02, 0x0d, 0x01, 0x86, 0x03, 0xa6, 0x68, 0x00, 0x03, 0x01, 0x0e, 0x03, 0x0d, 0x4c, 0x01, 0x03,
+    0x4c, 0x08, 0x03, 0x4c, 0x1d, 0x03, 0x4c, 0x33, 0x03, 0x4c, 0x48, 0x03, 0x3a, 0x4c, 0x03, 0x25,
+    0x4c, 0x04, 0x0f, 0x4c, 0x05, 0x03, 0x4c, 0x1b, 0x03, 0x4c, 0x31, 0x03, 0x4c, 0x46, 0x03, 0x4c,
+    0x4c, 0x03, 0x3c, 0x4c, 0x03, 0x27, 0x4c, 0x04, 0x11, 0x4c, 0x03, 0x03, 0x4c, 0x19, 0x03, 0x4c,
+    0x2e, 0x03, 0xff, 0xe3, 0x03, 0x3f, 0x4c, 0x08, 0x18, 0x02, 0x18, 0x02, 0x0c, 0x01, 0x86, 0x03,
+    0xac, 0x41, 0x00, 0x03, 0x01, 0x0f, 0x03, 0x0b, 0x4c, 0x01, 0x03, 0x4c, 0x0a, 0x03, 0x4c, 0x1f,
+    0x03, 0x4c, 0x35, 0x03, 0x4c, 0x4a, 0x03, 0x38, 0x4c, 0x03, 0x23, 0x4c, 0x04, 0x0d, 0x4c, 0x07,
+    0x03, 0x4c, 0x1d, 0x03, 0x4c, 0x32, 0x03, 0x4c, 0x48, 0x03, 0x4c, 0x4c, 0x03, 0x3b, 0x4c, 0x03,
+    0x25, 0x4c, 0x04, 0x10, 0x4c, 0x05, 0x03, 0x4c, 0x1a, 0x03, 0x4c, 0x30, 0x03, 0x4c, 0x45, 0x03,
+    0xcd, 0xff, 0x08, 0x16, 0x02, 0x16, 0x02, 0x0b, 0x01, 0x85, 0x03, 0x35, 0x3d, 0x00, 0x03, 0x01,
+    0x10, 0x03, 0x1f, 0xff, 0x01, 0x03, 0x4c, 0x0b, 0x03, 0x4c, 0x21, 0x03, 0x4c, 0x36, 0x03, 0x4c,
+    0x4c, 0x03, 0x36, 0x4c, 0x03, 0x21, 0x4c, 0x04, 0x0b, 0x4c, 0x09, 0x03, 0x4c, 0x1f, 0x03, 0x4c,
+    0x34, 0x03, 0x4c, 0x4a, 0x03, 0x4c, 0x4c, 0x03, 0x39, 0x4c, 0x03, 0x23, 0x4c, 0x04, 0x0e, 0x4c,
+    0x07, 0x03, 0x4c, 0x1c, 0x03, 0x4c, 0x32, 0x03, 0x4c, 0x47, 0x03, 0x3b, 0x4c, 0x08, 0x14, 0x02,
+    0x14, 0x02, 0x0a, 0x01, 0x85, 0x03, 0xe0, 0x1a, 0x00, 0x03, 0x01, 0x11, 0x03, 0x07, 0x4c, 0x01,
+    0x03, 0xff, 0x2d, 0x03, 0x4c, 0x23, 0x03, 0x4c, 0x38, 0x03, 0x4a, 0x4c, 0x03, 0x35, 0x4c, 0x03,
+    0x1f, 0x4c, 0x04, 0x0a, 0x4c, 0x0b, 0x03, 0x4c, 0x20, 0x03, 0x4c, 0x36, 0x03, 0x4c, 0x4b, 0x03,
+    0x4c, 0x4c, 0x03, 0x37, 0x4c, 0x03, 0x22, 0x4c, 0x04, 0x0c, 0x4c, 0x08, 0x03, 0x4c, 0x1e, 0x03,
+    0x4c, 0x33, 0x03, 0x4c, 0x49, 0x03, 0x39, 0x4c, 0x08, 0x12, 0x02, 0x12, 0x02, 0x09, 0x01, 0x84,
+    0x03, 0x9e, 0xc1, 0x00, 0x03, 0x01, 0x12, 0x03, 0x05, 0x4c, 0x01, 0x03, 0x4c, 0x0f, 0x03, 0xff,
+    0x7b, 0x03, 0x4c, 0x3a, 0x03, 0x48, 0x4c, 0x03, 0x33, 0x4c, 0x03, 0x1d, 0x4c, 0x04, 0x08, 0x4c,
+    0x0d, 0x03, 0x4c, 0x22, 0x03, 0x4c, 0x38, 0x03, 0x4c, 0x4c, 0x03, 0x4b, 0x4c, 0x03, 0x35, 0x4c,
+    0x03, 0x20, 0x4c, 0x04, 0x0a, 0x4c, 0x0a, 0x03, 0x4c, 0x20, 0x03, 0x4c, 0x35, 0x03, 0x4c, 0x4b,
+    0x03, 0x38, 0x4c, 0x08, 0x10, 0x02, 0x10, 0x02, 0x08, 0x01, 0x84, 0x03, 0x3e, 0x92, 0x00, 0x03,
+    0x01, 0x13, 0x03, 0x04, 0x4c, 0x01, 0x03, 0x4c, 0x11, 0x03, 0x4c, 0x26, 0x03, 0xff, 0xc9, 0x03,
+    0x47, 0x4c, 0x03, 0x31, 0x4c, 0x03, 0x1c, 0x4c, 0x04, 0x06, 0x4c, 0x0e, 0x03, 0x4c, 0x24, 0x03,
+    0x4c, 0x39, 0x03, 0x4c, 0x4c, 0x03, 0x49, 0x4c, 0x03, 0x33, 0x4c, 0x03, 0x1e, 0x4c, 0x04, 0x08,
+    0x4c, 0x0c, 0x03, 0x4c, 0x22, 0x03, 0x4c, 0x37, 0x03, 0x4b, 0x4c, 0x03, 0x36, 0x4c, 0x08, 0x0e,
+    0x02, 0x0e, 0x02, 0x07, 0x01, 0x83, 0x03, 0x6f, 0x44, 0x00, 0x03, 0x01, 0x14, 0x03, 0x02, 0x4c,
+    0x01, 0x03, 0x4c, 0x13, 0x03, 0x4c, 0x28, 0x03, 0x4c, 0x3e, 0x03, 0xe7, 0xff, 0x03, 0x2f, 0x4c,
+    0x03, 0x1a, 0x4c, 0x04, 0x04, 0x4c, 0x10, 0x03, 0x4c, 0x26, 0x03, 0x4c, 0x3b, 0x03, 0x4c, 0x4c,
+    0x03, 0x47, 0x4c, 0x03, 0x32, 0x4c, 0x03, 0x1c, 0x4c, 0x04, 0x07, 0x4c, 0x0e, 0x03, 0x4c, 0x23,
+    0x03, 0x4c, 0x39, 0x03, 0x4a, 0x4c, 0x03, 0x34, 0x4c, 0x08, 0x0c, 0x02, 0x0c, 0x02, 0x06, 0x01,
+    0x83, 0x03, 0xca, 0x65, 0x00, 0x03, 0x01, 0x16, 0x01, 0x03, 0x4c, 0x01, 0x03, 0x4c, 0x16, 0x03,
+    0x4c, 0x2c, 0x03, 0x4c, 0x41, 0x03, 0x41, 0x4c, 0x03, 0x2c, 0x4c, 0x03, 0x4b, 0xff, 0x04, 0x01,
+    0x4c, 0x14, 0x03, 0x4c, 0x29, 0x03, 0x4c, 0x3f, 0x03, 0x4c, 0x4c, 0x04, 0x44, 0x4c, 0x03, 0x2e,
+    0x4c, 0x03, 0x19, 0x4c, 0x04, 0x03, 0x4c, 0x11, 0x03, 0x4c, 0x27, 0x03, 0x4c, 0x3c, 0x03, 0x46,
+    0x4c, 0x03, 0x31, 0x4c, 0x08, 0x09, 0x02, 0x09, 0x02, 0x04, 0x01, 0x82, 0x03, 0xcc, 0x27, 0x00,
+    0x03, 0x01, 0x17, 0x01, 0x03, 0x4c, 0x02, 0x03, 0x4c, 0x18, 0x03, 0x4c, 0x2e, 0x03, 0x4c, 0x43,
+    0x03, 0x3f, 0x4c, 0x03, 0x2a, 0x4c, 0x04, 0x14, 0x4c, 0x01, 0x03, 0xff, 0x16, 0x03, 0x4c, 0x2b,
+    0x03, 0x4c, 0x41, 0x03, 0x4c, 0x4c, 0x03, 0x42, 0x4c, 0x03, 0x2c, 0x4c, 0x03, 0x17, 0x4c, 0x04,
+    0x01, 0x4c, 0x13, 0x03, 0x4c, 0x29, 0x03, 0x4c, 0x3e, 0x03, 0x44, 0x4c, 0x03, 0x2f, 0x4c, 0x08,
+    0x08, 0x02, 0x08, 0x02, 0x04, 0x01, 0x82, 0x03, 0xf4, 0xaf, 0x00, 0x03, 0x01, 0x18, 0x01, 0x04,
+    0x4c, 0x04, 0x03, 0x4c, 0x1a, 0x03, 0x4c, 0x2f, 0x03, 0x4c, 0x45, 0x03, 0x3e, 0x4c, 0x03, 0x28,
+    0x4c, 0x04, 0x13, 0x4c, 0x02, 0x03, 0x4c, 0x4f, 0x03, 0xff, 0x2d, 0x03, 0x4c, 0x42, 0x03, 0x4c,
+    0x4c, 0x03, 0x40, 0x4c, 0x03, 0x2b, 0x4c, 0x03, 0x15, 0x4c, 0x01, 0x03, 0x4c, 0x15, 0x03, 0x4c,
+    0x2b, 0x03, 0x4c, 0x40, 0x03, 0x42, 0x4c, 0x03, 0x2d, 0x4c, 0x08, 0x07, 0x02, 0x07, 0x02, 0x03,
+    0x01, 0x81, 0x03, 0x1c, 0x42, 0x00, 0x03, 0x01, 0x19, 0x01, 0x03, 0x4c, 0x06, 0x03, 0x4c, 0x1c,
+    0x03, 0x4c, 0x31, 0x03, 0x4c, 0x47, 0x03, 0x3c, 0x4c, 0x03, 0x26, 0x4c, 0x04, 0x11, 0x4c, 0x04,
+    0x03, 0x4c, 0x19, 0x03, 0x4c, 0x9d, 0x03, 0xff, 0x44, 0x03, 0x4c, 0x4c, 0x03, 0x3e, 0x4c, 0x03,
+    0x29, 0x4c, 0x04, 0x13, 0x4c, 0x01, 0x03, 0x4c, 0x17, 0x03, 0x4c, 0x2c, 0x03, 0x4c, 0x42, 0x03,
+    0x41, 0x4c, 0x03, 0x2b, 0x4c, 0x08, 0x06, 0x02, 0x06, 0x02, 0x03, 0x01, 0x81, 0x03, 0x43, 0xe4,
+    0x00, 0x03, 0x01, 0x1a, 0x01, 0x03, 0x4c, 0x08, 0x03, 0x4c, 0x1d, 0x03, 0x4c, 0x33, 0x03, 0x4c,
+    0x48, 0x03, 0x3a, 0x4c, 0x03, 0x25, 0x4c, 0x04, 0x0f, 0x4c, 0x05, 0x03, 0x4c, 0x1b, 0x03, 0x4c,
+    0x31, 0x03, 0x4c, 0xeb, 0x03, 0xff, 0x4c, 0x03, 0x3c, 0x4c, 0x03, 0x27, 0x4c, 0x04, 0x11, 0x4c,
+    0x03, 0x03, 0x4c, 0x19, 0x03, 0x4c, 0x2e, 0x03, 0x4c, 0x44, 0x03, 0x3f, 0x4c, 0x03, 0x29, 0x4c,
+    0x08, 0x04, 0x02, 0x04, 0x02, 0x02, 0x01, 0x81, 0x03, 0x72, 0x7d, 0x00, 0x03, 0x01, 0x1b, 0x01,
+    0x03, 0x4c, 0x0a, 0x03, 0x4c, 0x1f, 0x03, 0x4c, 0x35, 0x03, 0x4c, 0x4a, 0x03, 0x38, 0x4c, 0x03,
+    0x23, 0x4c, 0x04, 0x0d, 0x4c, 0x07, 0x03, 0x4c, 0x1d, 0x03, 0x4c, 0x32, 0x03, 0x4c, 0x48, 0x03,
+    0x4c, 0xff, 0x03, 0xc5, 0x4c, 0x03, 0x25, 0x4c, 0x04, 0x10, 0x4c, 0x05, 0x03, 0x4c, 0x1a, 0x03,
+    0x4c, 0x30, 0x03, 0x4c, 0x45, 0x03, 0x3d, 0x4c, 0x03, 0x28, 0x4c, 0x08, 0x04, 0x02, 0x04, 0x02,
+    0x02, 0x01, 0x81, 0x03, 0xf3, 0x4e, 0x00, 0x03, 0x01, 0x1c, 0x01, 0x03, 0x4c, 0x0b, 0x03, 0x4c,
+    0x21, 0x03, 0x4c, 0x36, 0x03, 0x4c, 0x4c, 0x03, 0x36, 0x4c, 0x03, 0x21, 0x4c, 0x04, 0x0b, 0x4c,
+    0x09, 0x03, 0x4c, 0x1f, 0x03, 0x4c, 0x34, 0x03, 0x4c, 0x4a, 0x03, 0x4c, 0x4c, 0x03, 0x39, 0xff,
+    0x03, 0x77, 0x4c, 0x04, 0x0e, 0x4c, 0x07, 0x03, 0x4c, 0x1c, 0x03, 0x4c, 0x32, 0x03, 0x4c, 0x47,
+    0x03, 0x3b, 0x4c, 0x03, 0x26, 0x4c, 0x08, 0x03, 0x02, 0x03, 0x02, 0x01, 0x01, 0x80, 0x03, 0x0e,
+    0x01, 0x00, 0x03, 0x01, 0x1e, 0x01, 0x03, 0x4c, 0x0f, 0x03, 0x4c, 0x25, 0x03, 0x4c, 0x3a, 0x03,
+    0x48, 0x4c, 0x03, 0x33, 0x4c, 0x03, 0x1d, 0x4c, 0x04, 0x08, 0x4c, 0x0d, 0x03, 0x4c, 0x22, 0x03,
+    0x4c, 0x38, 0x03, 0x4c, 0x4c, 0x03, 0x4b, 0x4c, 0x03, 0x35, 0x4c, 0x03, 0x20, 0x4c, 0x04, 0x0a,
+    0xff, 0x23, 0x03, 0x4c, 0x20, 0x03, 0x4c, 0x35, 0x03, 0x4c, 0x4b, 0x03, 0x38, 0x4c, 0x03, 0x22,
+    0x4c, 0x05, 0x01, 0x02, 0x01, 0x02, 0x03, 0x01, 0x80, 0x03, 0x75, 0x46, 0x00, 0x03, 0x01, 0x1f,
+    0x01, 0x03, 0x4c, 0x11, 0x03, 0x4c, 0x26, 0x03, 0x4c, 0x3c, 0x03, 0x47, 0x4c, 0x03, 0x31, 0x4c,
+    0x03, 0x1c, 0x4c, 0x04, 0x06, 0x4c, 0x0e, 0x03, 0x4c, 0x24, 0x03, 0x4c, 0x39, 0x03, 0x4c, 0x4c,
+    0x03, 0x49, 0x4c, 0x03, 0x33, 0x4c, 0x03, 0x1e, 0x4c, 0x04, 0x08, 0x4c, 0x0c, 0x03, 0xff, 0x71,
+    0x03, 0x4c, 0x37, 0x03, 0x4b, 0x4c, 0x03, 0x36, 0x4c, 0x03, 0x20, 0x4c, 0x05, 0x01, 0x02, 0x01,
+    0x02, 0x03, 0x01, 0x80, 0x03, 0x1e, 0xf1, 0x00, 0x03, 0x01, 0x20, 0x01, 0x03, 0x4c, 0x13, 0x03,
+    0x4c, 0x28, 0x03, 0x4c, 0x3e, 0x03, 0x45, 0x4c, 0x03, 0x2f, 0x4c, 0x03, 0x1a, 0x4c, 0x04, 0x04,
+    0x4c, 0x10, 0x03, 0x4c, 0x26, 0x03, 0x4c, 0x3b, 0x03, 0x4c, 0x4c, 0x03, 0x47, 0x4c, 0x03, 0x32,
+    0x4c, 0x03, 0x1c, 0x4c, 0x04, 0x07, 0x4c, 0x0e, 0x03, 0x4d, 0x23, 0x03, 0xff, 0xbf, 0x03, 0x4a,
+    0x4c, 0x03, 0x34, 0x4c, 0x03, 0x1f, 0x4c, 0x01, 0x02, 0x02, 0x02, 0x02, 0x03, 0x01, 0x80, 0x03,
+    0xa9, 0x2a, 0x00, 0x03, 0x01, 0x21, 0x01, 0x03, 0x4c, 0x14, 0x03, 0x4c, 0x2a, 0x03, 0x4c, 0x3f,
+    0x03, 0x43, 0x4c, 0x03, 0x2e, 0x4c, 0x03, 0x18, 0x4c, 0x04, 0x02, 0x4c, 0x12, 0x03, 0x4c, 0x28,
+    0x03, 0x4c, 0x3d, 0x03, 0x4c, 0x4c, 0x03, 0x45, 0x4c, 0x03, 0x30, 0x4c, 0x03, 0x1a, 0x4c, 0x04,
+    0x05, 0x4c, 0x10, 0x03, 0x4c, 0x25, 0x03, 0x4c, 0x3b, 0x03, 0xf1, 0xff, 0x03, 0x32, 0x4c, 0x03,
+    0x1d, 0x4c, 0x01, 0x02, 0x02, 0x02, 0x02, 0x03, 0x01, 0x80, 0x03, 0x95, 0x6e, 0x00, 0x03, 0x01,
+    0x22, 0x01, 0x03, 0x4c, 0x16, 0x03, 0x4c, 0x2c, 0x03, 0x4c, 0x41, 0x03, 0x41, 0x4c, 0x03, 0x2c,
+    0x4c, 0x03, 0x16, 0x4c, 0x04, 0x01, 0x4c, 0x14, 0x03, 0x4c, 0x29, 0x03, 0x4c, 0x3f, 0x03, 0x4c,
+    0x4c, 0x03, 0x44, 0x4c, 0x03, 0x2e, 0x4c, 0x03, 0x19, 0x4c, 0x04, 0x03, 0x4c, 0x11, 0x03, 0x4c,
+    0x27, 0x03, 0x4c, 0x3c, 0x03, 0x46, 0x4c, 0x03, 0xa3, 0xff, 0x03, 0x1b, 0x4c, 0x01, 0x02, 0x02,
+    0x02, 0x02, 0x03, 0x01, 0x80, 0x03, 0xd3, 0xae, 0x00, 0x03, 0x01, 0x23, 0x01, 0x03, 0x4c, 0x18,
+    0x03, 0x4c, 0x2e, 0x03, 0x4c, 0x43, 0x03, 0x3f, 0x4c, 0x03, 0x2a, 0x4c, 0x03, 0x14, 0x4c, 0x01,
+    0x03, 0x4c, 0x17, 0x03, 0x4c, 0x2b, 0x03, 0x4c, 0x41, 0x03, 0x4c, 0x4c, 0x03, 0x42, 0x4c, 0x03,
+    0x2c, 0x4c, 0x03, 0x17, 0x4c, 0x04, 0x01, 0x4c, 0x13, 0x03, 0x4c, 0x29, 0x03, 0x4c, 0x3e, 0x03,
+    0x44, 0x4c, 0x03, 0x2f, 0x4c, 0x03, 0x55, 0xff, 0x06, 0xff, 0x01, 0xff, 0x01, 0xff, 0x02, 0x7f,
+    0x03, 0xce, 0x9a, 0x00, 0x03, 0x01, 0x24, 0x01, 0x03, 0xff, 0x57, 0x03, 0x4c, 0x2f, 0x03, 0x4c,
+    0x45, 0x03, 0x3e, 0x4c, 0x03, 0x28, 0x4c, 0x04, 0x13, 0x4c, 0x02, 0x03, 0x4c, 0x17, 0x03, 0x4c,
+    0x2d, 0x03, 0x4c, 0x42, 0x03, 0x4c, 0x4c, 0x03, 0x40, 0x4c, 0x03, 0x2b, 0x4c, 0x03, 0x15, 0x4c,
+    0x01, 0x03, 0x4c, 0x15, 0x03, 0x4c, 0x2b, 0x03, 0x4c, 0x40, 0x03, 0x42, 0x4c, 0x03, 0x2d, 0x4c,
+    0x03, 0x17, 0x4c, 0x06, 0xff, 0x01, 0xff, 0x01, 0xff, 0x02, 0x7f, 0x03, 0x48, 0x4a, 0x00, 0x03,
+    0x01, 0x25, 0x01, 0x03, 0x4c, 0x1c, 0x03, 0xff, 0xa5, 0x03, 0x4c, 0x47, 0x03, 0x3c, 0x4c, 0x03,
+    0x26, 0x4c, 0x04, 0x11, 0x4c, 0x04, 0x03, 0x4c, 0x19, 0x03, 0x4c, 0x2f, 0x03, 0x4c, 0x44, 0x03,
+    0x4c, 0x4c, 0x03, 0x3e, 0x4c, 0x03, 0x29, 0x4c, 0x04, 0x13, 0x4c, 0x01, 0x03, 0x4c, 0x17, 0x03,
+    0x4c, 0x2c, 0x03, 0x4c, 0x42, 0x04, 0x41, 0x4c, 0x03, 0x2b, 0x4c, 0x03, 0x16, 0x4c, 0x06, 0xff,
+    0x01, 0xff, 0x01, 0xff, 0x02, 0x7f, 0x01, 0x02, 0xf4, 0x00, 0x03, 0x01, 0x26, 0x01, 0x03, 0x4c,
+    0x1d, 0x03, 0x4c, 0x33, 0x03, 0xff, 0xf3, 0x03, 0x3a, 0x4c, 0x03, 0x25, 0x4c, 0x04, 0x0f, 0x4c,
+    0x05, 0x03, 0x4c, 0x1b, 0x03, 0x4c, 0x31, 0x03, 0x4c, 0x46, 0x03, 0x4c, 0x4c, 0x03, 0x3c, 0x4c,
+    0x03, 0x27, 0x4c, 0x04, 0x11, 0x4c, 0x03, 0x03, 0x4c, 0x19, 0x03, 0x4c, 0x2e, 0x03, 0x4c, 0x44,
+    0x03, 0x3f, 0x4c, 0x03, 0x29, 0x4c, 0x03, 0x14, 0x4c, 0x01, 0x02, 0x02, 0x02, 0x02, 0x03, 0x01,
+    0x80, 0x03, 0xa1, 0x75, 0x00, 0x03, 0x01, 0x27, 0x01, 0x03, 0x4c, 0x1f, 0x03, 0x4c, 0x35, 0x03,
+    0x4c, 0x4a, 0x03, 0xbd, 0xff, 0x03, 0x23, 0x4c, 0x04, 0x0d, 0x4c, 0x07, 0x03, 0x4c, 0x1d, 0x03,
+    0x4c, 0x32, 0x03, 0x4c, 0x48, 0x03, 0x4c, 0x4c, 0x03, 0x3b, 0x4c, 0x03, 0x25, 0x4c, 0x04, 0x10,
+    0x4c, 0x05, 0x03, 0x4c, 0x1a, 0x03, 0x4c, 0x30, 0x03, 0x4c, 0x45, 0x03, 0x3d, 0x4c, 0x03, 0x28,
+    0x4c, 0x03, 0x12, 0x4c, 0x01, 0x02, 0x02, 0x02, 0x02, 0x03, 0x01, 0x80, 0x03, 0x3f, 0x63, 0x00,
+    0x03, 0x01, 0x28, 0x01, 0x03, 0x4c, 0x21, 0x03, 0x4c, 0x36, 0x03, 0x4c, 0x4c, 0x03, 0x36, 0x4c,
+    0x03, 0x6f, 0xff, 0x04, 0x0b, 0x4c, 0x09, 0x03, 0x4c, 0x1f, 0x03, 0x4c, 0x34, 0x03, 0x4c, 0x4a,
+    0x03, 0x4c, 0x4c, 0x03, 0x39, 0x4c, 0x03, 0x23, 0x4c, 0x04, 0x0e, 0x4c, 0x07, 0x03, 0x4c, 0x1c,
+    0x03, 0x4c, 0x32, 0x03, 0x4c, 0x47, 0x03, 0x3b, 0x4c, 0x03, 0x26, 0x4c, 0x03, 0x10, 0x4c, 0x01,
+    0x02, 0x02, 0x02, 0x02, 0x03, 0x01, 0x80, 0x03, 0x53, 0x97, 0x00, 0x03, 0x01, 0x29, 0x01, 0x03,
+    0x4c, 0x23, 0x03, 0x4c, 0x38, 0x03, 0x4a, 0x4c, 0x03, 0x35, 0x4c, 0x03, 0x1f, 0x4c, 0x04, 0x21,
+    0xff, 0x0b, 0x03, 0x4c, 0x20, 0x03, 0x4c, 0x36, 0x03, 0x4c, 0x4b, 0x03, 0x4c, 0x4c, 0x03, 0x37,
+    0x4c, 0x03, 0x22, 0x4c, 0x04, 0x0c, 0x4c, 0x08, 0x03, 0x4c, 0x1e, 0x03, 0x4c, 0x33, 0x03, 0x4c,
+    0x49, 0x03, 0x39, 0x4c, 0x03, 0x24, 0x4c, 0x03, 0x0e, 0x4c, 0x05, 0x01, 0x02, 0x01, 0x02, 0x03,
+    0x01, 0x80, 0x03, 0x03, 0x68, 0x00, 0x03, 0x01, 0x2a, 0x01, 0x03, 0x4c, 0x25, 0x03, 0x4c, 0x3a,
+    0x03, 0x48, 0x4c, 0x03, 0x33, 0x4c, 0x03, 0x1d, 0x4c, 0x04, 0x08, 0x4c, 0x2b, 0x03, 0xff, 0x22,
+    0x03, 0x4c, 0x38, 0x03, 0x4c, 0x4c, 0x03, 0x4b, 0x4c, 0x03, 0x35, 0x4c, 0x03, 0x20, 0x4c, 0x04,
+    0x0a, 0x4c, 0x0a, 0x03, 0x4c, 0x20, 0x03, 0x4c, 0x35, 0x03, 0x4c, 0x4b, 0x03, 0x38, 0x4c, 0x03,
+    0x22, 0x4c, 0x03, 0x0d, 0x4c, 0x05, 0x01, 0x02, 0x01, 0x02, 0x03, 0x01, 0x80, 0x03, 0x43, 0x3d,
+    0x00, 0x03, 0x01, 0x2b, 0x01, 0x03, 0x4c, 0x26, 0x03, 0x4c, 0x3c, 0x03, 0x47, 0x4c, 0x03, 0x31,
+    0x4c, 0x03, 0x1c, 0x4c, 0x04, 0x06, 0x4d, 0x0e, 0x03, 0x4c, 0x79, 0x03, 0xff, 0x39, 0x03, 0x4c,
+    0x4c, 0x03, 0x49, 0x4c, 0x03, 0x33, 0x4c, 0x03, 0x1e, 0x4c, 0x04, 0x08, 0x4c, 0x0c, 0x03, 0x4c,
+    0x22, 0x03, 0x4c, 0x37, 0x03, 0x4b, 0x4c, 0x03, 0x36, 0x4c, 0x03, 0x20, 0x4c, 0x03, 0x0b, 0x4c,
+    0x08, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x80, 0x03, 0x3b, 0x5c, 0x00, 0x03, 0x01, 0x2c, 0x01,
+    0x03, 0x4c, 0x28, 0x03, 0x4c, 0x3e, 0x03, 0x45, 0x4c, 0x03, 0x2f, 0x4c, 0x03, 0x1a, 0x4c, 0x04,
+    0x04, 0x4c, 0x10, 0x03, 0x4c, 0x26, 0x03, 0x4c, 0xc7, 0x03, 0xff, 0x4c, 0x03, 0x47, 0x4c, 0x03,
+    0x32, 0x4c, 0x03, 0x1c, 0x4c, 0x04, 0x07, 0x4c, 0x0e, 0x03, 0x4c, 0x23, 0x03, 0x4c, 0x39, 0x03,
+    0x4a, 0x4c, 0x03, 0x34, 0x4c, 0x03, 0x1f, 0x4c, 0x03, 0x09, 0x4c, 0x08, 0x03, 0x02, 0x03, 0x02,
+    0x01, 0x01, 0x80, 0x03, 0x3d, 0x49, 0x00, 0x03, 0x01, 0x2d, 0x01, 0x03, 0x4c, 0x2a, 0x03, 0x4c,
+    0x3f, 0x03, 0x43, 0x4c, 0x03, 0x2e, 0x4c, 0x03, 0x18, 0x4c, 0x04, 0x02, 0x4c, 0x12, 0x03, 0x4c,
+    0x28, 0x03, 0x4c, 0x3d, 0x03, 0x4c, 0xff, 0x03, 0xe9, 0x4c, 0x03, 0x30, 0x4c, 0x03, 0x1a, 0x4c,
+    0x04, 0x05, 0x4c, 0x10, 0x03, 0x4c, 0x25, 0x03, 0x4c, 0x3b, 0x03, 0x48, 0x4c, 0x03, 0x32, 0x4c,
+    0x03, 0x1d, 0x4c, 0x03, 0x07, 0x4c, 0x08, 0x04, 0x02, 0x04, 0x02, 0x02, 0x01, 0x81, 0x03, 0xd0,
+    0xeb, 0x00, 0x03, 0x01, 0x2e, 0x01, 0x03, 0x4c, 0x2c, 0x03, 0x4c, 0x41, 0x03, 0x41, 0x4c, 0x03,
+    0x2c, 0x4c, 0x03, 0x16, 0x4c, 0x04, 0x01, 0x4c, 0x14, 0x03, 0x4c, 0x29, 0x03, 0x4c, 0x3f, 0x03,
+    0x4c, 0x4c, 0x03, 0x44, 0xff, 0x03, 0x9b, 0x4c, 0x03, 0x19, 0x4c, 0x04, 0x03, 0x4c, 0x11, 0x03,
+    0x4c, 0x27, 0x03, 0x4c, 0x3c, 0x03, 0x46, 0x4c, 0x03, 0x31, 0x4c, 0x03, 0x1b, 0x4c, 0x03, 0x05,
+    0x4c, 0x08, 0x04, 0x02, 0x04, 0x02, 0x02, 0x01, 0x81, 0x03, 0xf4, 0x0a, 0x00, 0x03, 0x01, 0x2f,
+    0x01, 0x03, 0x4c, 0x2e, 0x03, 0x4c, 0x43, 0x03, 0x3f, 0x4c, 0x03, 0x2a, 0x4c, 0x03, 0x14, 0x4c,
+    0x01, 0x03, 0x4c, 0x16, 0x03, 0x4c, 0x2b, 0x03, 0x4c, 0x41, 0x03, 0x4d, 0x4c, 0x03, 0x42, 0x4c,
+    0x03, 0x2c, 0xff, 0x03, 0x4d, 0x4c, 0x04, 0x01, 0x4c, 0x13, 0x03, 0x4c, 0x29, 0x03, 0x4c, 0x3e,
+    0x03, 0x44, 0x4c, 0x03, 0x2f, 0x4c, 0x03, 0x19, 0x4c, 0x03, 0x04, 0x4c, 0x08, 0x06, 0x02, 0x06,
+    0x02, 0x03, 0x01, 0x81, 0x03, 0xa8, 0x21, 0x00, 0x03, 0x01, 0x30, 0x01, 0x03, 0x4c, 0x2f, 0x03,
+    0x4c, 0x45, 0x03, 0x3e, 0x4c, 0x03, 0x28, 0x4c, 0x04, 0x13, 0x4c, 0x02, 0x03, 0x4c, 0x17, 0x03,
+    0x4c, 0x2d, 0x03, 0x4c, 0x42, 0x03, 0x4c, 0x4c, 0x03, 0x40, 0x4c, 0x03, 0x2b, 0x4c, 0x03, 0x15,
+    0xff, 0x01, 0x03, 0x4c, 0x15, 0x03, 0x4c, 0x2b, 0x03, 0x4c, 0x40, 0x03, 0x42, 0x4c, 0x03, 0x2d,
+    0x4c, 0x03, 0x17, 0x4c, 0x03, 0x02, 0x4c, 0x08, 0x07, 0x02, 0x07, 0x02, 0x03, 0x01, 0x81, 0x03,
+    0x23, 0x3a, 0x00, 0x03, 0x01, 0x31, 0x01, 0x03, 0x4c, 0x31, 0x03, 0x4c, 0x47, 0x03, 0x3c, 0x4c,
+    0x03, 0x26, 0x4c, 0x04, 0x11, 0x4c, 0x04, 0x03, 0x4c, 0x19, 0x03, 0x4c, 0x2f, 0x03, 0x4c, 0x44,
+    0x03, 0x4c, 0x4c, 0x03, 0x3e, 0x4c, 0x03, 0x29, 0x4c, 0x04, 0x13, 0x4c, 0x01, 0x03, 0xff, 0x4d,
+    0x03, 0x4c, 0x2c, 0x03, 0x4c, 0x42, 0x03, 0x41, 0x4c, 0x03, 0x2b, 0x4c, 0x03, 0x16, 0x4c, 0x01,
+    0x02, 0x4c, 0x08, 0x08, 0x02, 0x08, 0x02, 0x04, 0x01, 0x82, 0x03, 0x1c, 0x8c, 0x00, 0x03, 0x01,
+    0x32, 0x01, 0x03, 0x4c, 0x33, 0x03, 0x4c, 0x48, 0x03, 0x3a, 0x4c, 0x03, 0x25, 0x4c, 0x04, 0x0f,
+    0x4c, 0x05, 0x03, 0x4c, 0x1b, 0x03, 0x4c, 0x31, 0x03, 0x4c, 0x46, 0x03, 0x4c, 0x4c, 0x03, 0x3c,
+    0x4c, 0x03, 0x27, 0x4c, 0x04, 0x11, 0x4c, 0x03, 0x03, 0x4c, 0x19, 0x03, 0xff, 0x9b, 0x03, 0x4c,
+    0x44, 0x03, 0x3f, 0x4c, 0x03, 0x29, 0x4c, 0x03, 0x14, 0x4c, 0x01, 0x0a, 0x4c, 0x01, 0x09, 0x02,
+    0x09, 0x02, 0x04, 0x01, 0x82, 0x03, 0xb5, 0x73, 0x00, 0x03, 0x01, 0x33, 0x01, 0x03, 0x4c, 0x35,
+    0x03, 0x4c, 0x4b, 0x03, 0x38, 0x4c, 0x03, 0x23, 0x4c, 0x04, 0x0d, 0x4c, 0x07, 0x03, 0x4c, 0x1d,
+    0x03, 0x4c, 0x32, 0x03, 0x4c, 0x48, 0x03, 0x4c, 0x4c, 0x03, 0x3b, 0x4c, 0x03, 0x25, 0x4c, 0x04,
+    0x10, 0x4c, 0x05, 0x03, 0x4c, 0x1a, 0x03, 0x4c, 0x30, 0x03, 0xff, 0xe9, 0x03, 0x3d, 0x4c, 0x03,
+    0x28, 0x4c, 0x03, 0x12, 0x4c, 0x01, 0x0a, 0x4c, 0x02, 0x0b, 0x02, 0x0b, 0x02, 0x05, 0x01, 0x82,
+    0x03, 0x60, 0xdb, 0x00, 0x03, 0x01, 0x34, 0x01, 0x03, 0x4c, 0x36, 0x03, 0x4c, 0x4c, 0x03, 0x36,
+    0x4c, 0x03, 0x21, 0x4c, 0x04, 0x0b, 0x4c, 0x09, 0x03, 0x4c, 0x1f, 0x03, 0x4c, 0x34, 0x03, 0x4c,
+    0x4a, 0x03, 0x4c, 0x4c, 0x03, 0x39, 0x4c, 0x03, 0x23, 0x4c, 0x04, 0x0e, 0x4c, 0x07, 0x03, 0x4c,
+    0x1c, 0x03, 0x4c, 0x32, 0x03, 0x4c, 0x47, 0x03, 0xc7, 0xff, 0x03, 0x26, 0x4c, 0x03, 0x10, 0x4c,
+    0x01, 0x0a, 0x4c, 0x04, 0x0c, 0x02, 0x0c, 0x02, 0x06, 0x01, 0x83, 0x03, 0xb1, 0x9e, 0x00, 0x03,
+    0x01, 0x35, 0x01, 0x03, 0x4c, 0x38, 0x03, 0x4a, 0x4c, 0x03, 0x35, 0x4c, 0x03, 0x20, 0x4c, 0x04,
+    0x0a, 0x4c, 0x0b, 0x03, 0x4c, 0x20, 0x03, 0x4c, 0x36, 0x03, 0x4c, 0x4b, 0x03, 0x4c, 0x4c, 0x03,
+    0x37, 0x4c, 0x03, 0x22, 0x4c, 0x04, 0x0c, 0x4c, 0x08, 0x03, 0x4c, 0x1e, 0x03, 0x4c, 0x33, 0x03,
+    0x4c, 0x49, 0x03, 0x39, 0x4c, 0x03, 0x79, 0xff, 0x03, 0x0e, 0x4c, 0x01, 0x0a, 0x4c, 0x06, 0x0e,
+    0x02, 0x0e, 0x02, 0x07, 0x01, 0x83, 0x03, 0xe9, 0xf0, 0x00, 0x03, 0x01, 0x36, 0x01, 0x03, 0x4c,
+    0x3a, 0x03, 0x48, 0x4c, 0x03, 0x33, 0x4c, 0x03, 0x1d, 0x4c, 0x04, 0x08, 0x4c, 0x0d, 0x03, 0x4c,
+    0x22, 0x03, 0x4c, 0x38, 0x03, 0x4c, 0x4c, 0x03, 0x4b, 0x4c, 0x03, 0x35, 0x4c, 0x03, 0x20, 0x4c,
+    0x04, 0x0a, 0x4c, 0x0a, 0x03, 0x4c, 0x20, 0x03, 0x4c, 0x35, 0x03, 0x4c, 0x4b, 0x03, 0x38, 0x4c,
+    0x03, 0x22, 0x4c, 0x03, 0x2b, 0xff, 0x01, 0x0a, 0x4c, 0x08, 0x10, 0x02, 0x10, 0x02, 0x08, 0x01,
+    0x84, 0x03, 0xc3, 0x62, 0x00, 0x03, 0x01, 0x37, 0x01, 0x03, 0x4c, 0x3c, 0x03, 0x47, 0x4c, 0x03,
+    0x31, 0x4c, 0x03, 0x1c, 0x4c, 0x04, 0x06, 0x4c, 0x0e, 0x03, 0x4c, 0x24, 0x03, 0x4c, 0x39, 0x03,
+    0x4c, 0x4c, 0x03, 0x49, 0x4c, 0x03, 0x33, 0x4c, 0x03, 0x1e, 0x4c, 0x04, 0x08, 0x4c, 0x0c, 0x03,
+    0x4c, 0x22, 0x03, 0x4c, 0x37, 0x03, 0x4b, 0x4c, 0x03, 0x36, 0x4c, 0x03, 0x20, 0x4c, 0x03, 0x0b,
+    0x4c, 0x01, 0x0a, 0xff, 0x21, 0x12, 0x02, 0x12, 0x02, 0x09, 0x01, 0x84, 0x03, 0x99, 0x5a, 0x00,
+};
+
+// Reference decoder's counters
+static const uint32_t STREAM_LOOPBACK_FRAMES = 95;
+static const uint32_t STREAM_LOOPBACK_DROPPED = 25;
+static const uint32_t STREAM_LOOPBACK_CRC_ERRORS = 13;
+static const uint32_t STREAM_LOOPBACK_BAD_PACKETS = 4;
+
+// Verified frames in order: seq, CRC-16/CCITT-FALSE of the body
+static const uint16_t STREAM_LOOPBACK_VERIFIED[95][2] = {
+    {0xffc0, 0xd630}, {0xffc1, 0xa38f}, {0xffc2, 0x6666}, {0xffc3, 0x26d4}, {0xffc5, 0x8fbd}, {0xffc7, 0xda98}, {0xffc8, 0x8df7}, {0xffcb, 0x8eba},
+    {0xffcc, 0xa0fd}, {0xffcd, 0x7ae4}, {0xffce, 0x47e6}, {0xffcf, 0x2bf6}, {0xffd0, 0xc0eb}, {0xffd1, 0x354c}, {0xffd3, 0x9dc2}, {0xffd4, 0xd6f0},
+    {0xffd5, 0xfa32}, {0xffd6, 0xd0fe}, {0xffd7, 0xd2d6}, {0xffd8, 0x88a1}, {0xffd9, 0x5cbf}, {0xffdb, 0xa424}, {0xffdc, 0xd9c0}, {0xffdd, 0x4fed},
+    {0xffde, 0x9865}, {0xffdf, 0x97e9}, {0xffe0, 0x84d2}, {0xffe1, 0xa020}, {0xffe4, 0x4e14}, {0xffe5, 0xa5a4}, {0xffe6, 0x30ae}, {0xffe7, 0x82e4},
+    {0xffe8, 0x84fb}, {0xffe9, 0x537f}, {0xffea, 0x29aa}, {0xffeb, 0xe8c8}, {0xffec, 0xdb38}, {0xffee, 0x620a}, {0xffef, 0xdd6e}, {0xfff0, 0x33d2},
+    {0xfff1, 0xc3ae}, {0xfff2, 0x331d}, {0xfff3, 0xb7a1}, {0xfff4, 0x570c}, {0xfff5, 0x3ba4}, {0xfff6, 0x144f}, {0xfff7, 0x3d4f}, {0xfff9, 0x6220},
+    {0xfffa, 0xce3a}, {0xfffb, 0x517e}, {0xfffc, 0x87ea}, {0xfffd, 0xb0a3}, {0xffff, 0xcc0e}, {0x0000, 0xb4f6}, {0x0001, 0x7334}, {0x0002, 0x5d31},
+    {0x0003, 0xf07e}, {0x0004, 0xc6fc}, {0x0005, 0x98ad}, {0x0006, 0x5249}, {0x0007, 0x56f9}, {0x0008, 0xf530}, {0x0009, 0x64ba}, {0x000a, 0xf609},
+    {0x000b, 0x5180}, {0x000d, 0xef24}, {0x000e, 0x7be7}, {0x000f, 0x973d}, {0x0010, 0xad9d}, {0x0012, 0x9859}, {0x0013, 0xbc29}, {0x0014, 0x415b},
+    {0x0017, 0xe17b}, {0x0019, 0xe696}, {0x001a, 0x49e5}, {0x001b, 0xbd70}, {0x001c, 0x186c}, {0x001f, 0x9676}, {0x0021, 0xd2c6}, {0x0022, 0x0aec},
+    {0x0024, 0xbcfd}, {0x0026, 0xbe8e}, {0x0027, 0x553e}, {0x0028, 0xfcca}, {0x0029, 0xd993}, {0x002a, 0x072c}, {0x002c, 0x54ad}, {0x002d, 0xcca9},
+    {0x002e, 0x76a2}, {0x0030, 0x3bb3}, {0x0031, 0x71a3}, {0x0032, 0x46b6}, {0x0034, 0x6fae}, {0x0036, 0xf61e}, {0x0037, 0xd980},
+};
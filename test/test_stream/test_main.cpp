@@ -0,0 +1,113 @@
+#include <unity.h>
+#include <string.h>
+#include "stream.h"
+#include "stream_loopback.h"
+
+// ─── Stream decoding ─────────────────────────────────────────────────────────
+//
+// StreamDecoder against tools/stream_send.py's loopback: the fixture is the
+// wire as the Python sender built it, with packets withheld and bytes
+// damaged, plus what the Python reference decoder made of it (regeneration
+// command at the top of the header). Its seqs cross the 16-bit wrap.
+
+void setUp() {}
+void tearDown() {}
+
+static constexpr uint32_t VERIFIED = sizeof(STREAM_LOOPBACK_VERIFIED) / sizeof(STREAM_LOOPBACK_VERIFIED[0]);
+
+static uint16_t bodyCrc(const Frame& f) {
+    const uint8_t* p   = (const uint8_t*)&f;
+    uint16_t       crc = 0xFFFF;
+    for (size_t i = 0; i < sizeof(Frame); i++) crc = streamCrcByte(crc, p[i]);
+    return crc;
+}
+
+static void test_counts_match_reference() {
+    StreamDecoder dec;
+    uint32_t      n = 0;
+    for (size_t i = 0; i < sizeof(STREAM_LOOPBACK_WIRE); i++) {
+        uint8_t type = dec.push(STREAM_LOOPBACK_WIRE[i]);
+        if (type == STREAM_NONE) continue;
+        TEST_ASSERT_EQUAL_HEX8(STREAM_FRAME, type);
+        TEST_ASSERT_TRUE(n < VERIFIED);
+        TEST_ASSERT_EQUAL_HEX16(STREAM_LOOPBACK_VERIFIED[n][0], dec.seq());
+        TEST_ASSERT_EQUAL_HEX16(STREAM_LOOPBACK_VERIFIED[n][1], bodyCrc(dec.frame()));
+        n++;
+    }
+
+    char msg[96];
+    snprintf(msg, sizeof(msg), "frames=%lu dropped=%lu crc=%lu bad=%lu",
+             (unsigned long)dec.stats.frames, (unsigned long)dec.stats.dropped,
+             (unsigned long)dec.stats.crcErrors, (unsigned long)dec.stats.badPackets);
+    TEST_MESSAGE(msg);
+
+    TEST_ASSERT_EQUAL_UINT32(VERIFIED, n);
+    TEST_ASSERT_EQUAL_UINT32(STREAM_LOOPBACK_FRAMES, dec.stats.frames);
+    TEST_ASSERT_EQUAL_UINT32(STREAM_LOOPBACK_FRAMES, dec.stats.packets);
+    TEST_ASSERT_EQUAL_UINT32(STREAM_LOOPBACK_DROPPED, dec.stats.dropped);
+    TEST_ASSERT_EQUAL_UINT32(STREAM_LOOPBACK_CRC_ERRORS, dec.stats.crcErrors);
+    TEST_ASSERT_EQUAL_UINT32(STREAM_LOOPBACK_BAD_PACKETS, dec.stats.badPackets);
+}
+
+static void test_fixture_covers_faults() {
+    // Regenerating with other options must keep every path exercised
+    TEST_ASSERT_TRUE(STREAM_LOOPBACK_DROPPED > 0);
+    TEST_ASSERT_TRUE(STREAM_LOOPBACK_CRC_ERRORS > 0);
+    TEST_ASSERT_TRUE(STREAM_LOOPBACK_BAD_PACKETS > 0);
+    bool wrapped = false;
+    for (uint32_t i = 1; i < VERIFIED; i++)
+        wrapped |= STREAM_LOOPBACK_VERIFIED[i][0] < STREAM_LOOPBACK_VERIFIED[i - 1][0];
+    TEST_ASSERT_TRUE(wrapped);
+}
+
+static void test_encoder_matches_python() {
+    // Re-encoding each verified frame gives back the sender's bytes
+    StreamDecoder dec;
+    size_t        start = 0;   // first byte of the current packet
+    uint32_t      n     = 0;
+    for (size_t i = 0; i < sizeof(STREAM_LOOPBACK_WIRE); i++) {
+        uint8_t type = dec.push(STREAM_LOOPBACK_WIRE[i]);
+        if (STREAM_LOOPBACK_WIRE[i] != 0) continue;
+        if (type == STREAM_FRAME) {
+            uint8_t out[streamWireBytes(sizeof(Frame))];
+            size_t  len = streamEncode(STREAM_FRAME, dec.seq(), &dec.frame(), sizeof(Frame), out);
+            TEST_ASSERT_EQUAL_UINT32(i + 1 - start, len);
+            TEST_ASSERT_EQUAL_HEX8_ARRAY(STREAM_LOOPBACK_WIRE + start, out, len);
+            n++;
+        }
+        start = i + 1;
+    }
+    TEST_ASSERT_EQUAL_UINT32(VERIFIED, n);
+}
+
+static void test_resynchronises_after_garbage() {
+    // Text and a cut-off packet ahead of a good one: one bad packet, then the frame
+    static const char text[] = "mode 3\r\n";
+    Frame   f = {};
+    f.duty[0] = 0x0102;
+    uint8_t pkt[streamWireBytes(sizeof(Frame))];
+    size_t  len = streamEncode(STREAM_FRAME, 7, &f, sizeof(Frame), pkt);
+
+    StreamDecoder dec;
+    for (size_t i = 0; i + 1 < sizeof(text); i++) TEST_ASSERT_EQUAL_HEX8(STREAM_NONE, dec.push(text[i]));
+    for (size_t i = 0; i < len / 2; i++) dec.push(pkt[i]);
+    TEST_ASSERT_EQUAL_HEX8(STREAM_NONE, dec.push(0));
+    TEST_ASSERT_EQUAL_UINT32(1, dec.stats.badPackets);
+
+    uint8_t type = STREAM_NONE;
+    for (size_t i = 0; i < len; i++) type = dec.push(pkt[i]);
+    TEST_ASSERT_EQUAL_HEX8(STREAM_FRAME, type);
+    TEST_ASSERT_EQUAL_UINT16(7, dec.seq());
+    TEST_ASSERT_EQUAL_UINT16(0x0102, dec.frame().duty[0]);
+    TEST_ASSERT_EQUAL_UINT32(1, dec.stats.frames);
+    TEST_ASSERT_EQUAL_UINT32(0, dec.stats.crcErrors);
+}
+
+int main(int, char**) {
+    UNITY_BEGIN();
+    RUN_TEST(test_counts_match_reference);
+    RUN_TEST(test_fixture_covers_faults);
+    RUN_TEST(test_encoder_matches_python);
+    RUN_TEST(test_resynchronises_after_garbage);
+    return UNITY_END();
+}
@@ -0,0 +1,92 @@
+#include <unity.h>
+#include "strip_segments.h"
+
+// ─── Strip segments ──────────────────────────────────────────────────────────
+//
+// The layout helpers on a three-segment strip with a reversed middle run,
+// independent of the layout config.h ships: validation, segment offsets and
+// wire time, and stripScatter() against the per-pixel mapping of
+// stripSegmentOf().
+
+void setUp() {}
+void tearDown() {}
+
+static constexpr int      PINS[]     = {33, 10, 11};
+static constexpr uint16_t LENGTHS[]  = {10, 20, 5};
+static constexpr bool     REVERSED[] = {false, true, false};
+static constexpr int      LEDS       = 35;
+
+static constexpr StripLayout LAYOUT = {PINS, LENGTHS, REVERSED, 3};
+
+// Checked at compile time too — the way config.h's own layout is
+static_assert(stripLayoutCheck(LAYOUT, LEDS, STRIP_RMT_CHANNELS) == STRIP_LAYOUT_OK, "test layout");
+
+static void test_layout_check() {
+    static constexpr int      dupPins[]  = {33, 10, 33};
+    static constexpr uint16_t zeroLens[] = {10, 0, 25};
+
+    TEST_ASSERT_EQUAL(STRIP_LAYOUT_OK, stripLayoutCheck(LAYOUT, LEDS, 4));
+    TEST_ASSERT_EQUAL(STRIP_LAYOUT_LENGTH_SUM, stripLayoutCheck(LAYOUT, LEDS + 1, 4));
+    TEST_ASSERT_EQUAL(STRIP_LAYOUT_LENGTH_SUM, stripLayoutCheck(LAYOUT, LEDS - 1, 4));
+    TEST_ASSERT_EQUAL(STRIP_LAYOUT_EMPTY, stripLayoutCheck(LAYOUT, LEDS, 2));   // too few RMT channels
+    TEST_ASSERT_EQUAL(STRIP_LAYOUT_EMPTY, stripLayoutCheck({PINS, LENGTHS, REVERSED, 0}, 0, 4));
+    TEST_ASSERT_EQUAL(STRIP_LAYOUT_ZERO_LENGTH, stripLayoutCheck({PINS, zeroLens, REVERSED, 3}, LEDS, 4));
+    TEST_ASSERT_EQUAL(STRIP_LAYOUT_DUPLICATE_PIN, stripLayoutCheck({dupPins, LENGTHS, REVERSED, 3}, LEDS, 4));
+
+    // The shipped layout passes its own limits
+    TEST_ASSERT_EQUAL(STRIP_LAYOUT_OK, stripLayoutCheck(STRIP_LAYOUT, NUM_LEDS, STRIP_RMT_CHANNELS));
+}
+
+static void test_segment_offsets_and_wire_time() {
+    TEST_ASSERT_EQUAL(0, stripSegmentFirst(LAYOUT, 0));
+    TEST_ASSERT_EQUAL(10, stripSegmentFirst(LAYOUT, 1));
+    TEST_ASSERT_EQUAL(30, stripSegmentFirst(LAYOUT, 2));
+    TEST_ASSERT_EQUAL(LEDS, stripSegmentFirst(LAYOUT, 3));   // one past the end
+    TEST_ASSERT_EQUAL(20, stripLongestSegment(LAYOUT));
+    TEST_ASSERT_EQUAL(20 * WS2812_US_PER_PIXEL + WS2812_RESET_US, stripWireUs(LAYOUT));
+}
+
+static void test_segment_of_each_pixel() {
+    uint16_t along = 0xFFFF;
+    TEST_ASSERT_EQUAL(0, stripSegmentOf(LAYOUT, 0, &along));
+    TEST_ASSERT_EQUAL(0, along);
+    TEST_ASSERT_EQUAL(0, stripSegmentOf(LAYOUT, 9, &along));
+    TEST_ASSERT_EQUAL(9, along);
+    TEST_ASSERT_EQUAL(1, stripSegmentOf(LAYOUT, 10, &along));   // reversed: far end of its run
+    TEST_ASSERT_EQUAL(19, along);
+    TEST_ASSERT_EQUAL(1, stripSegmentOf(LAYOUT, 29, &along));
+    TEST_ASSERT_EQUAL(0, along);
+    TEST_ASSERT_EQUAL(2, stripSegmentOf(LAYOUT, 30, &along));
+    TEST_ASSERT_EQUAL(0, along);
+    TEST_ASSERT_EQUAL(2, stripSegmentOf(LAYOUT, 34));
+    TEST_ASSERT_EQUAL(-1, stripSegmentOf(LAYOUT, 35));
+    TEST_ASSERT_EQUAL(-1, stripSegmentOf(LAYOUT, -1));
+}
+
+static void test_scatter_places_every_pixel() {
+    CRGB logical[LEDS], wire[LEDS];
+    for (int i = 0; i < LEDS; i++) logical[i] = CRGB((uint8_t)i, (uint8_t)(255 - i), 7);
+    fill_solid(wire, LEDS, CRGB::Black);
+    stripScatter(LAYOUT, logical, wire);
+
+    for (int led = 0; led < LEDS; led++) {
+        uint16_t along = 0;
+        int      seg   = stripSegmentOf(LAYOUT, led, &along);
+        TEST_ASSERT_TRUE(seg >= 0);
+        TEST_ASSERT_TRUE(wire[stripSegmentFirst(LAYOUT, seg) + along] == logical[led]);
+    }
+    // Spot checks: forward runs copy straight, the reversed one is flipped
+    TEST_ASSERT_TRUE(wire[0] == logical[0]);
+    TEST_ASSERT_TRUE(wire[10] == logical[29]);
+    TEST_ASSERT_TRUE(wire[29] == logical[10]);
+    TEST_ASSERT_TRUE(wire[34] == logical[34]);
+}
+
+int main(int, char**) {
+    UNITY_BEGIN();
+    RUN_TEST(test_layout_check);
+    RUN_TEST(test_segment_offsets_and_wire_time);
+    RUN_TEST(test_segment_of_each_pixel);
+    RUN_TEST(test_scatter_places_every_pixel);
+    return UNITY_END();
+}
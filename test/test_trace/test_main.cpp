@@ -0,0 +1,128 @@
+#include <unity.h>
+#include "trace.h"
+#include "trace_plain.h"
+#include "trace_shift3.h"
+
+// ─── Trace decoding ──────────────────────────────────────────────────────────
+//
+// TraceReader against tools/trace_encode.py's reference decoder, frame for
+// frame. The fixtures are encoder output with the decoder's frames alongside
+// (regeneration commands at the top of each header): one lossless with
+// 64-frame blocks, one at shift 3 with 48-frame blocks so its last block is
+// partial. Both span several TRACE_READ_BUF refills.
+
+void setUp() {}
+void tearDown() {}
+
+struct Fixture {
+    const uint8_t*  data;
+    uint32_t        size;
+    const uint16_t (*frames)[TRACE_CHANNELS];
+    uint32_t        count;
+};
+
+static const Fixture FIXTURES[] = {
+    {TRACE_PLAIN_DATA, sizeof(TRACE_PLAIN_DATA), TRACE_PLAIN_FRAMES, 400},
+    {TRACE_SHIFT3_DATA, sizeof(TRACE_SHIFT3_DATA), TRACE_SHIFT3_FRAMES, 400},
+};
+
+static void assertFrame(const Fixture& fx, uint32_t i, const uint16_t out[TRACE_CHANNELS]) {
+    for (int ch = 0; ch < TRACE_CHANNELS; ch++) {
+        if (out[ch] != fx.frames[i][ch]) {
+            char msg[96];
+            snprintf(msg, sizeof(msg), "frame %lu channel %d: %u, reference %u",
+                     (unsigned long)i, ch, out[ch], fx.frames[i][ch]);
+            TEST_FAIL_MESSAGE(msg);
+        }
+    }
+}
+
+static void test_sequential_decode_matches_reference() {
+    for (const Fixture& fx : FIXTURES) {
+        MemoryTraceSource src(fx.data, fx.size);
+        TraceReader       r;
+        TEST_ASSERT_TRUE(r.open(src));
+        TEST_ASSERT_EQUAL_UINT32(fx.count, r.header().frames);
+        TEST_ASSERT_TRUE(fx.size > 4 * TRACE_READ_BUF);
+
+        uint16_t out[TRACE_CHANNELS];
+        for (uint32_t i = 0; i < fx.count; i++) {
+            TEST_ASSERT_EQUAL_UINT32(i, r.frame());
+            TEST_ASSERT_TRUE(r.next(out));
+            assertFrame(fx, i, out);
+        }
+    }
+}
+
+static void test_playback_wraps_to_frame_zero() {
+    for (const Fixture& fx : FIXTURES) {
+        MemoryTraceSource src(fx.data, fx.size);
+        TraceReader       r;
+        TEST_ASSERT_TRUE(r.open(src));
+
+        // Three laps: every wrap restarts at the first block's keyframe
+        uint16_t out[TRACE_CHANNELS];
+        for (uint32_t i = 0; i < 3 * fx.count; i++) {
+            TEST_ASSERT_TRUE(r.next(out));
+            assertFrame(fx, i % fx.count, out);
+        }
+        TEST_ASSERT_EQUAL_UINT32(fx.count, r.frame());
+        TEST_ASSERT_TRUE(r.next(out));
+        TEST_ASSERT_EQUAL_UINT32(1, r.frame());
+    }
+}
+
+static void test_seek_to_every_frame_matches_reference() {
+    for (const Fixture& fx : FIXTURES) {
+        MemoryTraceSource src(fx.data, fx.size);
+        TraceReader       r;
+        TEST_ASSERT_TRUE(r.open(src));
+
+        // From each frame, decode across the next block boundary and, near
+        // the end, through the wrap
+        uint16_t out[TRACE_CHANNELS];
+        uint32_t run = r.header().blockFrames + 2;
+        for (uint32_t f = 0; f < fx.count; f++) {
+            TEST_ASSERT_TRUE(r.seek(f));
+            TEST_ASSERT_EQUAL_UINT32(f, r.frame());
+            for (uint32_t i = 0; i < run; i++) {
+                TEST_ASSERT_TRUE(r.next(out));
+                assertFrame(fx, (f + i) % fx.count, out);
+            }
+        }
+        TEST_ASSERT_FALSE(r.seek(fx.count));
+    }
+}
+
+static void test_rejects_bad_header_and_truncation() {
+    const Fixture& fx = FIXTURES[0];
+    static uint8_t copy[sizeof(TRACE_PLAIN_DATA)];
+    TraceReader    r;
+
+    memcpy(copy, fx.data, fx.size);
+    copy[4] = TRACE_VERSION - 1;   // an older format
+    MemoryTraceSource old(copy, fx.size);
+    TEST_ASSERT_FALSE(r.open(old));
+
+    MemoryTraceSource headerOnly(fx.data, sizeof(TraceHeader));
+    TEST_ASSERT_FALSE(r.open(headerOnly));
+
+    // Cut mid-way through the last block: frames up to the cut still match,
+    // then next() reports the read error instead of inventing samples
+    MemoryTraceSource cut(fx.data, fx.size - 40);
+    TEST_ASSERT_TRUE(r.open(cut));
+    uint16_t out[TRACE_CHANNELS];
+    uint32_t good = 0;
+    while (good < fx.count && r.next(out)) assertFrame(fx, good++, out);
+    TEST_ASSERT_TRUE(good > fx.count - r.header().blockFrames);
+    TEST_ASSERT_TRUE(good < fx.count);
+}
+
+int main(int, char**) {
+    UNITY_BEGIN();
+    RUN_TEST(test_sequential_decode_matches_reference);
+    RUN_TEST(test_playback_wraps_to_frame_zero);
+    RUN_TEST(test_seek_to_every_frame_matches_reference);
+    RUN_TEST(test_rejects_bad_header_and_truncation);
+    return UNITY_END();
+}
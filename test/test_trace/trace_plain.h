@@ -0,0 +1,494 @@
+// Generated by tools/trace_encode.py; do not edit. Regenerate with
+//   tools/trace_encode.py --synth 4 --block 64 /dev/null --c-header test/test_trace/trace_plain.h
+#pragma once
+#include <stdint.h>
+
+static const uint8_t TRACE_PLAIN_DATA[1315] = {
+    0x46, 0x54, 0x52, 0x43, 0x02, 0x04, 0x64, 0x00, 0x90, 0x01, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0x07, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0xd3, 0x01, 0x00, 0x00,
+    0xae, 0x02, 0x00, 0x00, 0x71, 0x03, 0x00, 0x00, 0x28, 0x04, 0x00, 0x00, 0xe9, 0x04, 0x00, 0x00,
+    0x39, 0x01, 0x06, 0x01, 0x2b, 0x03, 0x43, 0x09, 0x26, 0xa7, 0x86, 0x41, 0xc5, 0x87, 0x41, 0x19,
+    0x8e, 0xa1, 0x61, 0x87, 0x1a, 0xdd, 0x18, 0x99, 0xc7, 0x88, 0xd1, 0xa9, 0x18, 0x3e, 0x38, 0x39,
+    0xbe, 0xe3, 0x83, 0xb3, 0xe3, 0x3c, 0x48, 0x38, 0x3d, 0xea, 0x83, 0xa4, 0xd3, 0xc3, 0x3f, 0x4a,
+    0x3a, 0x3f, 0x8e, 0xc4, 0xa4, 0x93, 0x84, 0x4a, 0x4c, 0x3c, 0x49, 0xba, 0xe4, 0xc4, 0xb3, 0xc4,
+    0x4c, 0x58, 0x3e, 0x4b, 0xde, 0x84, 0xe5, 0xd3, 0xe4, 0x4e, 0x58, 0x3e, 0x4f, 0xfe, 0xa4, 0xe5,
+    0xf3, 0xa4, 0x58, 0x5a, 0x3e, 0x4f, 0x9a, 0xa5, 0xe5, 0xf3, 0xc4, 0x59, 0x5a, 0x3e, 0x4f, 0x9e,
+    0xc5, 0xe5, 0x93, 0x85, 0x5a, 0x5a, 0x3e, 0x4f, 0x9e, 0xa5, 0xe5, 0x93, 0xe5, 0x59, 0x58, 0x3c,
+    0x4f, 0x9a, 0x85, 0xc5, 0xf3, 0xe4, 0x58, 0x58, 0x3c, 0x4d, 0x88, 0xa5, 0x61, 0x1b, 0xcc, 0x21,
+    0x11, 0x2c, 0x10, 0xa1, 0x11, 0x01, 0x34, 0x03, 0x13, 0x23, 0x19, 0x33, 0xf0, 0x51, 0x43, 0x2b,
+    0x53, 0xf2, 0x52, 0x43, 0x39, 0x35, 0xb2, 0x53, 0x45, 0x3b, 0x35, 0xb4, 0x53, 0x43, 0x39, 0x35,
+    0xf2, 0x32, 0x23, 0x2d, 0x33, 0x92, 0x52, 0x21, 0x1d, 0x11, 0x72, 0x13, 0x10, 0x01, 0x20, 0x01,
+    0x81, 0x11, 0x10, 0x1c, 0x00, 0xc1, 0x02, 0x12, 0x2e, 0x20, 0xe3, 0x23, 0x32, 0x48, 0x42, 0xc3,
+    0x04, 0x32, 0x4e, 0x42, 0x85, 0x25, 0x34, 0x5a, 0x42, 0xa5, 0x25, 0x34, 0x58, 0x40, 0xe5, 0x24,
+    0x34, 0x4c, 0x40, 0xe3, 0x03, 0x12, 0x3a, 0xa6, 0x01, 0x48, 0x01, 0x88, 0x02, 0x72, 0x0e, 0x21,
+    0xe0, 0x11, 0x12, 0x36, 0x02, 0x31, 0x20, 0x1b, 0x05, 0xb2, 0x52, 0x40, 0x3b, 0x17, 0xf4, 0x94,
+    0x11, 0xf6, 0x75, 0x83, 0x91, 0xb7, 0x31, 0x18, 0x89, 0x91, 0x31, 0x1a, 0x99, 0xd1, 0x31, 0x1a,
+    0xab, 0xb1, 0x51, 0x1a, 0xb9, 0xd1, 0x51, 0x1c, 0xbf, 0xd1, 0x71, 0x1c, 0xcb, 0xd1, 0x51, 0x1e,
+    0xd9, 0xd1, 0x71, 0x1c, 0xdd, 0xf1, 0x71, 0x1e, 0xdf, 0xd1, 0x71, 0x1e, 0xdf, 0xd1, 0x71, 0x1e,
+    0xdd, 0xd1, 0x51, 0x1c, 0xdd, 0xd1, 0x71, 0x1e, 0xdb, 0xd1, 0x51, 0x1c, 0xcd, 0xb1, 0x71, 0x1c,
+    0xc9, 0xb1, 0x51, 0x1c, 0xbb, 0xb1, 0x31, 0x1a, 0xab, 0x91, 0x51, 0x1a, 0x9b, 0x91, 0x11, 0x18,
+    0x8b, 0x71, 0x63, 0x79, 0x15, 0xf6, 0x55, 0x40, 0x4d, 0x05, 0x94, 0x13, 0x22, 0x29, 0x23, 0x32,
+    0x41, 0x41, 0x40, 0xe1, 0x01, 0x16, 0x2e, 0x62, 0xa3, 0x24, 0x18, 0x83, 0x25, 0x18, 0xe5, 0x45,
+    0x1a, 0xe7, 0x26, 0x1a, 0xa5, 0x47, 0x1a, 0xe7, 0x67, 0x1a, 0xa7, 0x18, 0xc4, 0x71, 0x8a, 0x41,
+    0x1a, 0xc7, 0x18, 0xc4, 0x71, 0x8c, 0x41, 0x1a, 0xa7, 0x18, 0xc4, 0x71, 0x88, 0x41, 0x1a, 0xc7,
+    0x47, 0x1a, 0xa5, 0x47, 0x1a, 0xc7, 0x26, 0x1a, 0xe3, 0x25, 0x18, 0x85, 0x25, 0x18, 0xa3, 0x04,
+    0x36, 0x3e, 0x80, 0x11, 0x2e, 0x40, 0xe1, 0x01, 0x16, 0x1a, 0x40, 0x40, 0x41, 0x00, 0x21, 0x52,
+    0x21, 0x90, 0x01, 0x1b, 0x01, 0x7d, 0x01, 0xcc, 0x02, 0x49, 0x0c, 0x23, 0xd2, 0x11, 0x22, 0x29,
+    0x01, 0xf2, 0x31, 0x22, 0x29, 0x01, 0xf2, 0x11, 0x22, 0x1b, 0x21, 0x90, 0x01, 0x22, 0x15, 0x02,
+    0x00, 0x14, 0x24, 0x04, 0x1a, 0x40, 0xa1, 0x22, 0x36, 0x3a, 0x62, 0x83, 0x44, 0x18, 0x83, 0x45,
+    0x18, 0xe5, 0x45, 0x1a, 0xe5, 0x66, 0x1a, 0xe7, 0x47, 0x1a, 0xc7, 0x18, 0x18, 0x1c, 0x19, 0x98,
+    0x61, 0x1c, 0x19, 0xa8, 0x81, 0xc1, 0x91, 0xa1, 0x1a, 0x18, 0x1c, 0x19, 0xb8, 0x81, 0xe1, 0x91,
+    0x81, 0x1b, 0x18, 0x1e, 0x1b, 0xba, 0x81, 0xc1, 0x91, 0xa1, 0x1b, 0x18, 0x1e, 0x1b, 0xba, 0x81,
+    0xc1, 0x91, 0x81, 0x1b, 0x18, 0x1c, 0x19, 0xac, 0x81, 0xc1, 0x91, 0x81, 0x1a, 0x18, 0x1a, 0x19,
+    0x9a, 0x61, 0x18, 0xa7, 0x18, 0xa6, 0x51, 0x7c, 0x66, 0xc7, 0x46, 0x36, 0x5a, 0x44, 0x83, 0x44,
+    0x12, 0x2c, 0x22, 0xa1, 0x21, 0x00, 0x00, 0x21, 0x1b, 0x30, 0xf2, 0x12, 0x45, 0x49, 0x51, 0xb6,
+    0x35, 0x19, 0xf6, 0x36, 0x87, 0xf1, 0x37, 0x1b, 0x1a, 0x99, 0x51, 0x1b, 0x1a, 0x9f, 0x51, 0x1d,
+    0x1a, 0xaf, 0x71, 0x1d, 0x1c, 0xbd, 0x51, 0x1d, 0x1c, 0xcb, 0x71, 0x1f, 0x1c, 0xcd, 0x71, 0x1d,
+    0x1e, 0xd9, 0x71, 0x1f, 0x1c, 0xd9, 0x71, 0x1f, 0x1e, 0xd9, 0x71, 0x1f, 0x1c, 0xd9, 0x71, 0x1f,
+    0x1c, 0xcf, 0x51, 0x1d, 0x1e, 0xcb, 0x71, 0x1f, 0x1a, 0xbd, 0x51, 0x1d, 0x1c, 0xbb, 0x51, 0x1b,
+    0x1a, 0xab, 0x51, 0x1d, 0x1a, 0x9d, 0x31, 0x19, 0x18, 0x8f, 0x31, 0x1b, 0x18, 0x7f, 0x1c, 0x01,
+    0x6f, 0x01, 0xe5, 0x02, 0x80, 0x0b, 0x71, 0xf6, 0x15, 0x47, 0x59, 0x70, 0x94, 0x04, 0x45, 0x39,
+    0x30, 0xb2, 0x02, 0x25, 0x1b, 0x32, 0x70, 0x12, 0x30, 0x32, 0x20, 0x14, 0x40, 0x32, 0x60, 0x14,
+    0x61, 0x12, 0x80, 0x41, 0x13, 0x26, 0x01, 0x46, 0x03, 0x22, 0x01, 0x21, 0x03, 0x23, 0x25, 0x19,
+    0x30, 0xf2, 0x01, 0x25, 0x2d, 0x70, 0x94, 0x03, 0x45, 0x49, 0x71, 0xd4, 0x14, 0x19, 0xd6, 0x35,
+    0x67, 0x6b, 0x93, 0x81, 0xf1, 0x36, 0x19, 0xd6, 0x37, 0x19, 0x18, 0x7f, 0xb5, 0xa1, 0xd1, 0x18,
+    0x93, 0x81, 0xf1, 0x18, 0xb5, 0x81, 0xf1, 0x18, 0x95, 0xa1, 0x91, 0x19, 0xb5, 0x81, 0x91, 0x19,
+    0x95, 0xa1, 0xf1, 0x18, 0x95, 0x81, 0xd1, 0x18, 0x93, 0x81, 0x91, 0x18, 0x75, 0x18, 0x7d, 0x93,
+    0x61, 0x6f, 0x53, 0x96, 0x16, 0x67, 0x59, 0x51, 0xf4, 0x03, 0x23, 0x39, 0x30, 0xd2, 0x21, 0x23,
+    0x23, 0x11, 0x44, 0x10, 0x28, 0x04, 0xa1, 0x63, 0x52, 0x4e, 0x18, 0x32, 0x5e, 0x18, 0x72, 0x78,
+    0x1a, 0x74, 0x8a, 0xc1, 0x61, 0xa7, 0x19, 0x1a, 0x96, 0x81, 0x1a, 0x1e, 0xb6, 0x81, 0x1b, 0x1c,
+    0x96, 0xc1, 0x1b, 0x1e, 0xb6, 0xa1, 0x1c, 0x1e, 0x18, 0x1b, 0xcc, 0x81, 0x82, 0xd1, 0xe1, 0x1c,
+    0x1e, 0xb6, 0x81, 0x1d, 0x1e, 0x18, 0x1b, 0xce, 0xe1, 0x81, 0xb1, 0xc1, 0x1c, 0x28, 0xb6, 0xa1,
+    0x1c, 0x69, 0x01, 0x07, 0x01, 0xe8, 0x02, 0x63, 0x0b, 0x1e, 0x96, 0x81, 0x1b, 0x1c, 0x96, 0xa1,
+    0x1a, 0x1c, 0x96, 0xc1, 0x19, 0x1a, 0x74, 0x8c, 0xa1, 0x41, 0xa7, 0x87, 0x41, 0xa5, 0x66, 0x32,
+    0x5a, 0x26, 0xe3, 0x63, 0x10, 0x2e, 0x02, 0xc1, 0x21, 0x00, 0x22, 0x00, 0x05, 0x21, 0x1d, 0x11,
+    0xf2, 0x12, 0x43, 0x3d, 0x13, 0xb4, 0x34, 0x63, 0x59, 0x33, 0xf6, 0x55, 0x63, 0x69, 0x33, 0xb6,
+    0x56, 0x83, 0xf1, 0x56, 0x65, 0x6d, 0x35, 0xd6, 0x56, 0x61, 0x6d, 0x35, 0x18, 0x69, 0x35, 0xf4,
+    0x35, 0x61, 0x5b, 0x13, 0xf6, 0x34, 0x41, 0x49, 0x13, 0xb2, 0x13, 0x40, 0x2f, 0x01, 0x92, 0x12,
+    0x20, 0x1b, 0x20, 0x70, 0x00, 0x10, 0x22, 0x40, 0x40, 0x80, 0x21, 0x12, 0x1a, 0x42, 0xe1, 0x21,
+    0x14, 0x1e, 0x42, 0xa1, 0x22, 0x14, 0x28, 0x42, 0x81, 0x22, 0x14, 0x1c, 0x42, 0xc0, 0x01, 0x12,
+    0x06, 0x04, 0x02, 0x02, 0x13, 0x22, 0x19, 0x23, 0xf2, 0x11, 0x40, 0x39, 0x05, 0x94, 0x54, 0x41,
+    0x59, 0x17, 0x96, 0x76, 0x81, 0xb1, 0x97, 0x31, 0x18, 0x8d, 0x91, 0x51, 0x1a, 0x9d, 0xb1, 0x31,
+    0x1a, 0xad, 0xd1, 0x71, 0x1c, 0xbd, 0xd1, 0x51, 0x1c, 0xcd, 0xd1, 0x71, 0x1e, 0xdb, 0xf1, 0x91,
+    0xe1, 0xf1, 0x1d, 0x1f, 0x19, 0x1e, 0xed, 0x01, 0x25, 0x01, 0xf0, 0x00, 0x37, 0x03, 0xda, 0x08,
+    0x1f, 0x19, 0x28, 0xfd, 0x91, 0x92, 0x81, 0xb2, 0x1f, 0x1f, 0x1b, 0x1e, 0xfd, 0x91, 0x92, 0x81,
+    0xd2, 0x1f, 0x1f, 0x1b, 0x1e, 0xf9, 0xf1, 0x91, 0x81, 0xd2, 0x1e, 0x1f, 0x19, 0x1e, 0xeb, 0xf1,
+    0x91, 0xc1, 0xb1, 0x1d, 0x1b, 0xc7, 0xd1, 0x1c, 0x1d, 0xc7, 0xb1, 0x1b, 0x1b, 0xa7, 0xd1, 0x1a,
+    0x19, 0xa5, 0xb1, 0x19, 0x19, 0x85, 0x91, 0x18, 0x37, 0xd6, 0x56, 0x63, 0x5d, 0x15, 0xf4, 0x33,
+    0x40, 0x2f, 0x01, 0xb0, 0x01, 0x00, 0x01, 0x04, 0x18, 0x40, 0xa1, 0x22, 0x34, 0x3c, 0x64, 0xa3,
+    0x44, 0x18, 0xa3, 0x45, 0x56, 0x5e, 0x86, 0x71, 0x6e, 0xa4, 0x51, 0x78, 0x86, 0x71, 0x7c, 0xa6,
+    0x51, 0x7c, 0x86, 0x71, 0x7e, 0xa6, 0x71, 0x7c, 0xa6, 0x51, 0x7c, 0x86, 0x71, 0x7a, 0x84, 0x51,
+    0x6e, 0x84, 0x51, 0x68, 0x84, 0x51, 0x5e, 0x62, 0xe3, 0x44, 0x36, 0x4a, 0x40, 0xa3, 0x23, 0x14,
+    0x2c, 0x40, 0xe1, 0x11, 0x12, 0x18, 0x01, 0x00, 0x21, 0x32, 0x01, 0x90, 0x31, 0x21, 0x1d, 0x13,
+    0xb2, 0x32, 0x41, 0x2d, 0x13, 0xf2, 0x52, 0x41, 0x39, 0x13, 0x92, 0x33, 0x43, 0x39, 0x15, 0x92,
+    0x33, 0x41, 0x2d, 0x33, 0xb2, 0x12, 0x20, 0x1f, 0x13, 0x92, 0x11, 0x00, 0x13, 0x00, 0x00, 0x10,
+    0x18, 0x20, 0xe0, 0x01, 0x34, 0x2e, 0x22, 0xc1, 0x03, 0xc4, 0x00, 0xf7, 0x00, 0x67, 0x03, 0x51,
+    0x07, 0x42, 0xa3, 0x45, 0x56, 0x6a, 0x84, 0x71, 0x78, 0x84, 0x51, 0x7c, 0x86, 0x71, 0x8a, 0x61,
+    0x18, 0x19, 0x8e, 0x41, 0x18, 0xa7, 0x19, 0xa6, 0x91, 0xc1, 0x19, 0x86, 0x71, 0x9c, 0x61, 0x1a,
+    0x19, 0x9c, 0x61, 0x18, 0x19, 0x9a, 0x61, 0x18, 0xa7, 0x19, 0x84, 0x71, 0x8c, 0x61, 0x76, 0x88,
+    0x21, 0x76, 0x7c,
+};
+
+// Reference decoding, frame by frame: w1, w2, red, strip
+static const uint16_t TRACE_PLAIN_FRAMES[400][4] = {
+    {313, 262, 811, 2371},
+    {316, 263, 807, 2396},
+    {320, 265, 804, 2426},
+    {324, 267, 799, 2461},
+    {329, 270, 795, 2501},
+    {50, 41, 1053, 382},
+    {65, 53, 1040, 493},
+    {80, 65, 1026, 608},
+    {96, 77, 1011, 729},
+    {112, 90, 996, 855},
+    {129, 103, 980, 986},
+    {147, 116, 963, 1122},
+    {165, 130, 946, 1263},
+    {184, 144, 928, 1409},
+    {204, 159, 910, 1560},
+    {224, 174, 891, 1715},
+    {244, 189, 871, 1874},
+    {265, 204, 851, 2035},
+    {286, 219, 831, 2200},
+    {307, 234, 811, 2366},
+    {328, 249, 791, 2533},
+    {350, 264, 770, 2701},
+    {371, 279, 750, 2868},
+    {392, 294, 729, 3035},
+    {412, 308, 709, 3200},
+    {432, 322, 689, 3363},
+    {452, 336, 670, 3523},
+    {457, 339, 664, 3573},
+    {458, 338, 663, 3583},
+    {458, 337, 662, 3588},
+    {457, 336, 662, 3590},
+    {455, 334, 662, 3588},
+    {454, 332, 663, 3583},
+    {452, 330, 663, 3575},
+    {449, 328, 665, 3565},
+    {447, 325, 666, 3553},
+    {444, 323, 668, 3540},
+    {441, 321, 669, 3526},
+    {438, 318, 671, 3512},
+    {435, 316, 673, 3498},
+    {432, 314, 675, 3485},
+    {429, 312, 676, 3473},
+    {427, 310, 677, 3462},
+    {425, 308, 678, 3453},
+    {422, 307, 679, 3446},
+    {421, 306, 680, 3442},
+    {419, 305, 680, 3441},
+    {418, 305, 680, 3442},
+    {417, 305, 679, 3446},
+    {416, 305, 678, 3452},
+    {416, 305, 677, 3462},
+    {416, 306, 676, 3473},
+    {416, 307, 674, 3488},
+    {417, 308, 672, 3504},
+    {418, 310, 670, 3522},
+    {418, 311, 668, 3541},
+    {419, 313, 665, 3561},
+    {420, 315, 663, 3582},
+    {421, 317, 660, 3603},
+    {422, 319, 658, 3623},
+    {422, 321, 655, 3642},
+    {423, 323, 653, 3660},
+    {423, 325, 651, 3675},
+    {423, 326, 650, 3688},
+    {422, 328, 648, 3698},
+    {421, 329, 648, 3705},
+    {420, 330, 647, 3708},
+    {418, 331, 647, 3707},
+    {416, 331, 648, 3701},
+    {413, 331, 649, 3691},
+    {410, 331, 651, 3677},
+    {406, 330, 653, 3657},
+    {401, 329, 656, 3633},
+    {397, 327, 660, 3604},
+    {391, 325, 664, 3571},
+    {386, 323, 669, 3534},
+    {379, 321, 674, 3492},
+    {373, 318, 679, 3447},
+    {366, 315, 685, 3399},
+    {359, 311, 691, 3349},
+    {352, 308, 698, 3296},
+    {345, 304, 704, 3241},
+    {337, 300, 711, 3185},
+    {330, 296, 718, 3129},
+    {323, 292, 725, 3074},
+    {316, 289, 731, 3019},
+    {309, 285, 738, 2965},
+    {302, 282, 744, 2914},
+    {296, 278, 750, 2865},
+    {290, 275, 756, 2819},
+    {284, 273, 761, 2777},
+    {279, 270, 766, 2739},
+    {274, 269, 770, 2705},
+    {270, 267, 773, 2676},
+    {267, 266, 776, 2652},
+    {264, 266, 778, 2633},
+    {261, 266, 780, 2620},
+    {260, 267, 781, 2611},
+    {258, 268, 782, 2609},
+    {257, 270, 781, 2611},
+    {257, 272, 780, 2618},
+    {257, 275, 779, 2629},
+    {258, 278, 777, 2646},
+    {259, 282, 775, 2666},
+    {260, 286, 772, 2689},
+    {262, 291, 768, 2716},
+    {263, 296, 765, 2745},
+    {265, 301, 761, 2776},
+    {268, 306, 757, 2809},
+    {270, 312, 753, 2842},
+    {272, 317, 749, 2876},
+    {274, 323, 745, 2910},
+    {276, 328, 741, 2943},
+    {278, 334, 737, 2975},
+    {280, 339, 733, 3005},
+    {282, 344, 730, 3034},
+    {284, 349, 726, 3060},
+    {285, 354, 724, 3083},
+    {286, 358, 721, 3103},
+    {287, 362, 719, 3120},
+    {287, 365, 717, 3135},
+    {287, 369, 716, 3146},
+    {287, 371, 715, 3153},
+    {287, 374, 714, 3158},
+    {287, 376, 714, 3160},
+    {286, 378, 714, 3160},
+    {285, 379, 715, 3157},
+    {284, 380, 715, 3152},
+    {283, 381, 716, 3145},
+    {281, 382, 717, 3138},
+    {280, 383, 718, 3129},
+    {279, 383, 719, 3121},
+    {277, 384, 720, 3112},
+    {276, 384, 721, 3104},
+    {275, 385, 722, 3098},
+    {274, 386, 722, 3093},
+    {274, 387, 723, 3090},
+    {273, 388, 723, 3090},
+    {273, 390, 722, 3092},
+    {274, 392, 722, 3097},
+    {274, 394, 721, 3106},
+    {275, 397, 719, 3119},
+    {276, 400, 717, 3135},
+    {278, 404, 715, 3155},
+    {280, 408, 712, 3178},
+    {282, 413, 709, 3205},
+    {285, 418, 705, 3236},
+    {287, 423, 701, 3270},
+    {291, 429, 696, 3306},
+    {294, 435, 691, 3346},
+    {298, 441, 686, 3387},
+    {302, 447, 681, 3431},
+    {306, 454, 676, 3475},
+    {310, 461, 670, 3520},
+    {314, 467, 665, 3565},
+    {318, 474, 659, 3610},
+    {322, 480, 654, 3654},
+    {326, 486, 649, 3696},
+    {330, 492, 644, 3736},
+    {334, 497, 639, 3773},
+    {337, 501, 635, 3806},
+    {340, 506, 632, 3836},
+    {343, 509, 628, 3862},
+    {345, 512, 626, 3883},
+    {347, 514, 624, 3899},
+    {349, 515, 623, 3909},
+    {350, 516, 622, 3914},
+    {351, 516, 622, 3914},
+    {351, 515, 623, 3908},
+    {351, 513, 624, 3896},
+    {350, 510, 626, 3879},
+    {349, 507, 629, 3857},
+    {347, 502, 632, 3829},
+    {345, 498, 636, 3797},
+    {343, 492, 641, 3760},
+    {340, 486, 646, 3720},
+    {337, 479, 651, 3676},
+    {333, 472, 657, 3629},
+    {330, 465, 663, 3579},
+    {326, 457, 669, 3528},
+    {322, 450, 676, 3475},
+    {318, 442, 682, 3422},
+    {314, 434, 689, 3369},
+    {310, 426, 695, 3316},
+    {306, 418, 701, 3264},
+    {303, 411, 708, 3214},
+    {299, 403, 713, 3167},
+    {296, 396, 719, 3121},
+    {293, 390, 724, 3079},
+    {290, 383, 729, 3040},
+    {288, 378, 733, 3004},
+    {286, 372, 737, 2972},
+    {284, 367, 741, 2944},
+    {283, 363, 744, 2920},
+    {282, 359, 746, 2899},
+    {282, 355, 748, 2882},
+    {282, 352, 750, 2869},
+    {282, 350, 751, 2859},
+    {282, 347, 752, 2853},
+    {283, 345, 752, 2849},
+    {284, 344, 752, 2847},
+    {285, 342, 752, 2848},
+    {287, 341, 752, 2850},
+    {288, 339, 752, 2853},
+    {290, 338, 751, 2856},
+    {291, 337, 751, 2860},
+    {293, 335, 750, 2863},
+    {294, 334, 750, 2866},
+    {296, 332, 750, 2867},
+    {297, 331, 750, 2866},
+    {298, 329, 750, 2864},
+    {299, 326, 751, 2859},
+    {299, 324, 752, 2851},
+    {299, 321, 753, 2840},
+    {299, 317, 755, 2827},
+    {299, 314, 757, 2810},
+    {298, 310, 759, 2791},
+    {297, 305, 762, 2768},
+    {295, 301, 765, 2742},
+    {293, 296, 769, 2714},
+    {291, 291, 772, 2683},
+    {289, 286, 776, 2651},
+    {286, 280, 781, 2616},
+    {284, 275, 785, 2580},
+    {281, 269, 789, 2544},
+    {278, 264, 794, 2507},
+    {275, 258, 798, 2470},
+    {272, 253, 803, 2434},
+    {269, 248, 807, 2399},
+    {267, 243, 811, 2366},
+    {264, 239, 815, 2335},
+    {262, 234, 818, 2307},
+    {260, 231, 821, 2282},
+    {259, 227, 824, 2261},
+    {258, 224, 826, 2245},
+    {258, 222, 827, 2232},
+    {258, 220, 828, 2225},
+    {259, 218, 829, 2223},
+    {260, 217, 828, 2225},
+    {262, 217, 827, 2233},
+    {264, 217, 826, 2246},
+    {267, 218, 823, 2265},
+    {271, 219, 821, 2288},
+    {275, 220, 817, 2316},
+    {280, 222, 813, 2349},
+    {286, 225, 809, 2386},
+    {291, 228, 804, 2426},
+    {298, 231, 798, 2470},
+    {304, 234, 793, 2516},
+    {311, 237, 787, 2565},
+    {318, 241, 781, 2615},
+    {326, 245, 774, 2666},
+    {333, 248, 768, 2718},
+    {340, 252, 762, 2769},
+    {347, 256, 756, 2819},
+    {355, 259, 750, 2868},
+    {361, 263, 744, 2915},
+    {368, 266, 739, 2959},
+    {374, 269, 734, 3000},
+    {380, 272, 729, 3038},
+    {385, 274, 725, 3072},
+    {390, 276, 721, 3101},
+    {394, 278, 718, 3126},
+    {397, 279, 716, 3147},
+    {400, 280, 714, 3162},
+    {403, 280, 713, 3173},
+    {404, 280, 712, 3179},
+    {405, 280, 712, 3180},
+    {406, 280, 712, 3177},
+    {406, 279, 713, 3170},
+    {405, 278, 714, 3158},
+    {404, 276, 716, 3143},
+    {402, 275, 718, 3125},
+    {400, 273, 721, 3104},
+    {398, 271, 724, 3080},
+    {395, 269, 727, 3055},
+    {393, 267, 730, 3029},
+    {390, 265, 734, 3001},
+    {387, 262, 737, 2974},
+    {384, 260, 740, 2947},
+    {381, 259, 743, 2920},
+    {378, 257, 747, 2895},
+    {375, 255, 749, 2871},
+    {373, 254, 752, 2849},
+    {371, 253, 755, 2829},
+    {369, 252, 757, 2812},
+    {367, 251, 758, 2798},
+    {366, 251, 760, 2786},
+    {365, 251, 761, 2777},
+    {364, 251, 762, 2771},
+    {364, 252, 762, 2767},
+    {364, 252, 762, 2766},
+    {365, 253, 762, 2768},
+    {365, 255, 762, 2772},
+    {366, 256, 761, 2777},
+    {367, 258, 760, 2784},
+    {368, 260, 759, 2791},
+    {369, 262, 758, 2800},
+    {370, 264, 757, 2808},
+    {371, 266, 756, 2816},
+    {372, 268, 755, 2822},
+    {373, 270, 755, 2828},
+    {373, 271, 754, 2831},
+    {373, 273, 754, 2832},
+    {373, 274, 754, 2830},
+    {372, 275, 755, 2825},
+    {370, 276, 756, 2817},
+    {369, 276, 758, 2804},
+    {366, 276, 760, 2787},
+    {363, 275, 762, 2766},
+    {359, 274, 765, 2741},
+    {355, 273, 769, 2711},
+    {350, 271, 773, 2676},
+    {345, 268, 778, 2637},
+    {339, 266, 783, 2594},
+    {332, 262, 789, 2547},
+    {325, 259, 795, 2496},
+    {318, 255, 802, 2442},
+    {310, 250, 809, 2386},
+    {302, 245, 816, 2327},
+    {293, 240, 823, 2266},
+    {285, 235, 831, 2203},
+    {276, 230, 839, 2141},
+    {268, 224, 846, 2078},
+    {259, 219, 854, 2015},
+    {251, 213, 861, 1954},
+    {243, 208, 869, 1895},
+    {235, 203, 876, 1837},
+    {227, 198, 882, 1783},
+    {221, 194, 888, 1732},
+    {214, 190, 894, 1686},
+    {208, 186, 899, 1643},
+    {203, 183, 904, 1605},
+    {198, 180, 908, 1572},
+    {194, 178, 911, 1545},
+    {191, 176, 914, 1522},
+    {188, 175, 916, 1506},
+    {186, 175, 918, 1494},
+    {185, 175, 918, 1488},
+    {185, 175, 918, 1487},
+    {185, 177, 918, 1491},
+    {185, 179, 917, 1500},
+    {186, 181, 915, 1514},
+    {188, 184, 913, 1531},
+    {190, 188, 911, 1552},
+    {192, 191, 908, 1575},
+    {195, 195, 904, 1602},
+    {197, 200, 901, 1630},
+    {200, 204, 897, 1660},
+    {203, 209, 894, 1690},
+    {206, 213, 890, 1721},
+    {209, 218, 886, 1751},
+    {212, 223, 883, 1781},
+    {215, 227, 879, 1810},
+    {217, 231, 876, 1837},
+    {219, 235, 873, 1861},
+    {221, 239, 870, 1884},
+    {222, 242, 868, 1903},
+    {224, 245, 866, 1920},
+    {224, 247, 864, 1933},
+    {225, 249, 863, 1943},
+    {225, 251, 862, 1950},
+    {224, 252, 861, 1954},
+    {223, 252, 861, 1954},
+    {222, 253, 862, 1952},
+    {221, 253, 862, 1947},
+    {219, 252, 863, 1940},
+    {217, 251, 864, 1930},
+    {215, 250, 866, 1919},
+    {213, 249, 867, 1907},
+    {210, 248, 869, 1894},
+    {208, 247, 870, 1881},
+    {206, 245, 872, 1868},
+    {203, 244, 873, 1855},
+    {201, 243, 875, 1844},
+    {199, 241, 876, 1834},
+    {198, 241, 877, 1826},
+    {196, 240, 878, 1821},
+    {195, 240, 878, 1819},
+    {194, 240, 878, 1819},
+    {194, 240, 877, 1823},
+    {194, 241, 877, 1830},
+    {194, 243, 875, 1841},
+    {195, 244, 874, 1855},
+    {196, 247, 871, 1873},
+    {197, 249, 869, 1894},
+    {199, 252, 866, 1919},
+    {201, 256, 862, 1947},
+    {203, 260, 859, 1977},
+    {206, 264, 855, 2010},
+    {209, 268, 850, 2045},
+    {211, 272, 846, 2082},
+    {214, 277, 841, 2120},
+    {217, 281, 837, 2158},
+    {220, 286, 832, 2196},
+    {223, 290, 827, 2233},
+    {226, 294, 823, 2270},
+    {228, 298, 819, 2304},
+    {231, 301, 815, 2336},
+    {232, 304, 811, 2366},
+};
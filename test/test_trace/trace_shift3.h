@@ -0,0 +1,474 @@
+// Generated by tools/trace_encode.py; do not edit. Regenerate with
+//   tools/trace_encode.py --synth 4 --seed 2 --block 48 --shift 3 /dev/null --c-header test/test_trace/trace_shift3.h
+#pragma once
+#include <stdint.h>
+
+static const uint8_t TRACE_SHIFT3_DATA[1000] = {
+    0x46, 0x54, 0x52, 0x43, 0x02, 0x04, 0x64, 0x00, 0x90, 0x01, 0x00, 0x00, 0x30, 0x00, 0x03, 0x00,
+    0x09, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x15, 0x01, 0x00, 0x00,
+    0x86, 0x01, 0x00, 0x00, 0xfe, 0x01, 0x00, 0x00, 0x6a, 0x02, 0x00, 0x00, 0xd5, 0x02, 0x00, 0x00,
+    0x46, 0x03, 0x00, 0x00, 0xc1, 0x03, 0x00, 0x00, 0x1d, 0x00, 0x16, 0x00, 0x6d, 0x00, 0xee, 0x00,
+    0x02, 0xe1, 0x21, 0x12, 0x28, 0x22, 0xe1, 0x21, 0x12, 0x1e, 0x02, 0xc1, 0x01, 0x12, 0x1c, 0x22,
+    0xc0, 0x21, 0x10, 0x1a, 0x22, 0x80, 0x01, 0x10, 0x18, 0x22, 0x80, 0x01, 0x10, 0x26, 0x02, 0x04,
+    0x00, 0x04, 0x00, 0x02, 0x02, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x01, 0x02, 0x01, 0x00, 0x11, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x02, 0x02, 0x02, 0x00, 0x24, 0x00, 0x04, 0x12, 0x26,
+    0x00, 0x04, 0x02, 0x06, 0x10, 0x18, 0x22, 0x60, 0x20, 0x61, 0x02, 0x80, 0x01, 0x12, 0x26, 0x00,
+    0x18, 0x20, 0x60, 0x22, 0x61, 0x2e, 0x00, 0x29, 0x00, 0x5f, 0x00, 0x5d, 0x01, 0x20, 0x60, 0x02,
+    0x41, 0x00, 0x40, 0x20, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x10, 0x20, 0x10, 0x00, 0x10, 0x11,
+    0x52, 0x00, 0x30, 0x00, 0x70, 0x01, 0x72, 0x11, 0x70, 0x00, 0x92, 0x11, 0x21, 0x19, 0x01, 0xb0,
+    0x11, 0x21, 0x1b, 0x11, 0xb2, 0x01, 0x00, 0x1b, 0x11, 0xd2, 0x11, 0x21, 0x1b, 0x01, 0xb2, 0x11,
+    0x21, 0x1b, 0x11, 0xb0, 0x01, 0x20, 0x1b, 0x11, 0x92, 0x11, 0x00, 0x07, 0x21, 0x19, 0x01, 0x50,
+    0x10, 0x50, 0x01, 0x52, 0x00, 0x10, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x20,
+    0x00, 0x40, 0x20, 0x61, 0x00, 0x60, 0x22, 0x60, 0x00, 0x81, 0x01, 0x02, 0x18, 0x02, 0xa1, 0x01,
+    0x12, 0x18, 0x02, 0xa0, 0x01, 0x22, 0x00, 0x25, 0x00, 0x67, 0x00, 0x19, 0x01, 0x22, 0x80, 0x01,
+    0x10, 0x1a, 0x22, 0x80, 0x01, 0x10, 0x1a, 0x20, 0x80, 0x21, 0x10, 0x18, 0x00, 0x60, 0x20, 0x61,
+    0x00, 0x60, 0x02, 0x40, 0x00, 0x41, 0x20, 0x40, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x10, 0x20,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x40, 0x00, 0x21, 0x00, 0x40, 0x00, 0x60, 0x00, 0x60,
+    0x22, 0x81, 0x01, 0x00, 0x18, 0x00, 0x81, 0x21, 0x12, 0x1a, 0x00, 0xc0, 0x01, 0x10, 0x1a, 0x22,
+    0xc1, 0x01, 0x00, 0x1e, 0x22, 0xe1, 0x01, 0x10, 0x1c, 0x22, 0xe1, 0x21, 0x10, 0x1e, 0x20, 0xe1,
+    0x21, 0x00, 0x1e, 0x20, 0xc1, 0x01, 0x2c, 0x00, 0x2f, 0x00, 0x55, 0x00, 0xaf, 0x01, 0x20, 0xc1,
+    0x01, 0x00, 0x1a, 0x02, 0xa1, 0x01, 0x12, 0x1a, 0x00, 0x80, 0x01, 0x00, 0x06, 0x10, 0x06, 0x00,
+    0x04, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x03, 0x00, 0x03, 0x21, 0x15, 0x00,
+    0x05, 0x01, 0x97, 0x19, 0x9b, 0xe1, 0x1b, 0xff, 0x1b, 0x24, 0xa3, 0x24, 0x34, 0x4a, 0x24, 0x83,
+    0x24, 0x34, 0x48, 0x24, 0xe1, 0x23, 0x34, 0x3e, 0x22, 0xc3, 0x43, 0x32, 0x3c, 0x22, 0xc1, 0x23,
+    0x34, 0x3a, 0x22, 0xa3, 0x23, 0x12, 0x3a, 0x22, 0xc3, 0x43, 0x12, 0x3a, 0x22, 0xa3, 0x23, 0x32,
+    0x3a, 0x22, 0xa1, 0x23, 0x34, 0x3c, 0x22, 0xc3, 0x43, 0x12, 0x3c, 0x22, 0xe3, 0x03, 0x10, 0x18,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x40, 0x00, 0x20, 0x20, 0x21, 0x22, 0x00,
+    0x22, 0x00, 0x5b, 0x00, 0x7c, 0x01, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x11, 0x10, 0x00, 0x30, 0x00, 0x32, 0x00, 0x50, 0x00, 0x30,
+    0x01, 0x72, 0x10, 0x50, 0x00, 0x72, 0x00, 0x70, 0x01, 0x52, 0x10, 0x70, 0x00, 0x72, 0x01, 0x70,
+    0x10, 0x70, 0x00, 0x72, 0x00, 0x50, 0x01, 0x52, 0x00, 0x30, 0x00, 0x30, 0x00, 0x10, 0x00, 0x10,
+    0x00, 0x10, 0x00, 0x20, 0x00, 0x20, 0x22, 0x40, 0x00, 0x40, 0x00, 0x61, 0x22, 0x80, 0x01, 0x10,
+    0x18, 0x22, 0xa0, 0x01, 0x12, 0x1a, 0x22, 0xc1, 0x21, 0x00, 0x1c, 0x20, 0xe1, 0x21, 0x12, 0x1c,
+    0x22, 0x81, 0x22, 0x12, 0x1e, 0x20, 0xe1, 0x21, 0x02, 0x1e, 0x27, 0x00, 0x2a, 0x00, 0x58, 0x00,
+    0x99, 0x01, 0x22, 0xe1, 0x21, 0x12, 0x1c, 0x20, 0xe1, 0x21, 0x12, 0x1c, 0x02, 0xa0, 0x21, 0x12,
+    0x1c, 0x20, 0x80, 0x21, 0x12, 0x18, 0x00, 0x80, 0x21, 0x12, 0x06, 0x02, 0x24, 0x00, 0x04, 0x00,
+    0x02, 0x02, 0x02, 0x00, 0x20, 0x00, 0x00, 0x02, 0x01, 0x00, 0x01, 0x00, 0x03, 0x00, 0x03, 0x00,
+    0x03, 0x20, 0x03, 0x00, 0x03, 0x00, 0x03, 0x20, 0x03, 0x00, 0x05, 0x00, 0x03, 0x00, 0x01, 0x00,
+    0x03, 0x20, 0x01, 0x02, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x02, 0x02, 0x00,
+    0x22, 0x10, 0x04, 0x02, 0x02, 0x00, 0x24, 0x02, 0x04, 0x00, 0x24, 0x12, 0x04, 0x00, 0x24, 0x00,
+    0x04, 0x02, 0x04, 0x10, 0x04, 0x36, 0x00, 0x3c, 0x00, 0x51, 0x00, 0xce, 0x01, 0x00, 0x20, 0x00,
+    0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x30, 0x00, 0x32, 0x00, 0x50, 0x11,
+    0x70, 0x00, 0x72, 0x10, 0x92, 0x11, 0x00, 0x19, 0x10, 0xb2, 0x11, 0x21, 0x1b, 0x10, 0xb0, 0x11,
+    0x21, 0x1d, 0x11, 0xd2, 0x11, 0x21, 0x1d, 0x00, 0xf2, 0x11, 0x21, 0x1d, 0x11, 0xd2, 0x11, 0x21,
+    0x1f, 0x11, 0xd0, 0x01, 0x21, 0x1b, 0x11, 0xd2, 0x11, 0x21, 0x1b, 0x10, 0x90, 0x11, 0x21, 0x19,
+    0x00, 0x92, 0x11, 0x01, 0x05, 0x00, 0x07, 0x21, 0x03, 0x00, 0x03, 0x00, 0x01, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x24, 0x10, 0x04, 0x00, 0x26, 0x00, 0x06, 0x12, 0x18, 0x02,
+    0x60, 0x00, 0x81, 0x21, 0x02, 0x18, 0x2d, 0x00, 0x2b, 0x00, 0x5f, 0x00, 0x59, 0x01, 0x9b, 0xf1,
+    0x18, 0x98, 0x91, 0x99, 0x41, 0x32, 0x3e, 0x44, 0xe1, 0x43, 0x34, 0x3e, 0x44, 0x83, 0x44, 0x34,
+    0x3e, 0x24, 0x83, 0x44, 0x34, 0x3e, 0x44, 0x83, 0x44, 0x34, 0x48, 0x24, 0xe3, 0x43, 0x14, 0x3e,
+    0x44, 0x83, 0x44, 0x32, 0x3e, 0x44, 0xc3, 0x43, 0x32, 0x3e, 0x44, 0xc1, 0x43, 0x32, 0x3c, 0x44,
+    0xa3, 0x23, 0x12, 0x3c, 0x24, 0xa3, 0x43, 0x34, 0x3c, 0x00, 0x40, 0x10, 0x10, 0x00, 0x10, 0x00,
+    0x10, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x40, 0x00, 0x20, 0x00, 0x40, 0x00,
+    0x61, 0x02, 0x60, 0x00, 0x81, 0x01, 0x00, 0x18, 0x02, 0x81, 0x01, 0x00, 0x18, 0x22, 0xa1, 0x01,
+    0x00, 0x1a, 0x02, 0xc1, 0x01, 0x12, 0x1a, 0x02, 0xa0, 0x21, 0x10, 0x1a, 0x00, 0xa0, 0x21, 0x12,
+    0x1a, 0x37, 0x00, 0x2a, 0x00, 0x54, 0x00, 0xb3, 0x01, 0x00, 0x80, 0x21, 0x10, 0x18, 0x00, 0x60,
+    0x00, 0x60, 0x00, 0x41, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x11, 0x30, 0x00, 0x32,
+    0x01, 0x30, 0x10, 0x70, 0x01, 0x72, 0x10, 0x70,
+};
+
+// Reference decoding, frame by frame: w1, w2, red, strip
+static const uint16_t TRACE_SHIFT3_FRAMES[400][4] = {
+    {232, 176, 872, 1904},
+    {240, 176, 864, 1960},
+    {248, 184, 856, 2024},
+    {256, 192, 848, 2080},
+    {264, 200, 840, 2136},
+    {272, 200, 832, 2184},
+    {272, 208, 824, 2232},
+    {280, 216, 824, 2280},
+    {288, 216, 816, 2320},
+    {296, 224, 816, 2352},
+    {296, 224, 808, 2384},
+    {304, 232, 808, 2416},
+    {304, 232, 800, 2440},
+    {312, 240, 800, 2456},
+    {312, 240, 800, 2472},
+    {312, 240, 800, 2480},
+    {312, 248, 800, 2488},
+    {320, 248, 800, 2488},
+    {320, 248, 800, 2488},
+    {320, 248, 800, 2488},
+    {320, 248, 800, 2480},
+    {320, 248, 800, 2480},
+    {320, 248, 800, 2472},
+    {320, 248, 800, 2464},
+    {320, 256, 800, 2456},
+    {320, 256, 800, 2448},
+    {312, 256, 800, 2440},
+    {312, 256, 800, 2432},
+    {312, 256, 800, 2432},
+    {312, 256, 800, 2432},
+    {320, 256, 800, 2432},
+    {320, 264, 800, 2432},
+    {320, 264, 800, 2440},
+    {320, 264, 800, 2448},
+    {320, 272, 800, 2456},
+    {320, 272, 800, 2472},
+    {328, 272, 800, 2488},
+    {328, 280, 792, 2512},
+    {336, 280, 792, 2528},
+    {336, 288, 792, 2552},
+    {336, 288, 784, 2584},
+    {344, 296, 784, 2608},
+    {344, 304, 776, 2632},
+    {352, 304, 776, 2664},
+    {352, 312, 768, 2688},
+    {360, 312, 768, 2720},
+    {360, 320, 768, 2744},
+    {368, 328, 760, 2768},
+    {368, 328, 760, 2792},
+    {368, 336, 760, 2816},
+    {376, 336, 752, 2832},
+    {376, 336, 752, 2848},
+    {376, 344, 752, 2856},
+    {376, 344, 752, 2856},
+    {376, 344, 752, 2864},
+    {376, 344, 752, 2856},
+    {376, 352, 752, 2848},
+    {376, 352, 752, 2840},
+    {368, 344, 760, 2816},
+    {368, 344, 760, 2800},
+    {368, 344, 760, 2768},
+    {360, 344, 768, 2736},
+    {352, 336, 768, 2704},
+    {352, 336, 776, 2664},
+    {344, 328, 784, 2624},
+    {336, 328, 784, 2576},
+    {328, 320, 792, 2528},
+    {320, 312, 800, 2480},
+    {320, 312, 800, 2432},
+    {312, 304, 808, 2376},
+    {304, 296, 816, 2328},
+    {296, 296, 824, 2280},
+    {288, 288, 832, 2232},
+    {280, 280, 832, 2184},
+    {280, 280, 840, 2136},
+    {272, 272, 848, 2096},
+    {264, 272, 848, 2064},
+    {264, 264, 856, 2024},
+    {256, 264, 856, 2000},
+    {256, 256, 856, 1976},
+    {248, 256, 864, 1952},
+    {248, 256, 864, 1944},
+    {248, 256, 864, 1928},
+    {248, 256, 864, 1928},
+    {248, 256, 864, 1928},
+    {248, 256, 864, 1936},
+    {248, 256, 864, 1944},
+    {248, 256, 864, 1960},
+    {248, 264, 856, 1984},
+    {248, 264, 856, 2008},
+    {256, 272, 856, 2032},
+    {256, 272, 848, 2064},
+    {256, 280, 848, 2096},
+    {264, 280, 840, 2136},
+    {264, 288, 832, 2168},
+    {272, 288, 832, 2208},
+    {272, 296, 824, 2248},
+    {280, 304, 824, 2280},
+    {280, 304, 816, 2320},
+    {288, 312, 816, 2352},
+    {288, 312, 808, 2392},
+    {288, 320, 808, 2424},
+    {296, 320, 800, 2456},
+    {296, 320, 800, 2480},
+    {296, 328, 792, 2504},
+    {296, 328, 792, 2528},
+    {304, 328, 792, 2544},
+    {304, 328, 784, 2560},
+    {304, 336, 784, 2576},
+    {304, 336, 784, 2584},
+    {304, 336, 784, 2592},
+    {304, 336, 784, 2592},
+    {304, 328, 784, 2600},
+    {296, 328, 784, 2600},
+    {296, 328, 784, 2600},
+    {296, 328, 784, 2600},
+    {296, 328, 784, 2592},
+    {296, 328, 784, 2592},
+    {296, 320, 784, 2592},
+    {288, 320, 784, 2592},
+    {288, 320, 784, 2592},
+    {288, 320, 784, 2592},
+    {288, 320, 784, 2600},
+    {288, 320, 784, 2600},
+    {288, 320, 784, 2616},
+    {288, 320, 776, 2624},
+    {288, 320, 776, 2640},
+    {288, 320, 776, 2664},
+    {288, 320, 776, 2688},
+    {296, 328, 768, 2720},
+    {296, 328, 768, 2752},
+    {296, 328, 760, 2784},
+    {304, 336, 752, 2824},
+    {304, 336, 752, 2872},
+    {304, 336, 744, 2912},
+    {312, 344, 736, 2960},
+    {312, 344, 736, 3016},
+    {320, 352, 728, 3072},
+    {320, 352, 720, 3120},
+    {328, 360, 712, 3176},
+    {336, 360, 704, 3232},
+    {336, 368, 696, 3288},
+    {344, 368, 696, 3344},
+    {344, 376, 688, 3392},
+    {352, 376, 680, 3448},
+    {352, 384, 672, 3496},
+    {352, 384, 672, 3536},
+    {360, 384, 664, 3576},
+    {360, 392, 656, 3616},
+    {360, 392, 656, 3648},
+    {360, 392, 656, 3672},
+    {360, 392, 648, 3696},
+    {360, 392, 648, 3712},
+    {360, 384, 648, 3720},
+    {360, 384, 648, 3720},
+    {360, 384, 648, 3720},
+    {360, 384, 648, 3720},
+    {352, 376, 648, 3704},
+    {352, 376, 648, 3688},
+    {352, 368, 656, 3664},
+    {344, 368, 656, 3640},
+    {344, 360, 656, 3608},
+    {48, 56, 1032, 536},
+    {64, 64, 1016, 672},
+    {72, 80, 1000, 808},
+    {88, 88, 984, 936},
+    {96, 104, 968, 1064},
+    {112, 112, 960, 1184},
+    {120, 128, 944, 1304},
+    {128, 136, 928, 1416},
+    {144, 144, 912, 1528},
+    {152, 152, 904, 1640},
+    {160, 168, 888, 1744},
+    {168, 176, 872, 1848},
+    {176, 184, 864, 1952},
+    {184, 192, 848, 2064},
+    {200, 200, 840, 2168},
+    {208, 208, 824, 2272},
+    {216, 216, 808, 2376},
+    {224, 224, 800, 2480},
+    {232, 240, 784, 2592},
+    {240, 248, 768, 2704},
+    {256, 256, 760, 2816},
+    {264, 264, 744, 2936},
+    {264, 264, 736, 2968},
+    {264, 264, 736, 2968},
+    {264, 264, 736, 2976},
+    {264, 264, 736, 2984},
+    {264, 264, 736, 2992},
+    {264, 264, 736, 3008},
+    {264, 264, 736, 3016},
+    {264, 272, 728, 3024},
+    {272, 272, 728, 3040},
+    {272, 272, 728, 3048},
+    {272, 272, 728, 3056},
+    {272, 272, 728, 3064},
+    {272, 272, 728, 3064},
+    {272, 272, 728, 3064},
+    {272, 272, 728, 3064},
+    {272, 272, 728, 3056},
+    {272, 272, 728, 3048},
+    {264, 264, 728, 3040},
+    {264, 264, 728, 3024},
+    {264, 264, 736, 3008},
+    {264, 264, 736, 2984},
+    {264, 264, 736, 2968},
+    {256, 264, 744, 2936},
+    {256, 256, 744, 2912},
+    {256, 256, 752, 2880},
+    {256, 256, 752, 2848},
+    {248, 256, 760, 2824},
+    {248, 248, 760, 2792},
+    {248, 248, 768, 2760},
+    {240, 248, 768, 2728},
+    {240, 240, 768, 2696},
+    {240, 240, 776, 2664},
+    {240, 240, 776, 2640},
+    {232, 240, 784, 2616},
+    {232, 240, 784, 2600},
+    {232, 240, 784, 2584},
+    {232, 240, 784, 2576},
+    {232, 240, 784, 2568},
+    {232, 240, 784, 2560},
+    {232, 240, 784, 2568},
+    {232, 240, 784, 2576},
+    {240, 248, 784, 2592},
+    {240, 248, 784, 2608},
+    {240, 248, 776, 2632},
+    {248, 256, 776, 2664},
+    {248, 256, 768, 2696},
+    {256, 264, 768, 2736},
+    {256, 272, 760, 2776},
+    {264, 280, 752, 2824},
+    {272, 280, 752, 2872},
+    {272, 288, 744, 2928},
+    {280, 296, 736, 2976},
+    {288, 304, 728, 3040},
+    {296, 312, 720, 3096},
+    {296, 320, 712, 3152},
+    {304, 328, 712, 3208},
+    {312, 336, 704, 3272},
+    {320, 344, 696, 3328},
+    {328, 352, 688, 3376},
+    {328, 360, 680, 3432},
+    {336, 368, 672, 3480},
+    {344, 368, 672, 3520},
+    {352, 376, 664, 3568},
+    {352, 384, 664, 3600},
+    {360, 392, 656, 3632},
+    {360, 392, 656, 3664},
+    {368, 400, 648, 3688},
+    {368, 408, 648, 3704},
+    {376, 408, 648, 3720},
+    {376, 408, 648, 3728},
+    {376, 416, 648, 3736},
+    {376, 416, 648, 3736},
+    {384, 416, 648, 3736},
+    {384, 424, 648, 3728},
+    {384, 424, 648, 3720},
+    {384, 424, 648, 3704},
+    {384, 424, 648, 3688},
+    {384, 424, 648, 3672},
+    {384, 424, 656, 3656},
+    {384, 424, 656, 3640},
+    {384, 424, 656, 3624},
+    {384, 424, 664, 3608},
+    {384, 424, 664, 3584},
+    {384, 424, 664, 3568},
+    {384, 424, 664, 3560},
+    {384, 424, 664, 3544},
+    {384, 424, 672, 3536},
+    {384, 432, 672, 3528},
+    {384, 432, 672, 3520},
+    {384, 432, 672, 3520},
+    {384, 432, 672, 3520},
+    {392, 432, 672, 3520},
+    {392, 440, 672, 3528},
+    {392, 440, 672, 3536},
+    {400, 440, 664, 3552},
+    {400, 448, 664, 3560},
+    {400, 448, 664, 3576},
+    {408, 456, 664, 3592},
+    {408, 456, 664, 3608},
+    {416, 464, 656, 3624},
+    {416, 464, 656, 3640},
+    {424, 464, 656, 3656},
+    {424, 472, 656, 3672},
+    {424, 472, 648, 3688},
+    {432, 480, 648, 3696},
+    {432, 480, 648, 3704},
+    {432, 480, 648, 3712},
+    {440, 480, 648, 3712},
+    {440, 480, 648, 3712},
+    {440, 480, 648, 3704},
+    {440, 480, 648, 3696},
+    {440, 480, 648, 3680},
+    {440, 480, 656, 3664},
+    {440, 480, 656, 3640},
+    {432, 472, 656, 3608},
+    {432, 472, 664, 3576},
+    {432, 464, 672, 3536},
+    {424, 464, 672, 3496},
+    {424, 456, 680, 3448},
+    {416, 448, 688, 3400},
+    {416, 440, 688, 3352},
+    {408, 432, 696, 3296},
+    {400, 424, 704, 3240},
+    {392, 416, 712, 3184},
+    {392, 416, 720, 3120},
+    {384, 408, 728, 3064},
+    {376, 400, 736, 3008},
+    {368, 392, 744, 2944},
+    {360, 384, 744, 2888},
+    {360, 376, 752, 2840},
+    {352, 368, 760, 2784},
+    {344, 360, 768, 2736},
+    {344, 352, 768, 2696},
+    {336, 344, 776, 2656},
+    {336, 344, 784, 2616},
+    {328, 336, 784, 2592},
+    {328, 336, 784, 2560},
+    {328, 328, 792, 2544},
+    {328, 328, 792, 2528},
+    {328, 328, 792, 2520},
+    {328, 328, 792, 2512},
+    {328, 328, 792, 2512},
+    {328, 328, 792, 2520},
+    {328, 328, 792, 2528},
+    {328, 328, 792, 2544},
+    {336, 328, 784, 2560},
+    {336, 328, 784, 2584},
+    {344, 328, 784, 2608},
+    {344, 336, 776, 2640},
+    {352, 336, 776, 2664},
+    {352, 336, 768, 2696},
+    {360, 344, 768, 2728},
+    {360, 344, 760, 2760},
+    {56, 56, 1048, 416},
+    {72, 64, 1032, 536},
+    {88, 80, 1024, 656},
+    {104, 96, 1008, 776},
+    {120, 112, 992, 904},
+    {136, 128, 976, 1024},
+    {152, 136, 960, 1152},
+    {168, 152, 944, 1272},
+    {184, 168, 928, 1400},
+    {200, 184, 912, 1528},
+    {216, 192, 896, 1648},
+    {232, 208, 888, 1768},
+    {248, 224, 872, 1896},
+    {264, 232, 856, 2016},
+    {280, 248, 840, 2128},
+    {296, 256, 824, 2248},
+    {312, 272, 816, 2360},
+    {328, 280, 800, 2472},
+    {344, 296, 784, 2576},
+    {352, 304, 776, 2688},
+    {368, 312, 760, 2792},
+    {384, 328, 744, 2904},
+    {384, 328, 744, 2920},
+    {384, 320, 744, 2912},
+    {384, 320, 744, 2904},
+    {384, 320, 744, 2896},
+    {376, 312, 744, 2896},
+    {376, 312, 744, 2896},
+    {376, 312, 744, 2896},
+    {376, 312, 744, 2904},
+    {384, 312, 744, 2920},
+    {384, 312, 744, 2928},
+    {384, 312, 744, 2944},
+    {384, 312, 736, 2968},
+    {392, 312, 736, 2992},
+    {392, 312, 728, 3024},
+    {392, 312, 728, 3056},
+    {400, 312, 720, 3088},
+    {400, 312, 720, 3120},
+    {408, 320, 712, 3160},
+    {408, 320, 712, 3200},
+    {416, 320, 704, 3248},
+    {416, 328, 696, 3288},
+    {424, 328, 696, 3328},
+    {432, 328, 688, 3368},
+    {432, 328, 688, 3408},
+    {440, 336, 680, 3448},
+    {440, 336, 672, 3480},
+    {440, 336, 672, 3512},
+    {448, 336, 664, 3544},
+    {448, 336, 664, 3568},
+    {448, 336, 664, 3592},
+    {448, 336, 656, 3608},
+    {448, 336, 656, 3616},
+    {448, 336, 656, 3624},
+    {448, 336, 656, 3624},
+    {448, 336, 656, 3624},
+    {440, 328, 656, 3608},
+    {440, 328, 664, 3592},
+    {432, 328, 664, 3576},
+    {432, 320, 664, 3544},
+    {424, 320, 672, 3512},
+    {424, 312, 672, 3480},
+};
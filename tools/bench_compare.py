@@ -0,0 +1,74 @@
+#!/usr/bin/env python3
+"""Compare two host benchmark runs and flag regressions.
+
+Reads the JSON written by the native benchmark target (bench/host_bench.cpp,
+`--json PATH`) for a baseline and a candidate run and compares median ns/op
+per benchmark:
+
+  tools/bench_compare.py base.json new.json
+  tools/bench_compare.py base.json new.json --threshold 5
+
+A benchmark regresses when its median is more than --threshold percent
+slower than the baseline AND the slowdown is larger than the noise of the
+two runs (--sigma times their combined standard deviation), so a jittery
+case does not fail on its own spread. Exits 1 if anything regressed, 0
+otherwise; benchmarks present in only one run are listed but never fail.
+"""
+
+import argparse
+import json
+import math
+import sys
+
+
+def load(path):
+    with open(path) as f:
+        doc = json.load(f)
+    if doc.get("schema") != 1:
+        sys.exit(f"{path}: unsupported schema {doc.get('schema')!r}")
+    return {b["name"]: b for b in doc["benchmarks"]}
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("baseline", help="JSON from the reference run")
+    ap.add_argument("candidate", help="JSON from the run under test")
+    ap.add_argument("--threshold", type=float, default=10.0,
+                    help="percent slowdown that counts as a regression (default 10)")
+    ap.add_argument("--sigma", type=float, default=2.0,
+                    help="slowdown must also exceed this many combined stddevs (default 2)")
+    args = ap.parse_args()
+
+    base = load(args.baseline)
+    cand = load(args.candidate)
+
+    regressions = 0
+    print(f"{'benchmark':<18} {'base ns/op':>12} {'new ns/op':>12} {'change':>8}")
+    for name in sorted(base.keys() & cand.keys(), key=list(base).index):
+        b, c = base[name], cand[name]
+        delta = c["median_ns"] - b["median_ns"]
+        pct = 100.0 * delta / b["median_ns"] if b["median_ns"] > 0 else 0.0
+        noise = args.sigma * math.hypot(b["stddev_ns"], c["stddev_ns"])
+        if pct > args.threshold and delta > noise:
+            verdict = "REGRESSED"
+            regressions += 1
+        elif -pct > args.threshold and -delta > noise:
+            verdict = "improved"
+        else:
+            verdict = ""
+        print(f"{name:<18} {b['median_ns']:>12.2f} {c['median_ns']:>12.2f} {pct:>+7.1f}%  {verdict}".rstrip())
+
+    for name in sorted(base.keys() - cand.keys()):
+        print(f"{name:<18} only in baseline")
+    for name in sorted(cand.keys() - base.keys()):
+        print(f"{name:<18} only in candidate")
+
+    if regressions:
+        print(f"{regressions} benchmark(s) more than {args.threshold:g}% slower")
+        return 1
+    print(f"no regressions beyond {args.threshold:g}%")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,332 @@
+#!/usr/bin/env python3
+"""Stream live frames to the firmware over USB serial, or loop them back locally.
+
+Packets follow src/stream.h: type, seq (LE), body, CRC-16/CCITT-FALSE (BE),
+COBS-encoded and 0x00-terminated. The first 0x00 switches the firmware's CLI
+port into stream mode; a STOP packet (or 2 s of silence) switches it back.
+
+  tools/stream_send.py /dev/ttyACM0 --fps 500 --seconds 10
+  tools/stream_send.py --loopback --loss 0.02 --corrupt 0.01
+
+Against a device it sends a moving test pattern at --fps, PINGs once a
+second and prints the device's counters: frames verified and shown, frames
+superseded by a newer one before the strip was free, and frames dropped or
+rejected on the way. --loopback runs the same packets through a reference
+decoder instead, with optional loss and corruption, and checks that every
+count and every delivered frame comes out exact. --c-header writes those wire
+bytes and the reference decoder's results as the fixture for the native
+StreamDecoder test (test/test_stream).
+"""
+
+import argparse
+import colorsys
+import os
+import random
+import struct
+import sys
+import time
+
+NUM_LEDS = 20            # must match config.h
+FRAME_BYTES = NUM_LEDS * 3 + 4 * 2
+CTRL_MAX = 32            # STREAM_CTRL_MAX in src/stream.h
+
+FRAME, BRIGHTNESS, PING, STOP, STATS = 0x01, 0x02, 0x03, 0x04, 0x81
+STATS_FIELDS = ("packets", "frames", "dropped", "crc_errors", "bad_packets", "shown", "superseded")
+STATS_FMT = struct.Struct("<7I")  # must match StreamStats in src/stream.h
+
+
+# ─── Packets ──────────────────────────────────────────────────────────────────
+
+def crc16(data, crc=0xFFFF):
+    for b in data:
+        crc ^= b << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) & 0xFFFF if crc & 0x8000 else (crc << 1) & 0xFFFF
+    return crc
+
+
+def cobs_encode(data):
+    out = bytearray([0])
+    code_at, code = 0, 1
+    for b in data:
+        if b == 0:
+            out[code_at] = code
+            code_at, code = len(out), 1
+            out.append(0)
+            continue
+        out.append(b)
+        code += 1
+        if code == 0xFF:
+            out[code_at] = code
+            code_at, code = len(out), 1
+            out.append(0)
+    out[code_at] = code
+    return bytes(out)
+
+
+def cobs_decode(data):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        code = data[i]
+        if code == 0 or i + code > len(data):
+            return None
+        out += data[i + 1:i + code]
+        i += code
+        if code != 0xFF and i < len(data):
+            out.append(0)
+    return bytes(out)
+
+
+def packet(ptype, seq, body=b""):
+    raw = struct.pack("<BH", ptype, seq & 0xFFFF) + body
+    return cobs_encode(raw + struct.pack(">H", crc16(raw))) + b"\x00"
+
+
+def parse(chunk):
+    """One delimited chunk (without the 0x00) -> (type, seq, body) or None."""
+    raw = cobs_decode(chunk)
+    if raw is None or len(raw) < 5 or crc16(raw) != 0:
+        return None
+    ptype, seq = struct.unpack_from("<BH", raw)
+    return ptype, seq, raw[3:-2]
+
+
+def frame_body(i, duty_level=0.25):
+    """Moving rainbow with a bright head, and slowly breathing PWM duties."""
+    px = bytearray()
+    head = i % NUM_LEDS
+    for p in range(NUM_LEDS):
+        r, g, b = colorsys.hsv_to_rgb(((i + p * 12) % 256) / 256.0, 1.0, 1.0 if p == head else 0.3)
+        px += bytes((int(r * 255), int(g * 255), int(b * 255)))
+    level = int(4095 * duty_level * (0.5 + 0.5 * ((i % 200) / 100.0 - 1) ** 2))
+    return bytes(px) + struct.pack("<4H", level, level, level // 2, level // 4)
+
+
+# ─── Loopback ─────────────────────────────────────────────────────────────────
+
+def max_packet(ptype):
+    """Longest decoded packet StreamDecoder buffers before calling it overlong."""
+    body = FRAME_BYTES if ptype == FRAME else CTRL_MAX
+    return 3 + body + 2
+
+
+class Decoder:
+    """Reference receiver with the same counting rules as StreamDecoder."""
+
+    def __init__(self):
+        self.buf = bytearray()
+        self.last_seq = None
+        self.stats = dict.fromkeys(STATS_FIELDS, 0)
+        self.frames = []
+
+    def feed(self, data):
+        for b in data:
+            if b:
+                self.buf.append(b)
+                continue
+            chunk, self.buf = bytes(self.buf), bytearray()
+            if not chunk:
+                continue
+            raw = cobs_decode(chunk)
+            if raw == b"":
+                continue  # a lone code byte decodes to nothing, like a bare delimiter
+            if raw is None or len(raw) < 5 or len(raw) > max_packet(raw[0]):
+                self.stats["bad_packets"] += 1
+                continue
+            if crc16(raw) != 0:
+                self.stats["crc_errors"] += 1
+                continue
+            ptype, seq = struct.unpack_from("<BH", raw)
+            body = raw[3:-2]
+            if ptype != FRAME or len(body) != FRAME_BYTES:
+                self.stats["bad_packets"] += 1
+                continue
+            if self.last_seq is not None:
+                gap = (seq - self.last_seq - 1) & 0xFFFF
+                if gap < 0x8000:
+                    self.stats["dropped"] += gap
+            self.last_seq = seq
+            self.stats["packets"] += 1
+            self.stats["frames"] += 1
+            self.frames.append((seq, body))
+
+
+def loopback(args):
+    rng = random.Random(args.seed)
+    dec = Decoder()
+    sent, lost, damaged, wire = {}, 0, 0, bytearray()
+    t0 = time.perf_counter()
+    for i in range(args.frames):
+        seq = (args.first_seq + i) & 0xFFFF
+        body = frame_body(i)
+        pkt = bytearray(packet(FRAME, seq, body))
+        sent[seq] = body
+        if rng.random() < args.loss:
+            lost += 1
+            continue
+        if rng.random() < args.corrupt:
+            k = rng.randrange(len(pkt) - 1)
+            pkt[k] = pkt[k] % 255 + 1  # any value but the delimiter
+            damaged += 1
+        dec.feed(pkt)
+        wire += pkt
+    secs = time.perf_counter() - t0
+
+    s = dec.stats
+    rejected = s["crc_errors"] + s["bad_packets"]
+    wrong = sum(1 for seq, body in dec.frames if sent[seq] != body)
+    print(f"loopback: {args.frames} frames, {len(wire) / args.frames:.1f} wire bytes/frame, "
+          f"{args.frames / secs:.0f} frames/s encode+decode in Python")
+    print(f"  verified={s['frames']}  dropped={s['dropped']}  crc={s['crc_errors']}  bad={s['bad_packets']}")
+    print(f"  injected: withheld={lost}  damaged={damaged}")
+    # The counted gaps miss losses before the first and after the last verified frame
+    if dec.frames:
+        last = (args.first_seq + args.frames - 1) & 0xFFFF
+        ends = ((dec.frames[0][0] - args.first_seq) & 0xFFFF) + ((last - dec.last_seq) & 0xFFFF)
+    else:
+        ends = args.frames
+    ok = (wrong == 0 and rejected == damaged and s["frames"] == args.frames - lost - damaged
+          and s["dropped"] + ends == lost + damaged)
+    if not ok:
+        sys.exit(f"loopback FAILED: {wrong} frames differ, {rejected} rejected of {damaged} damaged")
+    print("  OK: counts match and every verified frame is byte-exact")
+    if args.c_header:
+        write_c_header(args.c_header, wire, s, dec.frames)
+
+
+def write_c_header(path, wire, stats, frames):
+    name = os.path.splitext(os.path.basename(path))[0].upper()
+    with open(path, "w") as f:
+        f.write("// Generated by tools/stream_send.py; do not edit. Regenerate with\n")
+        f.write("//   tools/stream_send.py " + " ".join(sys.argv[1:]) + "\n")
+        f.write("#pragma once\n#include <stdint.h>\n\n")
+        f.write("// Wire bytes as received: withheld packets left out, damaged ones included\n")
+        f.write(f"static const uint8_t {name}_WIRE[{len(wire)}] = {{\n")
+        for i in range(0, len(wire), 16):
+            f.write("    " + ", ".join(f"0x{b:02x}" for b in wire[i:i + 16]) + ",\n")
+        f.write("};\n\n")
+        f.write("// Reference decoder's counters\n")
+        for field in ("frames", "dropped", "crc_errors", "bad_packets"):
+            f.write(f"static const uint32_t {name}_{field.upper()} = {stats[field]};\n")
+        f.write("\n// Verified frames in order: seq, CRC-16/CCITT-FALSE of the body\n")
+        f.write(f"static const uint16_t {name}_VERIFIED[{len(frames)}][2] = {{\n")
+        for i in range(0, len(frames), 8):
+            row = frames[i:i + 8]
+            f.write("    " + ", ".join(f"{{0x{seq:04x}, 0x{crc16(body):04x}}}" for seq, body in row) + ",\n")
+        f.write("};\n")
+
+
+# ─── Device ───────────────────────────────────────────────────────────────────
+
+def read_stats(port, rx):
+    """Drain the port; returns the newest STATS dict seen, or None."""
+    rx += port.read(port.in_waiting or 0)
+    latest = None
+    while b"\x00" in rx:
+        chunk, _, rest = bytes(rx).partition(b"\x00")
+        rx[:] = rest
+        pkt = parse(chunk) if chunk else None
+        if pkt and pkt[0] == STATS and len(pkt[2]) == STATS_FMT.size:
+            latest = dict(zip(STATS_FIELDS, STATS_FMT.unpack(pkt[2])))
+    return latest
+
+
+def print_stats(label, s, sent):
+    print(f"{label}  sent={sent}  verified={s['frames']}  shown={s['shown']}  "
+          f"superseded={s['superseded']}  dropped={s['dropped']}  crc={s['crc_errors']}  "
+          f"bad={s['bad_packets']}")
+
+
+def device(args):
+    try:
+        import serial
+    except ImportError:
+        sys.exit("needs pyserial: pip install pyserial")
+
+    port = serial.Serial(args.port, 115200, timeout=0)
+    rx = bytearray()
+    seq = 0
+
+    def send(ptype, body=b""):
+        nonlocal seq
+        port.write(packet(ptype, seq, body))
+        seq += 1
+
+    port.write(b"\x00")
+    time.sleep(0.05)
+    if args.brightness is not None:
+        send(BRIGHTNESS, bytes((args.brightness,)))
+
+    period = 1.0 / args.fps
+    start = time.perf_counter()
+    next_frame, next_ping = start, start + 1.0
+    sent = 0
+    latest = None
+    while True:
+        now = time.perf_counter()
+        if now - start >= args.seconds:
+            break
+        if now >= next_ping:
+            send(PING)
+            next_ping += 1.0
+        if now >= next_frame:
+            send(FRAME, frame_body(sent))
+            sent += 1
+            next_frame += period
+            if next_frame < now - 0.1:
+                next_frame = now   # fell behind: keep going as fast as the port takes it
+        s = read_stats(port, rx)
+        if s:
+            latest = s
+            print_stats(f"  t={now - start:5.1f}s", s, sent)
+        time.sleep(max(0.0, min(next_frame, next_ping) - time.perf_counter()))
+
+    elapsed = time.perf_counter() - start
+    send(PING)
+    deadline = time.perf_counter() + 1.0
+    while time.perf_counter() < deadline:
+        s = read_stats(port, rx)
+        if s:
+            latest = s
+            break
+        time.sleep(0.01)
+    send(STOP)
+    port.close()
+
+    print(f"sent {sent} frames in {elapsed:.1f} s = {sent / elapsed:.0f} fps (asked {args.fps})")
+    if latest:
+        print_stats("device", latest, sent)
+    else:
+        print("device: no STATS reply")
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("port", nargs="?", help="serial port of the board (omit with --loopback)")
+    ap.add_argument("--fps", type=float, default=200, help="frames per second to send (default 200)")
+    ap.add_argument("--seconds", type=float, default=10, help="how long to stream (default 10)")
+    ap.add_argument("--brightness", type=int, help="strip brightness 0-255 for the stream")
+    ap.add_argument("--loopback", action="store_true", help="no device: encode, damage, decode, check")
+    ap.add_argument("--frames", type=int, default=20000, help="frames for --loopback (default 20000)")
+    ap.add_argument("--loss", type=float, default=0.0, help="--loopback: chance a packet is withheld")
+    ap.add_argument("--corrupt", type=float, default=0.0, help="--loopback: chance a packet is damaged")
+    ap.add_argument("--seed", type=int, default=1, help="seed for --loopback faults")
+    ap.add_argument("--first-seq", type=lambda v: int(v, 0), default=0,
+                    help="--loopback: seq of the first packet, to cross the 16-bit wrap (default 0)")
+    ap.add_argument("--c-header", metavar="PATH",
+                    help="--loopback: also write the received wire bytes and reference counts as a C header")
+    args = ap.parse_args()
+
+    if args.loopback:
+        loopback(args)
+    elif args.port:
+        if args.fps <= 0 or (args.brightness is not None and not 0 <= args.brightness <= 255):
+            ap.error("--fps must be positive, --brightness 0-255")
+        device(args)
+    else:
+        ap.error("need a serial port or --loopback")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,276 @@
+#!/usr/bin/env python3
+"""Encode a flame trace for Trace mode and verify it round-trips.
+
+Input is a CSV with a header naming some of: t_ms, w1, w2, red, strip.
+The host sim (bench/host_sim.cpp) writes such a CSV directly; serial logs
+from the firmware's `sim ... csv=<ms>` command work as-is too, and only
+the lines between "[SIM] csv begin" and "[SIM] csv end" are read.
+
+  w1, w2, red   PWM duty counts (0-4095), or 0.0-1.0 fractions of full scale
+  strip         strip level in the same units, or the sim's per-pixel
+                rrggbb hex column (mean pixel brightness is used)
+  t_ms          sample time; without it samples are --in-rate apart
+
+Missing w2 copies w1; missing red or strip is zero. The series is resampled to
+--rate, encoded in the format described in src/trace.h, decoded again with a
+reference decoder and compared against the resampled input.
+
+  tools/trace_encode.py capture.log flame.ftr
+  tools/trace_encode.py --synth 600 synth.ftr       # 10 min test trace
+  tools/trace_encode.py --synth 4 --block 64 /dev/null --c-header fixture.h
+
+Deltas are packed in nibbles, so --shift pays off: on --synth 600 it takes
+6.5 bits/sample at 0 down to 4.8 at 2 (round-trip error at most 2 counts).
+
+--c-header also writes the trace and its reference decoding as C arrays, the
+fixture the native TraceReader test (test/test_trace) checks against.
+"""
+
+import argparse
+import csv
+import math
+import os
+import random
+import struct
+import sys
+
+MAGIC = 0x43525446  # "FTRC"
+VERSION = 2
+CHANNELS = ("w1", "w2", "red", "strip")
+MAX_DUTY = 4095
+HEADER = struct.Struct("<IBBHIHBBI")  # must match TraceHeader in src/trace.h
+PARTITION = "flametrace"
+
+
+# ─── Input ────────────────────────────────────────────────────────────────────
+
+def read_rows(path):
+    with open(path, newline="") as f:
+        lines = f.read().splitlines()
+    if any(l.startswith("[SIM] csv begin") for l in lines):
+        start = next(i for i, l in enumerate(lines) if l.startswith("[SIM] csv begin")) + 1
+        end = next((i for i, l in enumerate(lines) if l.startswith("[SIM] csv end")), len(lines))
+        lines = lines[start:end]
+    return list(csv.DictReader(l for l in lines if l.strip()))
+
+
+def parse_value(text):
+    text = text.strip()
+    if "." in text:
+        return float(text) * MAX_DUTY
+    if len(text) >= 6 and len(text) % 6 == 0 and not text.isdigit():
+        # rrggbb per pixel: mean brightness on the 0-255 scale
+        px = [int(text[i:i + 6], 16) for i in range(0, len(text), 6)]
+        level = sum(max(p >> 16, (p >> 8) & 0xFF, p & 0xFF) for p in px) / len(px)
+        return level * MAX_DUTY / 255.0
+    return float(int(text))
+
+
+def load_series(path, in_rate):
+    rows = read_rows(path)
+    if not rows:
+        sys.exit(f"{path}: no samples")
+    cols = {c: [] for c in CHANNELS}
+    times = []
+    for i, row in enumerate(rows):
+        times.append(float(row["t_ms"]) if "t_ms" in row else i * 1000.0 / in_rate)
+        w1 = parse_value(row["w1"]) if "w1" in row else 0.0
+        cols["w1"].append(w1)
+        cols["w2"].append(parse_value(row["w2"]) if "w2" in row else w1)
+        cols["red"].append(parse_value(row["red"]) if "red" in row else 0.0)
+        cols["strip"].append(parse_value(row["strip"]) if "strip" in row else 0.0)
+    return times, cols
+
+
+def synth_series(seconds, rate, seed):
+    # Layered sines with random phase plus occasional dips: enough structure to
+    # exercise the encoder the way a real flame does.
+    rng = random.Random(seed)
+    n = int(seconds * rate)
+    times = [i * 1000.0 / rate for i in range(n)]
+    cols = {c: [] for c in CHANNELS}
+    phase = [rng.uniform(0, 2 * math.pi) for _ in range(8)]
+    dip = 1.0
+    for t in times:
+        s = t / 1000.0
+        base = 0.55 + 0.25 * math.sin(0.7 * s + phase[0]) + 0.12 * math.sin(5.3 * s + phase[1])
+        base += 0.06 * math.sin(13.1 * s + phase[2])
+        dip = 0.15 if rng.random() < 0.5 / rate else min(1.0, dip + 4.0 / rate)
+        level = max(0.0, min(1.0, base)) * dip
+        cols["w1"].append(level * 450 * (1 + 0.2 * math.sin(2.1 * s + phase[3])))
+        cols["w2"].append(level * 450 * (1 + 0.2 * math.sin(2.9 * s + phase[4])))
+        cols["red"].append(600 + (1 - level) * 500)
+        cols["strip"].append(level * MAX_DUTY)
+    return times, cols
+
+
+def resample(times, values, rate):
+    duration = times[-1] - times[0]
+    n = max(1, int(duration * rate / 1000.0) + 1)
+    out, j = [], 0
+    for i in range(n):
+        t = times[0] + i * 1000.0 / rate
+        while j + 1 < len(times) - 1 and times[j + 1] <= t:
+            j += 1
+        if j + 1 >= len(times):
+            v = values[-1]
+        else:
+            t0, t1 = times[j], times[j + 1]
+            f = 0.0 if t1 == t0 else min(1.0, max(0.0, (t - t0) / (t1 - t0)))
+            v = values[j] + (values[j + 1] - values[j]) * f
+        out.append(max(0, min(MAX_DUTY, int(round(v)))))
+    return out
+
+
+# ─── Format ───────────────────────────────────────────────────────────────────
+
+def nibble_varint(v, out):
+    # 3 value bits per nibble, least significant first; bit 3 = more follow
+    while v >= 0x8:
+        out.append((v & 0x7) | 0x8)
+        v >>= 3
+    out.append(v)
+
+
+def pack_nibbles(nibbles):
+    if len(nibbles) % 2:
+        nibbles = nibbles + [0]
+    return bytes(lo | (hi << 4) for lo, hi in zip(nibbles[0::2], nibbles[1::2]))
+
+
+def encode(frames, rate, block_frames, shift):
+    half = (1 << shift) >> 1
+    q = [[(v + half) >> shift for v in f] for f in frames]
+    blocks = []
+    for start in range(0, len(q), block_frames):
+        b = bytearray()
+        chunk = q[start:start + block_frames]
+        for v in chunk[0]:
+            b += struct.pack("<H", v)
+        nibbles = []
+        for prev, cur in zip(chunk, chunk[1:]):
+            for p, c in zip(prev, cur):
+                d = c - p
+                nibble_varint(d << 1 if d >= 0 else (-d << 1) - 1, nibbles)   # zigzag
+        blocks.append(bytes(b) + pack_nibbles(nibbles))
+
+    offset = HEADER.size + 4 * len(blocks)
+    index = bytearray()
+    for b in blocks:
+        index += struct.pack("<I", offset)
+        offset += len(b)
+    header = HEADER.pack(MAGIC, VERSION, len(CHANNELS), rate, len(frames),
+                         block_frames, shift, 0, len(blocks))
+    return header + bytes(index) + b"".join(blocks)
+
+
+def decode(data):
+    """Reference decoder, mirroring TraceReader::next()."""
+    magic, version, channels, rate, n, block_frames, shift, _, block_count = \
+        HEADER.unpack_from(data, 0)
+    if magic != MAGIC or version != VERSION or channels != len(CHANNELS):
+        raise ValueError("not a flame trace")
+    frames = []
+    for blk in range(block_count):
+        pos = struct.unpack_from("<I", data, HEADER.size + 4 * blk)[0]
+        last = list(struct.unpack_from("<" + "H" * channels, data, pos))
+        nib = 2 * (pos + 2 * channels)   # nibble position, low half first
+        frames.append(last[:])
+        for _ in range(min(block_frames, n - blk * block_frames) - 1):
+            for ch in range(channels):
+                v, s = 0, 0
+                while True:
+                    x = (data[nib >> 1] >> (4 * (nib & 1))) & 0xF
+                    nib += 1
+                    v |= (x & 0x7) << s
+                    s += 3
+                    if not x & 0x8:
+                        break
+                last[ch] = (last[ch] + ((v >> 1) ^ -(v & 1))) & 0xFFFF
+            frames.append(last[:])
+    return rate, [[min(MAX_DUTY, v << shift) for v in f] for f in frames]
+
+
+def write_c_header(path, data, frames):
+    name = os.path.splitext(os.path.basename(path))[0].upper()
+    with open(path, "w") as f:
+        f.write("// Generated by tools/trace_encode.py; do not edit. Regenerate with\n")
+        f.write("//   tools/trace_encode.py " + " ".join(sys.argv[1:]) + "\n")
+        f.write("#pragma once\n#include <stdint.h>\n\n")
+        f.write(f"static const uint8_t {name}_DATA[{len(data)}] = {{\n")
+        for i in range(0, len(data), 16):
+            f.write("    " + ", ".join(f"0x{b:02x}" for b in data[i:i + 16]) + ",\n")
+        f.write("};\n\n")
+        f.write(f"// Reference decoding, frame by frame: {', '.join(CHANNELS)}\n")
+        f.write(f"static const uint16_t {name}_FRAMES[{len(frames)}][{len(CHANNELS)}] = {{\n")
+        for fr in frames:
+            f.write("    {" + ", ".join(str(v) for v in fr) + "},\n")
+        f.write("};\n")
+
+
+def partition_offset():
+    path = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "partitions.csv")
+    try:
+        with open(path) as f:
+            for line in f:
+                fields = [x.strip() for x in line.split(",")]
+                if fields and fields[0] == PARTITION:
+                    return int(fields[3], 0), int(fields[4], 0)
+    except OSError:
+        pass
+    return None, None
+
+
+# ─── Main ─────────────────────────────────────────────────────────────────────
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("input", nargs="?", help="CSV or serial log (omit with --synth)")
+    ap.add_argument("output", help="encoded trace to write")
+    ap.add_argument("--rate", type=int, default=100, help="trace frames per second (default 100)")
+    ap.add_argument("--in-rate", type=float, default=None, help="input rate when there is no t_ms column")
+    ap.add_argument("--block", type=int, default=256, help="frames per seek block (default 256)")
+    ap.add_argument("--shift", type=int, default=0, help="drop this many low bits (lossy; see above)")
+    ap.add_argument("--synth", type=float, metavar="SECONDS", help="generate a synthetic trace instead")
+    ap.add_argument("--seed", type=int, default=1, help="seed for --synth")
+    ap.add_argument("--c-header", metavar="PATH", help="also write trace + reference decoding as a C header")
+    args = ap.parse_args()
+
+    if not 1 <= args.rate <= 65535 or not 1 <= args.block <= 65535 or not 0 <= args.shift <= 15:
+        ap.error("--rate and --block must be 1-65535, --shift 0-15")
+    if args.synth:
+        times, cols = synth_series(args.synth, args.rate, args.seed)
+    elif args.input:
+        times, cols = load_series(args.input, args.in_rate or args.rate)
+    else:
+        ap.error("need an input file or --synth")
+
+    series = [resample(times, cols[c], args.rate) for c in CHANNELS]
+    frames = [list(f) for f in zip(*series)]
+    data = encode(frames, args.rate, args.block, args.shift)
+    with open(args.output, "wb") as f:
+        f.write(data)
+
+    # Round trip through the reference decoder
+    rate, decoded = decode(data)
+    if len(decoded) != len(frames):
+        sys.exit(f"round trip failed: {len(decoded)} frames decoded, {len(frames)} encoded")
+    raw = len(frames) * len(CHANNELS) * 2
+    print(f"{args.output}: {len(frames)} frames @ {rate} Hz ({len(frames) / rate:.1f} s), "
+          f"{len(data)} B  (raw uint16 {raw} B, ratio {raw / len(data):.2f}:1, "
+          f"{8.0 * len(data) / (len(frames) * len(CHANNELS)):.2f} bits/sample)")
+    for ch, name in enumerate(CHANNELS):
+        err = [abs(a[ch] - b[ch]) for a, b in zip(frames, decoded)]
+        print(f"  {name:<5} round-trip error  max={max(err)}  mean={sum(err) / len(err):.2f}  (of {MAX_DUTY})")
+    if args.c_header:
+        write_c_header(args.c_header, data, decoded)
+
+    offset, size = partition_offset()
+    if offset is not None:
+        if len(data) > size:
+            sys.exit(f"trace is {len(data)} B but the '{PARTITION}' partition holds {size} B")
+        print(f"flash with: esptool.py --chip esp32s3 write_flash 0x{offset:x} {args.output}")
+
+
+if __name__ == "__main__":
+    main()